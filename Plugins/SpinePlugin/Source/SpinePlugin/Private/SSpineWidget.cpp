@@ -91,84 +91,10 @@ int32 SSpineWidget::OnPaint(const FPaintArgs &Args, const FGeometry &AllottedGeo
 	if (widget && widget->skeleton && widget->Atlas) {
 		widget->skeleton->getColor().set(widget->Color.R, widget->Color.G, widget->Color.B, widget->Color.A);
 
-		if (widget->atlasNormalBlendMaterials.Num() != widget->Atlas->atlasPages.Num()) {
-			widget->atlasNormalBlendMaterials.SetNum(0);
-			widget->pageToNormalBlendMaterial.Empty();
-			widget->atlasAdditiveBlendMaterials.SetNum(0);
-			widget->pageToAdditiveBlendMaterial.Empty();
-			widget->atlasMultiplyBlendMaterials.SetNum(0);
-			widget->pageToMultiplyBlendMaterial.Empty();
-			widget->atlasScreenBlendMaterials.SetNum(0);
-			widget->pageToScreenBlendMaterial.Empty();
-
-			for (int i = 0; i < widget->Atlas->atlasPages.Num(); i++) {
-				AtlasPage *currPage = widget->Atlas->GetAtlas()->getPages()[i];
-
-				UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(widget->NormalBlendMaterial, widget);
-				material->SetTextureParameterValue(widget->TextureParameterName, widget->Atlas->atlasPages[i]);
-				widget->atlasNormalBlendMaterials.Add(material);
-				widget->pageToNormalBlendMaterial.Add(currPage, material);
-
-				material = UMaterialInstanceDynamic::Create(widget->AdditiveBlendMaterial, widget);
-				material->SetTextureParameterValue(widget->TextureParameterName, widget->Atlas->atlasPages[i]);
-				widget->atlasAdditiveBlendMaterials.Add(material);
-				widget->pageToAdditiveBlendMaterial.Add(currPage, material);
-
-				material = UMaterialInstanceDynamic::Create(widget->MultiplyBlendMaterial, widget);
-				material->SetTextureParameterValue(widget->TextureParameterName, widget->Atlas->atlasPages[i]);
-				widget->atlasMultiplyBlendMaterials.Add(material);
-				widget->pageToMultiplyBlendMaterial.Add(currPage, material);
-
-				material = UMaterialInstanceDynamic::Create(widget->ScreenBlendMaterial, widget);
-				material->SetTextureParameterValue(widget->TextureParameterName, widget->Atlas->atlasPages[i]);
-				widget->atlasScreenBlendMaterials.Add(material);
-				widget->pageToScreenBlendMaterial.Add(currPage, material);
-			}
-		} else {
-			widget->pageToNormalBlendMaterial.Empty();
-			widget->pageToAdditiveBlendMaterial.Empty();
-			widget->pageToMultiplyBlendMaterial.Empty();
-			widget->pageToScreenBlendMaterial.Empty();
-
-			for (int i = 0; i < widget->Atlas->atlasPages.Num(); i++) {
-				AtlasPage *currPage = widget->Atlas->GetAtlas()->getPages()[i];
-
-				UTexture2D *texture = widget->Atlas->atlasPages[i];
-				UTexture *oldTexture = nullptr;
-
-				UMaterialInstanceDynamic *current = widget->atlasNormalBlendMaterials[i];
-				if (!current || !current->GetTextureParameterValue(widget->TextureParameterName, oldTexture) || oldTexture != texture) {
-					UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(widget->NormalBlendMaterial, widget);
-					material->SetTextureParameterValue(widget->TextureParameterName, texture);
-					widget->atlasNormalBlendMaterials[i] = material;
-				}
-				widget->pageToNormalBlendMaterial.Add(currPage, widget->atlasNormalBlendMaterials[i]);
-
-				current = widget->atlasAdditiveBlendMaterials[i];
-				if (!current || !current->GetTextureParameterValue(widget->TextureParameterName, oldTexture) || oldTexture != texture) {
-					UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(widget->AdditiveBlendMaterial, widget);
-					material->SetTextureParameterValue(widget->TextureParameterName, texture);
-					widget->atlasAdditiveBlendMaterials[i] = material;
-				}
-				widget->pageToAdditiveBlendMaterial.Add(currPage, widget->atlasAdditiveBlendMaterials[i]);
-
-				current = widget->atlasMultiplyBlendMaterials[i];
-				if (!current || !current->GetTextureParameterValue(widget->TextureParameterName, oldTexture) || oldTexture != texture) {
-					UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(widget->MultiplyBlendMaterial, widget);
-					material->SetTextureParameterValue(widget->TextureParameterName, texture);
-					widget->atlasMultiplyBlendMaterials[i] = material;
-				}
-				widget->pageToMultiplyBlendMaterial.Add(currPage, widget->atlasMultiplyBlendMaterials[i]);
-
-				current = widget->atlasScreenBlendMaterials[i];
-				if (!current || !current->GetTextureParameterValue(widget->TextureParameterName, oldTexture) || oldTexture != texture) {
-					UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(widget->ScreenBlendMaterial, widget);
-					material->SetTextureParameterValue(widget->TextureParameterName, texture);
-					widget->atlasScreenBlendMaterials[i] = material;
-				}
-				widget->pageToScreenBlendMaterial.Add(currPage, widget->atlasScreenBlendMaterials[i]);
-			}
-		}
+		UMaterialInterface *parents[] = {widget->NormalBlendMaterial, widget->AdditiveBlendMaterial, widget->MultiplyBlendMaterial, widget->ScreenBlendMaterial};
+		TArray<UMaterialInstanceDynamic *> *instances[] = {&widget->atlasNormalBlendMaterials, &widget->atlasAdditiveBlendMaterials,
+															&widget->atlasMultiplyBlendMaterials, &widget->atlasScreenBlendMaterials};
+		widget->materialTable.Update(widget, widget->Atlas, widget->TextureParameterName, parents, instances);
 
 		self->UpdateMesh(LayerId, OutDrawElements, AllottedGeometry, widget->skeleton);
 	}
@@ -292,42 +218,10 @@ void SSpineWidget::UpdateMesh(int32 LayerId, FSlateWindowElementList &OutDrawEle
 		// if the user switches the atlas data while not having switched
 		// to the correct skeleton data yet, we won't find any regions.
 		// ignore regions for which we can't find a material
-		UMaterialInstanceDynamic *material = nullptr;
-		switch (slot->getData().getBlendMode()) {
-			case BlendMode_Normal:
-				if (!widget->pageToNormalBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = widget->pageToNormalBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			case BlendMode_Additive:
-				if (!widget->pageToAdditiveBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = widget->pageToAdditiveBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			case BlendMode_Multiply:
-				if (!widget->pageToMultiplyBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = widget->pageToMultiplyBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			case BlendMode_Screen:
-				if (!widget->pageToScreenBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = widget->pageToScreenBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			default:
-				if (!widget->pageToNormalBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = widget->pageToNormalBlendMaterial[attachmentAtlasRegion->page];
+		UMaterialInstanceDynamic *material = widget->materialTable.Find(attachmentAtlasRegion->page, slot->getData().getBlendMode());
+		if (!material) {
+			clipper.clipEnd(*slot);
+			continue;
 		}
 
 		if (clipper.isClipping()) {
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpinePluginPrivatePCH.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Parallel Animation Update"), STAT_SpineParallelAnimationUpdate, STATGROUP_Spine);
+
+static int32 GSpineAnimationUpdateBudget = 0;
+static FAutoConsoleVariableRef CVarSpineAnimationUpdateBudget(
+	TEXT("spine.AnimationUpdateBudget"),
+	GSpineAnimationUpdateBudget,
+	TEXT("Maximum number of animation components using animation LOD that update per frame in each world, 0 for no limit. ")
+	TEXT("Components over the budget wait, those that waited longest update first."));
+
+void FSpineAnimationUpdateTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef &MyCompletionGraphEvent) {
+	if (Subsystem) Subsystem->Update(DeltaTime, TickType);
+}
+
+FString FSpineAnimationUpdateTickFunction::DiagnosticMessage() {
+	return TEXT("USpineAnimationUpdateSubsystem::Update");
+}
+
+void USpineAnimationUpdateSubsystem::Deinitialize() {
+	if (tickFunction.IsTickFunctionRegistered()) tickFunction.UnRegisterTickFunction();
+	components.Empty();
+	updatedComponents.Empty();
+	passComponents.Empty();
+	budgetRequests.Empty();
+	budgetGrants.Empty();
+	Super::Deinitialize();
+}
+
+void USpineAnimationUpdateSubsystem::AddComponent(USpineSkeletonAnimationComponent *Component) {
+	components.AddUnique(Component);
+	RegisterTickFunction();
+}
+
+void USpineAnimationUpdateSubsystem::RemoveComponent(USpineSkeletonAnimationComponent *Component) {
+	// Keeps the registration order, events are broadcast in that order.
+	components.Remove(Component);
+}
+
+void USpineAnimationUpdateSubsystem::RegisterTickFunction() {
+	if (tickFunction.IsTickFunctionRegistered()) return;
+	tickFunction.Subsystem = this;
+	tickFunction.TickGroup = TG_PrePhysics;
+	tickFunction.bCanEverTick = true;
+	// Runs while paused, so the components that tick when paused are updated. The others are skipped in Update.
+	tickFunction.bTickEvenWhenPaused = true;
+	tickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+}
+
+bool USpineAnimationUpdateSubsystem::ClaimUpdateBudget(USpineSkeletonAnimationComponent *Component, float Priority) {
+	if (GSpineAnimationUpdateBudget <= 0) return true;
+	// Components may tick before this subsystem, so the frame's grants are made by whichever claims first.
+	GrantUpdateBudget();
+	if (budgetGrants.Remove(Component) > 0) return true;
+	if (budgetUsed < GSpineAnimationUpdateBudget) {
+		budgetUsed++;
+		return true;
+	}
+	budgetRequests.Add({Component, Priority});
+	return false;
+}
+
+void USpineAnimationUpdateSubsystem::GrantUpdateBudget() {
+	if (budgetFrame == GFrameCounter) return;
+	budgetFrame = GFrameCounter;
+	// Grants not used in their frame expire, so no more than the budget updates in any frame.
+	budgetGrants.Reset();
+	budgetUsed = 0;
+	if (GSpineAnimationUpdateBudget <= 0) {
+		budgetRequests.Reset();
+		return;
+	}
+	// The requests that went over the budget in the previous frame are granted first, the most overdue before the others.
+	budgetRequests.StableSort([](const FBudgetRequest &a, const FBudgetRequest &b) { return a.Priority > b.Priority; });
+	for (const FBudgetRequest &request : budgetRequests) {
+		if (budgetUsed >= GSpineAnimationUpdateBudget) break;
+		if (!request.Component.IsValid()) continue;
+		budgetGrants.Add(request.Component);
+		budgetUsed++;
+	}
+	budgetRequests.Reset();
+}
+
+void USpineAnimationUpdateSubsystem::Update(float DeltaTime, ELevelTick TickType) {
+	SCOPE_CYCLE_COUNTER(STAT_SpineParallelAnimationUpdate);
+
+	GrantUpdateBudget();
+
+	// In the editor the components tick themselves, as their bTickInEditor allows.
+	if (TickType == LEVELTICK_ViewportsOnly) return;
+	bool paused = TickType == LEVELTICK_PauseTick;
+	updatedComponents.Reset();
+	// BeginParallelUpdate may broadcast delegates that unregister components, so a copy of the list is iterated.
+	passComponents = components;
+	for (USpineSkeletonAnimationComponent *component : passComponents) {
+		if (!IsValid(component) || !component->IsComponentTickEnabled()) continue;
+		if (paused && !component->PrimaryComponentTick.bTickEvenWhenPaused) continue;
+		if (component->BeginParallelUpdate(DeltaTime)) updatedComponents.Add(component);
+	}
+
+	// Components only touch their own skeleton and animation state on the workers. Events are queued and the game thread
+	// work is done in order after each pass, so the result does not depend on how the work was split.
+	if (GatherPassComponents()) {
+		ParallelFor(passComponents.Num(), [this](int32 i) { passComponents[i]->UpdateAnimationStateParallel(); });
+		for (const TWeakObjectPtr<USpineSkeletonAnimationComponent> &component : updatedComponents)
+			if (IsValid(component.Get())) component->BeforeParallelWorldTransform();
+	}
+	if (GatherPassComponents()) {
+		ParallelFor(passComponents.Num(), [this](int32 i) { passComponents[i]->UpdateWorldTransformParallel(); });
+		for (const TWeakObjectPtr<USpineSkeletonAnimationComponent> &component : updatedComponents)
+			if (IsValid(component.Get())) component->AfterParallelWorldTransform();
+	}
+	updatedComponents.Reset();
+	passComponents.Reset();
+}
+
+bool USpineAnimationUpdateSubsystem::GatherPassComponents() {
+	passComponents.Reset();
+	for (const TWeakObjectPtr<USpineSkeletonAnimationComponent> &component : updatedComponents) {
+		USpineSkeletonAnimationComponent *valid = component.Get();
+		if (IsValid(valid)) passComponents.Add(valid);
+	}
+	return passComponents.Num() > 0;
+}
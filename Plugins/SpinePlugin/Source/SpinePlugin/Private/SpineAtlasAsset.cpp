@@ -29,14 +29,53 @@
 
 #include "SpinePluginPrivatePCH.h"
 #include "spine/spine.h"
-#include <stdlib.h>
-#include <string.h>
-#include <string>
 
 #define LOCTEXT_NAMESPACE "Spine"
 
 using namespace spine;
 
+bool FSpineMaterialTable::Update(UObject *Outer, USpineAtlasAsset *Atlas, FName TextureParameterName, UMaterialInterface *const (&Parents)[4],
+								 TArray<UMaterialInstanceDynamic *> *const (&Instances)[4]) {
+	spine::Atlas *atlas = Atlas->GetAtlas();
+	int32 numPages = atlas ? FMath::Min((int32) atlas->getPages().size(), Atlas->atlasPages.Num()) : 0;
+
+	// Only pointer comparisons, this runs every frame.
+	bool upToDate = pages.Num() == numPages && textureParameterName == TextureParameterName;
+	for (int32 b = 0; upToDate && b < 4; b++)
+		upToDate = parents[b] == Parents[b] && Instances[b]->Num() == numPages;
+	for (int32 i = 0; upToDate && i < numPages; i++) {
+		upToDate = pages[i] == atlas->getPages()[i] && textures[i] == Atlas->atlasPages[i];
+		for (int32 b = 0; upToDate && b < 4; b++)
+			upToDate = (*Instances[b])[i] == materials[i * 4 + b];
+	}
+	if (upToDate) return false;
+
+	pages.SetNum(numPages);
+	textures.SetNum(numPages);
+	materials.SetNum(numPages * 4);
+	textureParameterName = TextureParameterName;
+	for (int32 b = 0; b < 4; b++) {
+		parents[b] = Parents[b];
+		Instances[b]->SetNum(numPages);
+	}
+	for (int32 i = 0; i < numPages; i++) {
+		UTexture2D *texture = Atlas->atlasPages[i];
+		pages[i] = atlas->getPages()[i];
+		textures[i] = texture;
+		for (int32 b = 0; b < 4; b++) {
+			UMaterialInstanceDynamic *&instance = (*Instances[b])[i];
+			UTexture *oldTexture = nullptr;
+			if (!instance || instance->Parent != Parents[b] || !instance->GetTextureParameterValue(TextureParameterName, oldTexture) ||
+				oldTexture != texture) {
+				instance = UMaterialInstanceDynamic::Create(Parents[b], Outer);
+				instance->SetTextureParameterValue(TextureParameterName, texture);
+			}
+			materials[i * 4 + b] = instance;
+		}
+	}
+	return true;
+}
+
 #if WITH_EDITORONLY_DATA
 
 void USpineAtlasAsset::SetAtlasFileName(const FName &AtlasFileName) {
@@ -81,37 +120,17 @@ FName USpineAtlasAsset::GetAtlasFileName() const {
 
 void USpineAtlasAsset::SetRawData(const FString &RawData) {
 	this->rawData = RawData;
-	if (atlas) {
-		delete atlas;
-		atlas = nullptr;
-	}
+	nativeAtlas.Reset();
 }
 
 void USpineAtlasAsset::BeginDestroy() {
-	if (atlas) {
-		delete atlas;
-		atlas = nullptr;
-	}
+	nativeAtlas.Reset();
 	Super::BeginDestroy();
 }
 
 Atlas *USpineAtlasAsset::GetAtlas() {
-	if (!atlas) {
-		if (atlas) {
-			delete atlas;
-			atlas = nullptr;
-		}
-		std::string t = TCHAR_TO_UTF8(*rawData);
-
-		atlas = new (__FILE__, __LINE__) Atlas(t.c_str(), strlen(t.c_str()), "", nullptr);
-		Vector<AtlasPage *> &pages = atlas->getPages();
-		for (size_t i = 0, n = pages.size(), j = 0; i < n; i++) {
-			AtlasPage *page = pages[i];
-			if (atlasPages.Num() > 0 && atlasPages.Num() > (int32) i)
-				page->setRendererObject(atlasPages[j++]);
-		}
-	}
-	return this->atlas;
+	if (!nativeAtlas.IsValid()) nativeAtlas = FSpineNativeDataCache::Get().FindOrAddAtlas(rawData, atlasPages);
+	return nativeAtlas->Atlas;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -39,27 +39,25 @@ void USpineBoneDriverComponent::BeginPlay() {
 	Super::BeginPlay();
 }
 
-void USpineBoneDriverComponent::BeforeUpdateWorldTransform(USpineSkeletonComponent *skeleton) {
-	if (skeleton == lastBoundComponent && skeleton) {
-		if (UseComponentTransform) {
-			skeleton->SetBoneWorldPosition(BoneName, GetComponentLocation());
-		} else {
-			AActor *owner = GetOwner();
-			if (owner) skeleton->SetBoneWorldPosition(BoneName, owner->GetActorLocation());
-		}
-	}
-}
-
 void USpineBoneDriverComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (Target) {
-		USpineSkeletonComponent *skeleton = static_cast<USpineSkeletonComponent *>(Target->GetComponentByClass(USpineSkeletonComponent::StaticClass()));
-		if (skeleton != lastBoundComponent && skeleton) {
-			// if (lastBoundComponent) lastBoundComponent->BeforeUpdateWorldTransform.RemoveAll(this);
-			if (!skeleton->BeforeUpdateWorldTransform.GetAllObjects().Contains(this))
-				skeleton->BeforeUpdateWorldTransform.AddDynamic(this, &USpineBoneDriverComponent::BeforeUpdateWorldTransform);
-			lastBoundComponent = skeleton;
-		}
+	// The skeleton component drives the bone before it updates its world transform, this only keeps the registration up to date.
+	if (Target != lastTarget.Get() || (Target && !boundSkeleton.IsValid())) {
+		BindSkeleton(Target ? Target->FindComponentByClass<USpineSkeletonComponent>() : nullptr);
+		lastTarget = Target;
 	}
 }
+
+void USpineBoneDriverComponent::OnUnregister() {
+	BindSkeleton(nullptr);
+	lastTarget = nullptr;
+	Super::OnUnregister();
+}
+
+void USpineBoneDriverComponent::BindSkeleton(USpineSkeletonComponent *skeleton) {
+	if (boundSkeleton.Get() == skeleton) return;
+	if (USpineSkeletonComponent *previous = boundSkeleton.Get()) previous->RemoveBoneDriver(this);
+	if (skeleton) skeleton->AddBoneDriver(this);
+	boundSkeleton = skeleton;
+}
@@ -42,22 +42,42 @@ void USpineBoneFollowerComponent::BeginPlay() {
 void USpineBoneFollowerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (Target) {
-		USpineSkeletonComponent *skeleton = static_cast<USpineSkeletonComponent *>(Target->GetComponentByClass(USpineSkeletonComponent::StaticClass()));
-		if (skeleton) {
-			FTransform transform = skeleton->GetBoneWorldTransform(BoneName);
-			if (UseComponentTransform) {
-				if (UsePosition) SetWorldLocation(transform.GetLocation());
-				if (UseRotation) SetWorldRotation(transform.GetRotation());
-				if (UseScale) SetWorldScale3D(transform.GetScale3D());
-			} else {
-				AActor *owner = GetOwner();
-				if (owner) {
-					if (UsePosition) owner->SetActorLocation(transform.GetLocation());
-					if (UseRotation) owner->SetActorRotation(transform.GetRotation());
-					if (UseScale) owner->SetActorScale3D(transform.GetScale3D());
-				}
-			}
+	// The skeleton component moves this follower in its own tick, this only keeps the registration up to date.
+	if (Target != lastTarget.Get() || (Target && !boundSkeleton.IsValid())) {
+		BindSkeleton(Target ? Target->FindComponentByClass<USpineSkeletonComponent>() : nullptr);
+		lastTarget = Target;
+	}
+}
+
+void USpineBoneFollowerComponent::OnUnregister() {
+	BindSkeleton(nullptr);
+	lastTarget = nullptr;
+	Super::OnUnregister();
+}
+
+void USpineBoneFollowerComponent::BindSkeleton(USpineSkeletonComponent *skeleton) {
+	if (boundSkeleton.Get() == skeleton) return;
+	if (USpineSkeletonComponent *previous = boundSkeleton.Get()) previous->RemoveBoneFollower(this);
+	if (skeleton) skeleton->AddBoneFollower(this);
+	boundSkeleton = skeleton;
+}
+
+void USpineBoneFollowerComponent::FollowBone(const FTransform &BoneTransform) {
+	if (!UsePosition && !UseRotation && !UseScale) return;
+	if (UseComponentTransform) {
+		FTransform transform = GetComponentTransform();
+		if (UsePosition) transform.SetLocation(BoneTransform.GetLocation());
+		if (UseRotation) transform.SetRotation(BoneTransform.GetRotation());
+		if (UseScale) transform.SetScale3D(BoneTransform.GetScale3D());
+		SetWorldTransform(transform);
+	} else {
+		AActor *owner = GetOwner();
+		if (owner) {
+			FTransform transform = owner->GetActorTransform();
+			if (UsePosition) transform.SetLocation(BoneTransform.GetLocation());
+			if (UseRotation) transform.SetRotation(BoneTransform.GetRotation());
+			if (UseScale) transform.SetScale3D(BoneTransform.GetScale3D());
+			owner->SetActorTransform(transform);
 		}
 	}
 }
@@ -0,0 +1,224 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpinePluginPrivatePCH.h"
+#include "Async/ParallelFor.h"
+
+using namespace spine;
+
+DECLARE_CYCLE_STAT(TEXT("Crowd Update"), STAT_SpineCrowdUpdate, STATGROUP_Spine);
+
+static void CopyInstance(const FSpineCrowdInstance &instance, FSpineMeshRenderData &data) {
+	const FMatrix matrix = instance.Transform.ToMatrixWithScale();
+
+	// Attachments only face towards or away from the camera, so there are just two tangent frames to transform.
+	FPackedNormal tangentX(instance.Transform.TransformVectorNoScale(FVector(1, 0, 0)));
+	FPackedNormal front(instance.Transform.TransformVectorNoScale(FVector(0, -1, 0)));
+	FPackedNormal back(instance.Transform.TransformVectorNoScale(FVector(0, 1, 0)));
+	front.Vector.W = back.Vector.W = 127;
+
+	const FSpineMeshRenderData &geometry = instance.Geometry;
+	for (int32 i = 0; i < geometry.Batches.Num(); i++) {
+		const FSpineMeshBatch &batch = geometry.Batches[i];
+		const FSpineCrowdTarget &target = instance.Targets[i];
+
+		const FDynamicMeshVertex *source = geometry.Vertices.GetData() + batch.FirstVertex;
+		FDynamicMeshVertex *vertices = data.Vertices.GetData() + target.FirstVertex;
+		for (int32 j = 0; j < batch.NumVertices; j++) {
+			FDynamicMeshVertex &vertex = vertices[j];
+			vertex = source[j];
+			vertex.Position = matrix.TransformPosition(source[j].Position);
+			vertex.TangentX = tangentX;
+			vertex.TangentZ = source[j].TangentZ.Vector.Y > 0 ? back : front;
+		}
+
+		const uint32 *sourceIndices = geometry.Indices.GetData() + batch.FirstIndex;
+		uint32 *indices = data.Indices.GetData() + target.FirstIndex;
+		for (int32 j = 0; j < batch.NumIndices; j++)
+			indices[j] = target.BaseVertex + sourceIndices[j];
+	}
+}
+
+USpineCrowdComponent::USpineCrowdComponent(const FObjectInitializer &ObjectInitializer)
+	: USpineSkeletonMeshComponent(ObjectInitializer) {
+	// The instances are animated during physics, the crowd is drawn once all of them are done.
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+void USpineCrowdComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
+	// Skips the mesh component's tick, the crowd does not render the skeleton component of its owner.
+	UMeshComponent::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	UpdateCrowd();
+}
+
+void USpineCrowdComponent::AddInstance(USpineSkeletonComponent *Instance) {
+	if (!Instance) return;
+	for (const TUniquePtr<FSpineCrowdInstance> &instance : crowdInstances)
+		if (instance->Skeleton == Instance) return;
+
+	crowdInstances.Emplace(MakeUnique<FSpineCrowdInstance>());
+	crowdInstances.Last()->Skeleton = Instance;
+	instancesChanged = true;
+}
+
+void USpineCrowdComponent::RemoveInstance(USpineSkeletonComponent *Instance) {
+	if (crowdInstances.RemoveAll([Instance](const TUniquePtr<FSpineCrowdInstance> &instance) { return instance->Skeleton == Instance; }) > 0)
+		instancesChanged = true;
+}
+
+void USpineCrowdComponent::UpdateCrowd() {
+	SCOPE_CYCLE_COUNTER(STAT_SpineCrowdUpdate);
+
+	if (crowdInstances.RemoveAll([](const TUniquePtr<FSpineCrowdInstance> &instance) {
+			USpineSkeletonComponent *skeleton = instance->Skeleton.Get();
+			return !skeleton || skeleton->IsBeingDestroyed();
+		}) > 0)
+		instancesChanged = true;
+
+	// All instances are drawn with the materials of the first one's atlas.
+	USpineAtlasAsset *atlas = nullptr;
+	for (const TUniquePtr<FSpineCrowdInstance> &instance : crowdInstances) {
+		USpineSkeletonComponent *skeleton = instance->Skeleton.Get();
+		if (skeleton->GetSkeleton() && skeleton->Atlas) {
+			atlas = skeleton->Atlas;
+			break;
+		}
+	}
+
+	bool rebuildAll = false;
+	if (atlas) {
+		UMaterialInterface *parents[] = {NormalBlendMaterial, AdditiveBlendMaterial, MultiplyBlendMaterial, ScreenBlendMaterial};
+		TArray<UMaterialInstanceDynamic *> *instances[] = {&atlasNormalBlendMaterials, &atlasAdditiveBlendMaterials,
+														   &atlasMultiplyBlendMaterials, &atlasScreenBlendMaterials};
+		bool materialsChanged = materialTable.Update(this, atlas, TextureParameterName, parents, instances);
+
+		// The scene proxy caches the material relevance, so it has to be re-created when the materials change.
+		if (materialsChanged) MarkRenderStateDirty();
+		rebuildAll = materialsChanged || Color != lastColor || DepthOffset != lastDepthOffset;
+		lastColor = Color;
+		lastDepthOffset = DepthOffset;
+	}
+
+	// Finds the instances to draw and those whose pose changed on the game thread.
+	const FTransform &crowdTransform = GetComponentTransform();
+	bool changed = instancesChanged;
+	instancesChanged = false;
+	builtInstances.Reset();
+	drawnInstances.Reset();
+	for (const TUniquePtr<FSpineCrowdInstance> &instance : crowdInstances) {
+		USpineSkeletonComponent *skeleton = instance->Skeleton.Get();
+		AActor *owner = skeleton->GetOwner();
+		spine::Skeleton *spineSkeleton = skeleton->GetSkeleton();
+		if (!atlas || !owner || !spineSkeleton) continue;
+		if (skeleton->Atlas != atlas) {
+			if (instance->RejectedAtlas.Get() != skeleton->Atlas) {
+				instance->RejectedAtlas = skeleton->Atlas;
+				UE_LOG(SpineLog, Warning, TEXT("%s is not drawn by the crowd %s, its atlas %s differs from the crowd's atlas %s."),
+					   *skeleton->GetPathName(), *GetPathName(), *GetNameSafe(skeleton->Atlas), *atlas->GetName());
+			}
+			continue;
+		}
+		instance->RejectedAtlas.Reset();
+
+		if (rebuildAll || instance->SpineSkeleton != spineSkeleton || instance->LastPoseVersion != spineSkeleton->getPoseVersion()) {
+			instance->SpineSkeleton = spineSkeleton;
+			instance->LastPoseVersion = spineSkeleton->getPoseVersion();
+			builtInstances.Add(instance.Get());
+		}
+
+		FTransform transform = skeleton->GetBaseTransform().GetRelativeTransform(crowdTransform);
+		if (!transform.Equals(instance->Transform, 0)) {
+			instance->Transform = transform;
+			changed = true;
+		}
+		drawnInstances.Add(instance.Get());
+	}
+	if (drawnInstances != lastDrawnInstances) {
+		lastDrawnInstances = drawnInstances;
+		changed = true;
+	}
+	if (!changed && builtInstances.Num() == 0) return;
+
+	// Each instance only reads its own skeleton and writes its own geometry.
+	ParallelFor(builtInstances.Num(), [this](int32 i) {
+		FSpineCrowdInstance &instance = *builtInstances[i];
+		instance.Geometry.Reset();
+		instance.Bounds.Init();
+		// The crowd's color tints each instance, the skeletons keep their own color.
+		BuildMesh(instance.SpineSkeleton, materialTable, DepthOffset, Color, instance.WorldVertices, instance.Clipper, instance.Geometry, instance.Bounds);
+	});
+	builtInstances.Reset();
+
+	// Sums up the geometry of each material over all instances, in the order the materials are first used.
+	FSpineMeshRenderData &data = BeginRenderData();
+	for (FSpineCrowdInstance *instance : drawnInstances) {
+		instance->Targets.Reset();
+		for (const FSpineMeshBatch &batch : instance->Geometry.Batches) {
+			int32 index = data.Batches.IndexOfByPredicate([&batch](const FSpineMeshBatch &merged) { return merged.Material == batch.Material; });
+			if (index == INDEX_NONE) {
+				index = data.Batches.Num();
+				data.Batches.AddDefaulted_GetRef().Material = batch.Material;
+			}
+			data.Batches[index].NumVertices += batch.NumVertices;
+			data.Batches[index].NumIndices += batch.NumIndices;
+			instance->Targets.AddDefaulted_GetRef().Batch = index;
+		}
+		if (instance->Bounds.IsValid) localBounds += instance->Bounds.TransformBy(instance->Transform);
+	}
+
+	int32 numVertices = 0, numIndices = 0;
+	for (FSpineMeshBatch &merged : data.Batches) {
+		merged.FirstVertex = numVertices;
+		merged.FirstIndex = numIndices;
+		numVertices += merged.NumVertices;
+		numIndices += merged.NumIndices;
+		merged.NumVertices = 0;
+		merged.NumIndices = 0;
+	}
+
+	// Places the instances one after the other within each merged batch, which restores the batch sizes.
+	for (FSpineCrowdInstance *instance : drawnInstances) {
+		for (int32 i = 0; i < instance->Targets.Num(); i++) {
+			const FSpineMeshBatch &batch = instance->Geometry.Batches[i];
+			FSpineCrowdTarget &target = instance->Targets[i];
+			FSpineMeshBatch &merged = data.Batches[target.Batch];
+			target.BaseVertex = merged.NumVertices;
+			target.FirstVertex = merged.FirstVertex + merged.NumVertices;
+			target.FirstIndex = merged.FirstIndex + merged.NumIndices;
+			merged.NumVertices += batch.NumVertices;
+			merged.NumIndices += batch.NumIndices;
+		}
+	}
+
+	data.Vertices.SetNumUninitialized(numVertices);
+	data.Indices.SetNumUninitialized(numIndices);
+	ParallelFor(drawnInstances.Num(), [this, &data](int32 i) { CopyInstance(*drawnInstances[i], data); });
+
+	SendRenderData();
+}
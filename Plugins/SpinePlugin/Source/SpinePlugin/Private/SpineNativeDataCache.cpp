@@ -0,0 +1,198 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpinePluginPrivatePCH.h"
+#include "Hash/CityHash.h"
+#include "spine/spine.h"
+
+using namespace spine;
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Native Cache Hits"), STAT_SpineNativeCacheHits, STATGROUP_Spine);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Native Cache Misses"), STAT_SpineNativeCacheMisses, STATGROUP_Spine);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Native Cache Entries"), STAT_SpineNativeCacheEntries, STATGROUP_Spine);
+DECLARE_MEMORY_STAT(TEXT("Native Cache Source Bytes"), STAT_SpineNativeCacheBytes, STATGROUP_Spine);
+DECLARE_CYCLE_STAT(TEXT("Native Data Parse"), STAT_SpineNativeDataParse, STATGROUP_Spine);
+
+FSpineNativeAtlas::~FSpineNativeAtlas() {
+	if (bCached) FSpineNativeDataCache::Get().RemoveAtlas(Key, Atlas, Bytes);
+	delete Atlas;
+}
+
+FSpineNativeSkeletonData::~FSpineNativeSkeletonData() {
+	if (bCached) FSpineNativeDataCache::Get().RemoveSkeletonData(Key, Bytes);
+	delete SkeletonData;
+}
+
+static bool IsSameAtlas(const FSpineNativeAtlasPtr &Atlas, const FString &RawData, const TArray<UTexture2D *> &Pages) {
+	return Atlas.IsValid() && Atlas->Pages == Pages && Atlas->Source.Equals(RawData, ESearchCase::CaseSensitive);
+}
+
+static bool IsSameSkeletonData(const FSpineNativeSkeletonDataPtr &SkeletonData, const TArray<uint8> &SourceData, uint32 Flags,
+							   const FSpineNativeAtlasPtr &Atlas) {
+	return SkeletonData.IsValid() && SkeletonData->Atlas == Atlas && SkeletonData->Flags == Flags &&
+		   SkeletonData->Source.Num() == SourceData.Num() &&
+		   FMemory::Memcmp(SkeletonData->Source.GetData(), SourceData.GetData(), SourceData.Num()) == 0;
+}
+
+FSpineNativeDataCache &FSpineNativeDataCache::Get() {
+	static FSpineNativeDataCache cache;
+	return cache;
+}
+
+FSpineNativeAtlasPtr FSpineNativeDataCache::FindOrAddAtlas(const FString &RawData, const TArray<UTexture2D *> &Pages) {
+	FTCHARToUTF8 utf8(*RawData);
+	uint64 key = CityHash64(utf8.Get(), utf8.Length());
+	for (UTexture2D *page : Pages) {
+		UPTRINT pointer = (UPTRINT) page;
+		key = CityHash64WithSeed((const char *) &pointer, sizeof(pointer), key);
+	}
+
+	{
+		FScopeLock scopeLock(&lock);
+		if (TWeakPtr<FSpineNativeAtlas, ESPMode::ThreadSafe> *entry = atlases.Find(key)) {
+			FSpineNativeAtlasPtr atlas = entry->Pin();
+			if (IsSameAtlas(atlas, RawData, Pages)) {
+				INC_DWORD_STAT(STAT_SpineNativeCacheHits);
+				return atlas;
+			}
+		}
+	}
+
+	// Parse outside of the lock, so unrelated assets can be parsed concurrently.
+	FSpineNativeAtlasPtr atlas = MakeShared<FSpineNativeAtlas, ESPMode::ThreadSafe>();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SpineNativeDataParse);
+		atlas->Atlas = new (__FILE__, __LINE__) Atlas(utf8.Get(), utf8.Length(), "", nullptr);
+	}
+	Vector<AtlasPage *> &pages = atlas->Atlas->getPages();
+	for (size_t i = 0, n = pages.size(), j = 0; i < n; i++) {
+		AtlasPage *page = pages[i];
+		if (Pages.Num() > 0 && Pages.Num() > (int32) i)
+			page->setRendererObject(Pages[j++]);
+	}
+	atlas->Source = RawData;
+	atlas->Pages = Pages;
+	atlas->Key = key;
+	atlas->Bytes = utf8.Length();
+
+	FScopeLock scopeLock(&lock);
+	if (TWeakPtr<FSpineNativeAtlas, ESPMode::ThreadSafe> *entry = atlases.Find(key)) {
+		FSpineNativeAtlasPtr existing = entry->Pin();
+		if (IsSameAtlas(existing, RawData, Pages)) {
+			INC_DWORD_STAT(STAT_SpineNativeCacheHits);
+			return existing;
+		}
+		// A live atlas with a colliding key keeps the entry, this one is owned by the caller alone.
+		if (existing.IsValid()) return atlas;
+	}
+	INC_DWORD_STAT(STAT_SpineNativeCacheMisses);
+	INC_DWORD_STAT(STAT_SpineNativeCacheEntries);
+	INC_MEMORY_STAT_BY(STAT_SpineNativeCacheBytes, atlas->Bytes);
+	atlas->bCached = true;
+	atlases.Add(key, atlas);
+	atlasesByNative.Add(atlas->Atlas, atlas);
+	return atlas;
+}
+
+FSpineNativeAtlasPtr FSpineNativeDataCache::FindAtlas(spine::Atlas *Atlas) {
+	FScopeLock scopeLock(&lock);
+	if (TWeakPtr<FSpineNativeAtlas, ESPMode::ThreadSafe> *entry = atlasesByNative.Find(Atlas)) return entry->Pin();
+	return FSpineNativeAtlasPtr();
+}
+
+FSpineNativeSkeletonDataPtr FSpineNativeDataCache::FindOrAddSkeletonData(const TArray<uint8> &SourceData, uint32 Flags, spine::Atlas *Atlas,
+																		 TFunctionRef<SkeletonData *()> Parse) {
+	FSpineNativeAtlasPtr atlas = FindAtlas(Atlas);
+	uint64 key = 0;
+	if (atlas.IsValid()) {
+		uint64 seed = CityHash64WithSeed((const char *) &Flags, sizeof(Flags), atlas->Key);
+		key = CityHash64WithSeed((const char *) SourceData.GetData(), SourceData.Num(), seed);
+
+		FScopeLock scopeLock(&lock);
+		if (TWeakPtr<FSpineNativeSkeletonData, ESPMode::ThreadSafe> *entry = skeletonDatas.Find(key)) {
+			FSpineNativeSkeletonDataPtr skeletonData = entry->Pin();
+			if (IsSameSkeletonData(skeletonData, SourceData, Flags, atlas)) {
+				INC_DWORD_STAT(STAT_SpineNativeCacheHits);
+				return skeletonData;
+			}
+		}
+	}
+
+	SkeletonData *parsed;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SpineNativeDataParse);
+		parsed = Parse();
+	}
+	if (!parsed) return FSpineNativeSkeletonDataPtr();
+
+	FSpineNativeSkeletonDataPtr skeletonData = MakeShared<FSpineNativeSkeletonData, ESPMode::ThreadSafe>();
+	skeletonData->SkeletonData = parsed;
+	skeletonData->Atlas = atlas;
+	skeletonData->Flags = Flags;
+	skeletonData->Key = key;
+	skeletonData->Bytes = SourceData.Num();
+	if (!atlas.IsValid()) return skeletonData;
+
+	FScopeLock scopeLock(&lock);
+	if (TWeakPtr<FSpineNativeSkeletonData, ESPMode::ThreadSafe> *entry = skeletonDatas.Find(key)) {
+		FSpineNativeSkeletonDataPtr existing = entry->Pin();
+		if (IsSameSkeletonData(existing, SourceData, Flags, atlas)) {
+			INC_DWORD_STAT(STAT_SpineNativeCacheHits);
+			return existing;
+		}
+		// Live skeleton data with a colliding key keeps the entry, this one is owned by the caller alone.
+		if (existing.IsValid()) return skeletonData;
+	}
+	INC_DWORD_STAT(STAT_SpineNativeCacheMisses);
+	INC_DWORD_STAT(STAT_SpineNativeCacheEntries);
+	INC_MEMORY_STAT_BY(STAT_SpineNativeCacheBytes, skeletonData->Bytes);
+	skeletonData->Source = SourceData;
+	skeletonData->bCached = true;
+	skeletonDatas.Add(key, skeletonData);
+	return skeletonData;
+}
+
+void FSpineNativeDataCache::RemoveAtlas(uint64 Key, spine::Atlas *Atlas, int32 Bytes) {
+	FScopeLock scopeLock(&lock);
+	// The entry may already have been replaced by a newer atlas with the same key.
+	TWeakPtr<FSpineNativeAtlas, ESPMode::ThreadSafe> *entry = atlases.Find(Key);
+	if (entry && !entry->IsValid()) atlases.Remove(Key);
+	entry = atlasesByNative.Find(Atlas);
+	if (entry && !entry->IsValid()) atlasesByNative.Remove(Atlas);
+	DEC_DWORD_STAT(STAT_SpineNativeCacheEntries);
+	DEC_MEMORY_STAT_BY(STAT_SpineNativeCacheBytes, Bytes);
+}
+
+void FSpineNativeDataCache::RemoveSkeletonData(uint64 Key, int32 Bytes) {
+	FScopeLock scopeLock(&lock);
+	TWeakPtr<FSpineNativeSkeletonData, ESPMode::ThreadSafe> *entry = skeletonDatas.Find(Key);
+	if (entry && !entry->IsValid()) skeletonDatas.Remove(Key);
+	DEC_DWORD_STAT(STAT_SpineNativeCacheEntries);
+	DEC_MEMORY_STAT_BY(STAT_SpineNativeCacheBytes, Bytes);
+}
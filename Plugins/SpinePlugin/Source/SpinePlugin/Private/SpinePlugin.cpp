@@ -29,6 +29,7 @@
 
 #include "SpinePluginPrivatePCH.h"
 #include "spine/Extension.h"
+#include "spine/Arena.h"
 
 DEFINE_LOG_CATEGORY(SpineLog);
 
@@ -70,5 +71,5 @@ public:
 };
 
 spine::SpineExtension *spine::getDefaultExtension() {
-	return new Ue4Extension();
+	return new spine::ArenaExtension(new Ue4Extension());
 }
@@ -27,12 +27,16 @@
  * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************/
 
+#include "SpineAnimationUpdateSubsystem.h"
 #include "SpineAtlasAsset.h"
 #include "SpineBoneDriverComponent.h"
 #include "SpineBoneFollowerComponent.h"
+#include "SpineCrowdComponent.h"
+#include "SpineNativeDataCache.h"
 #include "SpinePlugin.h"
 #include "SpineSkeletonAnimationComponent.h"
 #include "SpineSkeletonComponent.h"
 #include "SpineSkeletonDataAsset.h"
+#include "SpineSkeletonMeshComponent.h"
 #include "SpineSkeletonRendererComponent.h"
 #include "SpineWidget.h"
@@ -28,6 +28,8 @@
  *****************************************************************************/
 
 #include "SpinePluginPrivatePCH.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
 
 #define LOCTEXT_NAMESPACE "Spine"
 
@@ -35,38 +37,124 @@ using namespace spine;
 
 void UTrackEntry::SetTrackEntry(TrackEntry *trackEntry) {
 	this->entry = trackEntry;
+	handle = FSpineTrackEntryHandle(trackEntry);
 	if (entry) entry->setRendererObject((void *) this);
 }
 
+void UTrackEntry::Release() {
+	if (IsValidEntry() && entry->getRendererObject() == this) entry->setRendererObject(nullptr);
+	entry = nullptr;
+	handle = FSpineTrackEntryHandle();
+	AnimationStart.Clear();
+	AnimationInterrupt.Clear();
+	AnimationEvent.Clear();
+	AnimationComplete.Clear();
+	AnimationEnd.Clear();
+	AnimationDispose.Clear();
+}
+
 void callback(AnimationState *state, spine::EventType type, TrackEntry *entry, Event *event) {
 	USpineSkeletonAnimationComponent *component = (USpineSkeletonAnimationComponent *) state->getRendererObject();
+	component->HandleEvent(type, entry, event);
+}
+
+void USpineSkeletonAnimationComponent::HandleEvent(spine::EventType type, TrackEntry *trackEntry, Event *event) {
+	UTrackEntry *entry = (UTrackEntry *) trackEntry->getRendererObject();
+	if (!entry) {
+		// Entries set with the handle API get a wrapper only if the component's delegates need one. Workers can't create
+		// UObjects, BeginParallelUpdate obtains the wrappers before.
+		if (bQueueEvents || !HasAnimationDelegates()) return;
+		entry = ObtainTrackEntry(trackEntry);
+	}
+
+	FSpineEvent evt;
+	if (type == EventType_Event) evt.SetEvent(event);
+
+	if (bQueueEvents) {
+		FSpineQueuedEvent &queued = queuedEvents.AddDefaulted_GetRef();
+		queued.Type = type;
+		queued.Entry = entry;
+		queued.EntryId = entry->GetHandle().Id;
+		queued.Event = evt;
+	} else {
+		BroadcastEvent(type, entry, evt);
+	}
+}
+
+void USpineSkeletonAnimationComponent::BroadcastEvent(spine::EventType type, UTrackEntry *entry, const FSpineEvent &event) {
+	if (type == EventType_Start) {
+		AnimationStart.Broadcast(entry);
+		entry->AnimationStart.Broadcast(entry);
+	} else if (type == EventType_Interrupt) {
+		AnimationInterrupt.Broadcast(entry);
+		entry->AnimationInterrupt.Broadcast(entry);
+	} else if (type == EventType_Event) {
+		AnimationEvent.Broadcast(entry, event);
+		entry->AnimationEvent.Broadcast(entry, event);
+	} else if (type == EventType_Complete) {
+		AnimationComplete.Broadcast(entry);
+		entry->AnimationComplete.Broadcast(entry);
+	} else if (type == EventType_End) {
+		AnimationEnd.Broadcast(entry);
+		entry->AnimationEnd.Broadcast(entry);
+	} else if (type == EventType_Dispose) {
+		AnimationDispose.Broadcast(entry);
+		entry->AnimationDispose.Broadcast(entry);
+		entry->SetTrackEntry(nullptr);
+		GCTrackEntry(entry);
+	}
+}
+
+void USpineSkeletonAnimationComponent::GCTrackEntry(UTrackEntry *entry) {
+	if (trackEntries.Remove(entry) == 0) return;
+	// Released wrappers get a new handle when reused, so references kept by blueprints no longer match the entry id.
+	entry->Release();
+	trackEntryPool.Add(entry);
+}
+
+UTrackEntry *USpineSkeletonAnimationComponent::ObtainTrackEntry(TrackEntry *entry) {
+	if (entry->getRendererObject()) return (UTrackEntry *) entry->getRendererObject();
+	UTrackEntry *uEntry = trackEntryPool.Num() > 0 ? trackEntryPool.Pop(false) : NewObject<UTrackEntry>(this);
+	uEntry->SetTrackEntry(entry);
+	trackEntries.Add(uEntry);
+	return uEntry;
+}
+
+void USpineSkeletonAnimationComponent::ObtainTrackEntries() {
+	Vector<TrackEntry *> &tracks = state->getTracks();
+	for (size_t i = 0; i < tracks.size(); i++) {
+		TrackEntry *current = tracks[i];
+		for (TrackEntry *entry = current; entry; entry = entry->getNext())
+			ObtainTrackEntry(entry);
+		for (TrackEntry *entry = current ? current->getMixingFrom() : nullptr; entry; entry = entry->getMixingFrom())
+			ObtainTrackEntry(entry);
+	}
+}
+
+bool USpineSkeletonAnimationComponent::HasAnimationDelegates() const {
+	return AnimationStart.IsBound() || AnimationInterrupt.IsBound() || AnimationEvent.IsBound() || AnimationComplete.IsBound() ||
+		   AnimationEnd.IsBound() || AnimationDispose.IsBound();
+}
+
+UTrackEntry *USpineSkeletonAnimationComponent::GetInvalidTrackEntry() {
+	if (!invalidTrackEntry) invalidTrackEntry = NewObject<UTrackEntry>(this);
+	// Shared by all failed calls, delegates bound to it would never be broadcast.
+	invalidTrackEntry->Release();
+	return invalidTrackEntry;
+}
 
-	if (entry->getRendererObject()) {
-		UTrackEntry *uEntry = (UTrackEntry *) entry->getRendererObject();
-		if (type == EventType_Start) {
-			component->AnimationStart.Broadcast(uEntry);
-			uEntry->AnimationStart.Broadcast(uEntry);
-		} else if (type == EventType_Interrupt) {
-			component->AnimationInterrupt.Broadcast(uEntry);
-			uEntry->AnimationInterrupt.Broadcast(uEntry);
-		} else if (type == EventType_Event) {
-			FSpineEvent evt;
-			evt.SetEvent(event);
-			component->AnimationEvent.Broadcast(uEntry, evt);
-			uEntry->AnimationEvent.Broadcast(uEntry, evt);
-		} else if (type == EventType_Complete) {
-			component->AnimationComplete.Broadcast(uEntry);
-			uEntry->AnimationComplete.Broadcast(uEntry);
-		} else if (type == EventType_End) {
-			component->AnimationEnd.Broadcast(uEntry);
-			uEntry->AnimationEnd.Broadcast(uEntry);
-		} else if (type == EventType_Dispose) {
-			component->AnimationDispose.Broadcast(uEntry);
-			uEntry->AnimationDispose.Broadcast(uEntry);
-			uEntry->SetTrackEntry(nullptr);
-			component->GCTrackEntry(uEntry);
+void USpineSkeletonAnimationComponent::ReleaseTrackEntries() {
+	// The wrappers may already be destroyed when this component is.
+	if (!HasAnyFlags(RF_BeginDestroyed)) {
+		for (UTrackEntry *entry : trackEntries) {
+			if (!entry) continue;
+			entry->Release();
+			trackEntryPool.Add(entry);
 		}
+	} else {
+		trackEntryPool.Empty();
 	}
+	trackEntries.Empty();
 }
 
 USpineSkeletonAnimationComponent::USpineSkeletonAnimationComponent() {
@@ -78,15 +166,74 @@ USpineSkeletonAnimationComponent::USpineSkeletonAnimationComponent() {
 
 void USpineSkeletonAnimationComponent::BeginPlay() {
 	Super::BeginPlay();
-	trackEntries.Empty();
+	ReleaseTrackEntries();
 }
 
 void USpineSkeletonAnimationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
 	Super::Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// Once registered, the update subsystem updates this component before any component ticks.
+	bool registered = updateSubsystem.IsValid();
+	UWorld *world = GetWorld();
+	SetUpdateSubsystem(bUpdateInParallel && world && world->IsGameWorld() ? world->GetSubsystem<USpineAnimationUpdateSubsystem>() : nullptr);
+	if (registered && updateSubsystem.IsValid() && TickType != LEVELTICK_ViewportsOnly) return;
+
 	InternalTick(DeltaTime, true, TickType == LEVELTICK_ViewportsOnly);
 }
 
+void USpineSkeletonAnimationComponent::OnUnregister() {
+	SetUpdateSubsystem(nullptr);
+	Super::OnUnregister();
+}
+
+void USpineSkeletonAnimationComponent::SetUpdateSubsystem(USpineAnimationUpdateSubsystem *subsystem) {
+	if (updateSubsystem.Get() == subsystem) return;
+	if (USpineAnimationUpdateSubsystem *previous = updateSubsystem.Get()) previous->RemoveComponent(this);
+	if (subsystem) subsystem->AddComponent(this);
+	updateSubsystem = subsystem;
+}
+
+bool USpineSkeletonAnimationComponent::BeginParallelUpdate(float DeltaTime) {
+	CheckState();
+	if (!state || !bAutoPlaying) return false;
+
+	AActor *owner = GetOwner();
+	parallelDeltaTime = owner ? DeltaTime * owner->CustomTimeDilation : DeltaTime;
+	if (!UpdateAnimationLOD(parallelDeltaTime)) {
+		UpdateBoneFollowers();
+		return false;
+	}
+	if (HasAnimationDelegates()) ObtainTrackEntries();
+	bQueueEvents = true;
+	return true;
+}
+
+void USpineSkeletonAnimationComponent::UpdateAnimationStateParallel() {
+	if (!state) return;
+	state->update(parallelDeltaTime);
+	state->apply(*skeleton);
+}
+
+void USpineSkeletonAnimationComponent::BeforeParallelWorldTransform() {
+	bQueueEvents = false;
+	// Handlers may cause more events, these are broadcast right away.
+	TArray<FSpineQueuedEvent> events = MoveTemp(queuedEvents);
+	for (const FSpineQueuedEvent &queued : events) {
+		// A handler may have disposed the entry and its wrapper been reused for another, its remaining events are stale.
+		if (queued.Entry->GetHandle().Id != queued.EntryId) continue;
+		BroadcastEvent(queued.Type, queued.Entry, queued.Event);
+	}
+	if (skeleton) BeforeSkeletonWorldTransform(true);
+}
+
+void USpineSkeletonAnimationComponent::UpdateWorldTransformParallel() {
+	if (skeleton) skeleton->updateWorldTransform();
+}
+
+void USpineSkeletonAnimationComponent::AfterParallelWorldTransform() {
+	if (skeleton) AfterSkeletonWorldTransform(true);
+}
+
 void USpineSkeletonAnimationComponent::InternalTick(float DeltaTime, bool CallDelegates, bool Preview) {
 	CheckState();
 
@@ -105,15 +252,71 @@ void USpineSkeletonAnimationComponent::InternalTick(float DeltaTime, bool CallDe
 					SetSkin("default");
 				lastPreviewSkin = PreviewSkin;
 			}
+		} else if (!UpdateAnimationLOD(DeltaTime)) {
+			UpdateBoneFollowers();
+			return;
 		}
 		state->update(DeltaTime);
 		state->apply(*skeleton);
-		if (CallDelegates) BeforeUpdateWorldTransform.Broadcast(this);
-		skeleton->updateWorldTransform();
-		if (CallDelegates) AfterUpdateWorldTransform.Broadcast(this);
+		UpdateSkeletonWorldTransform(CallDelegates);
 	}
 }
 
+bool USpineSkeletonAnimationComponent::UpdateAnimationLOD(float &DeltaTime) {
+	UWorld *world = GetWorld();
+	if (!bUseAnimationLOD || !world || !world->IsGameWorld()) {
+		bLODSkipped = false;
+		return true;
+	}
+
+	lodSkippedTime += DeltaTime;
+	lodSkippedFrames++;
+	bLODSkipped = true;
+	lodSkippedPoseVersion = skeleton ? skeleton->getPoseVersion() : 0;
+	int32 interval = GetAnimationLODInterval();
+	if (interval <= 0) {
+		// Not updated until rendered again, so the time offscreen is dropped rather than applied as one huge step.
+		lodSkippedTime = 0;
+		lodSkippedFrames = 0;
+		return false;
+	}
+	if (lodSkippedFrames < interval) return false;
+
+	// The world's budget grants the components that are most overdue for their interval first.
+	USpineAnimationUpdateSubsystem *subsystem = world->GetSubsystem<USpineAnimationUpdateSubsystem>();
+	if (subsystem && !subsystem->ClaimUpdateBudget(this, (float) lodSkippedFrames / interval)) return false;
+	DeltaTime = lodSkippedTime;
+	lodSkippedTime = 0;
+	lodSkippedFrames = 0;
+	bLODSkipped = false;
+	return true;
+}
+
+int32 USpineSkeletonAnimationComponent::GetAnimationLODInterval() {
+	AActor *owner = GetOwner();
+	if (!owner) return 1;
+
+	UPrimitiveComponent *renderer = lodRenderer.Get();
+	if (!renderer) {
+		renderer = owner->FindComponentByClass<USpineSkeletonRendererComponent>();
+		if (!renderer) renderer = owner->FindComponentByClass<USpineSkeletonMeshComponent>();
+		lodRenderer = renderer;
+	}
+	if (renderer && !renderer->WasRecentlyRendered(0.2f)) return OffscreenUpdateInterval;
+
+	FVector location = renderer ? renderer->GetComponentLocation() : owner->GetActorLocation();
+	float distanceSquared = MAX_flt;
+	for (FConstPlayerControllerIterator iterator = GetWorld()->GetPlayerControllerIterator(); iterator; ++iterator) {
+		APlayerController *controller = iterator->Get();
+		if (controller && controller->PlayerCameraManager)
+			distanceSquared = FMath::Min(distanceSquared, FVector::DistSquared(location, controller->PlayerCameraManager->GetCameraLocation()));
+	}
+	if (distanceSquared == MAX_flt) return 1;
+	if (distanceSquared > FMath::Square(QuarterRateDistance)) return 4;
+	if (distanceSquared > FMath::Square(HalfRateDistance)) return 2;
+	return 1;
+}
+
 void USpineSkeletonAnimationComponent::CheckState() {
 	bool needsUpdate = lastAtlas != Atlas || lastData != SkeletonData;
 
@@ -133,37 +336,52 @@ void USpineSkeletonAnimationComponent::CheckState() {
 
 	if (needsUpdate) {
 		DisposeState();
+		if (!IsSkeletonDataReady()) return;
 
 		if (Atlas && SkeletonData) {
-			spine::SkeletonData *data = SkeletonData->GetSkeletonData(Atlas->GetAtlas());
-			if (data) {
-				skeleton = new (__FILE__, __LINE__) Skeleton(data);
-				AnimationStateData *stateData = SkeletonData->GetAnimationStateData(Atlas->GetAtlas());
-				state = new (__FILE__, __LINE__) AnimationState(stateData);
+			skeletonDataHandle = SkeletonData->GetSkeletonDataHandle(Atlas->GetAtlas());
+			if (skeletonDataHandle.IsValid()) {
+				skeleton = new (__FILE__, __LINE__) Skeleton(skeletonDataHandle->SkeletonData);
+				stateDataHandle = SkeletonData->GetAnimationStateDataHandle(Atlas->GetAtlas());
+				state = new (__FILE__, __LINE__) AnimationState(stateDataHandle.Get());
 				state->setRendererObject((void *) this);
 				state->setListener(callback);
-				trackEntries.Empty();
 			}
 		}
 
 		lastAtlas = Atlas;
 		lastSpineAtlas = Atlas ? Atlas->GetAtlas() : nullptr;
 		lastData = SkeletonData;
+		if (skeleton) SkeletonCreated.Broadcast(this);
 	}
 }
 
+bool USpineSkeletonAnimationComponent::IsAnimated() {
+	if (!state || !bAutoPlaying) return false;
+	Vector<TrackEntry *> &tracks = state->getTracks();
+	for (size_t i = 0; i < tracks.size(); i++) {
+		if (tracks[i]) return true;
+	}
+	return false;
+}
+
 void USpineSkeletonAnimationComponent::DisposeState() {
+	// Before the state is deleted, the wrappers clear the renderer object of their track entries.
+	ReleaseTrackEntries();
+	queuedEvents.Empty();
+
 	if (state) {
 		delete state;
 		state = nullptr;
 	}
+	stateDataHandle.Reset();
 
 	if (skeleton) {
 		delete skeleton;
 		skeleton = nullptr;
 	}
-
-	trackEntries.Empty();
+	skeletonDataHandle.Reset();
+	ResetBoneBindings();
 }
 
 void USpineSkeletonAnimationComponent::FinishDestroy() {
@@ -187,13 +405,7 @@ void USpineSkeletonAnimationComponent::SetPlaybackTime(float InPlaybackTime, boo
 		state->apply(*skeleton);
 
 		//Call delegates and perform the world transform
-		if (bCallDelegates) {
-			BeforeUpdateWorldTransform.Broadcast(this);
-		}
-		skeleton->updateWorldTransform();
-		if (bCallDelegates) {
-			AfterUpdateWorldTransform.Broadcast(this);
-		}
+		UpdateSkeletonWorldTransform(bCallDelegates);
 	}
 }
 
@@ -209,71 +421,76 @@ float USpineSkeletonAnimationComponent::GetTimeScale() {
 }
 
 UTrackEntry *USpineSkeletonAnimationComponent::SetAnimation(int trackIndex, FString animationName, bool loop) {
-	CheckState();
-	if (state && skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*animationName))) {
-		state->disableQueue();
-		TrackEntry *entry = state->setAnimation(trackIndex, TCHAR_TO_UTF8(*animationName), loop);
-		state->enableQueue();
-		UTrackEntry *uEntry = NewObject<UTrackEntry>();
-		uEntry->SetTrackEntry(entry);
-		trackEntries.Add(uEntry);
-		return uEntry;
-	} else
-		return NewObject<UTrackEntry>();
+	TrackEntry *entry = ResolveTrackEntry(SetAnimationHandle(trackIndex, animationName, loop));
+	return entry ? ObtainTrackEntry(entry) : GetInvalidTrackEntry();
 }
 
 UTrackEntry *USpineSkeletonAnimationComponent::AddAnimation(int trackIndex, FString animationName, bool loop, float delay) {
-	CheckState();
-	if (state && skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*animationName))) {
-		state->disableQueue();
-		TrackEntry *entry = state->addAnimation(trackIndex, TCHAR_TO_UTF8(*animationName), loop, delay);
-		state->enableQueue();
-		UTrackEntry *uEntry = NewObject<UTrackEntry>();
-		uEntry->SetTrackEntry(entry);
-		trackEntries.Add(uEntry);
-		return uEntry;
-	} else
-		return NewObject<UTrackEntry>();
+	TrackEntry *entry = ResolveTrackEntry(AddAnimationHandle(trackIndex, animationName, loop, delay));
+	return entry ? ObtainTrackEntry(entry) : GetInvalidTrackEntry();
 }
 
 UTrackEntry *USpineSkeletonAnimationComponent::SetEmptyAnimation(int trackIndex, float mixDuration) {
-	CheckState();
-	if (state) {
-		TrackEntry *entry = state->setEmptyAnimation(trackIndex, mixDuration);
-		UTrackEntry *uEntry = NewObject<UTrackEntry>();
-		uEntry->SetTrackEntry(entry);
-		trackEntries.Add(uEntry);
-		return uEntry;
-	} else
-		return NewObject<UTrackEntry>();
+	TrackEntry *entry = ResolveTrackEntry(SetEmptyAnimationHandle(trackIndex, mixDuration));
+	return entry ? ObtainTrackEntry(entry) : GetInvalidTrackEntry();
 }
 
 UTrackEntry *USpineSkeletonAnimationComponent::AddEmptyAnimation(int trackIndex, float mixDuration, float delay) {
-	CheckState();
-	if (state) {
-		TrackEntry *entry = state->addEmptyAnimation(trackIndex, mixDuration, delay);
-		UTrackEntry *uEntry = NewObject<UTrackEntry>();
-		uEntry->SetTrackEntry(entry);
-		trackEntries.Add(uEntry);
-		return uEntry;
-	} else
-		return NewObject<UTrackEntry>();
+	TrackEntry *entry = ResolveTrackEntry(AddEmptyAnimationHandle(trackIndex, mixDuration, delay));
+	return entry ? ObtainTrackEntry(entry) : GetInvalidTrackEntry();
 }
 
 UTrackEntry *USpineSkeletonAnimationComponent::GetCurrent(int trackIndex) {
 	CheckState();
-	if (state && state->getCurrent(trackIndex)) {
-		TrackEntry *entry = state->getCurrent(trackIndex);
-		if (entry->getRendererObject()) {
-			return (UTrackEntry *) entry->getRendererObject();
-		} else {
-			UTrackEntry *uEntry = NewObject<UTrackEntry>();
-			uEntry->SetTrackEntry(entry);
-			trackEntries.Add(uEntry);
-			return uEntry;
-		}
-	} else
-		return NewObject<UTrackEntry>();
+	TrackEntry *entry = state ? state->getCurrent(trackIndex) : nullptr;
+	return entry ? ObtainTrackEntry(entry) : GetInvalidTrackEntry();
+}
+
+FSpineTrackEntryHandle USpineSkeletonAnimationComponent::SetAnimationHandle(int TrackIndex, const FString &AnimationName, bool bLoop) {
+	CheckState();
+	spine::Animation *animation = state ? skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*AnimationName)) : nullptr;
+	if (!animation) return FSpineTrackEntryHandle();
+	state->disableQueue();
+	TrackEntry *entry = state->setAnimation(TrackIndex, animation, bLoop);
+	state->enableQueue();
+	return FSpineTrackEntryHandle(entry);
+}
+
+FSpineTrackEntryHandle USpineSkeletonAnimationComponent::AddAnimationHandle(int TrackIndex, const FString &AnimationName, bool bLoop, float Delay) {
+	CheckState();
+	spine::Animation *animation = state ? skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*AnimationName)) : nullptr;
+	if (!animation) return FSpineTrackEntryHandle();
+	state->disableQueue();
+	TrackEntry *entry = state->addAnimation(TrackIndex, animation, bLoop, Delay);
+	state->enableQueue();
+	return FSpineTrackEntryHandle(entry);
+}
+
+FSpineTrackEntryHandle USpineSkeletonAnimationComponent::SetEmptyAnimationHandle(int TrackIndex, float MixDuration) {
+	CheckState();
+	if (!state) return FSpineTrackEntryHandle();
+	return FSpineTrackEntryHandle(state->setEmptyAnimation(TrackIndex, MixDuration));
+}
+
+FSpineTrackEntryHandle USpineSkeletonAnimationComponent::AddEmptyAnimationHandle(int TrackIndex, float MixDuration, float Delay) {
+	CheckState();
+	if (!state) return FSpineTrackEntryHandle();
+	return FSpineTrackEntryHandle(state->addEmptyAnimation(TrackIndex, MixDuration, Delay));
+}
+
+FSpineTrackEntryHandle USpineSkeletonAnimationComponent::GetCurrentHandle(int TrackIndex) {
+	CheckState();
+	return FSpineTrackEntryHandle(state ? state->getCurrent(TrackIndex) : nullptr);
+}
+
+TrackEntry *USpineSkeletonAnimationComponent::ResolveTrackEntry(const FSpineTrackEntryHandle &Handle) {
+	if (!state || !Handle.IsSet() || Handle.TrackIndex < 0 || Handle.TrackIndex >= (int32) state->getTracks().size()) return nullptr;
+	TrackEntry *current = state->getCurrent(Handle.TrackIndex);
+	for (TrackEntry *entry = current; entry; entry = entry->getNext())
+		if (entry->getId() == Handle.Id) return entry;
+	for (TrackEntry *entry = current ? current->getMixingFrom() : nullptr; entry; entry = entry->getMixingFrom())
+		if (entry->getId() == Handle.Id) return entry;
+	return nullptr;
 }
 
 void USpineSkeletonAnimationComponent::ClearTracks() {
@@ -33,8 +33,44 @@
 
 #define LOCTEXT_NAMESPACE "Spine"
 
+DECLARE_CYCLE_STAT(TEXT("Bone Followers"), STAT_SpineBoneFollowers, STATGROUP_Spine);
+
 using namespace spine;
 
+static FTransform BoneToWorldTransform(Bone *bone, const FTransform &baseTransform) {
+	FMatrix localTransform;
+	localTransform.SetIdentity();
+	localTransform.SetAxis(2, FVector(bone->getA(), 0, bone->getC()));
+	localTransform.SetAxis(0, FVector(bone->getB(), 0, bone->getD()));
+	localTransform.SetOrigin(FVector(bone->getWorldX(), 0, bone->getWorldY()));
+	localTransform = localTransform * baseTransform.ToMatrixWithScale();
+
+	FTransform result;
+	result.SetFromMatrix(localTransform);
+	return result;
+}
+
+static void MoveBoneToWorldPosition(Bone *bone, const FVector &position, const FTransform &inverseBaseTransform) {
+	FVector localPosition = inverseBaseTransform.TransformPosition(position);
+	float localX = 0, localY = 0;
+	if (bone->getParent()) {
+		bone->getParent()->worldToLocal(localPosition.X, localPosition.Z, localX, localY);
+	} else {
+		bone->worldToLocal(localPosition.X, localPosition.Z, localX, localY);
+	}
+	bone->setX(localX);
+	bone->setY(localY);
+}
+
+template<typename T>
+static Bone *ResolveBone(Skeleton *skeleton, TSpineBoneBinding<T> &binding, const FString &boneName) {
+	if (!binding.Bone || !binding.BoneName.Equals(boneName, ESearchCase::CaseSensitive)) {
+		binding.BoneName = boneName;
+		binding.Bone = boneName.IsEmpty() ? nullptr : skeleton->findBone(TCHAR_TO_UTF8(*boneName));
+	}
+	return binding.Bone;
+}
+
 USpineSkeletonComponent::USpineSkeletonComponent() {
 	PrimaryComponentTick.bCanEverTick = true;
 	bTickInEditor = true;
@@ -106,30 +142,7 @@ FTransform USpineSkeletonComponent::GetBoneWorldTransform(const FString &BoneNam
 	if (skeleton) {
 		Bone *bone = skeleton->findBone(TCHAR_TO_UTF8(*BoneName));
 		if (!bone) return FTransform();
-
-		// Need to fetch the renderer component to get world transform of actor plus
-		// offset by renderer component and its parent component(s). If no renderer
-		// component is found, this components owner's transform is used as a fallback
-		FTransform baseTransform;
-		AActor *owner = GetOwner();
-		if (owner) {
-			USpineSkeletonRendererComponent *rendererComponent = static_cast<USpineSkeletonRendererComponent *>(owner->GetComponentByClass(USpineSkeletonRendererComponent::StaticClass()));
-			if (rendererComponent) baseTransform = rendererComponent->GetComponentTransform();
-			else
-				baseTransform = owner->GetActorTransform();
-		}
-
-		FVector position(bone->getWorldX(), 0, bone->getWorldY());
-		FMatrix localTransform;
-		localTransform.SetIdentity();
-		localTransform.SetAxis(2, FVector(bone->getA(), 0, bone->getC()));
-		localTransform.SetAxis(0, FVector(bone->getB(), 0, bone->getD()));
-		localTransform.SetOrigin(FVector(bone->getWorldX(), 0, bone->getWorldY()));
-		localTransform = localTransform * baseTransform.ToMatrixWithScale();
-
-		FTransform result;
-		result.SetFromMatrix(localTransform);
-		return result;
+		return BoneToWorldTransform(bone, GetBaseTransform());
 	}
 	return FTransform();
 }
@@ -139,29 +152,105 @@ void USpineSkeletonComponent::SetBoneWorldPosition(const FString &BoneName, cons
 	if (skeleton) {
 		Bone *bone = skeleton->findBone(TCHAR_TO_UTF8(*BoneName));
 		if (!bone) return;
+		MoveBoneToWorldPosition(bone, position, GetBaseTransform().Inverse());
+	}
+}
+
+FTransform USpineSkeletonComponent::GetBaseTransform() {
+	// Need to fetch the renderer component to get world transform of actor plus
+	// offset by renderer component and its parent component(s). If no renderer
+	// component is found, this components owner's transform is used as a fallback
+	AActor *owner = GetOwner();
+	if (!owner) return FTransform();
+	USpineSkeletonRendererComponent *rendererComponent = owner->FindComponentByClass<USpineSkeletonRendererComponent>();
+	return rendererComponent ? rendererComponent->GetComponentTransform() : owner->GetActorTransform();
+}
 
-		// Need to fetch the renderer component to get world transform of actor plus
-		// offset by renderer component and its parent component(s). If no renderer
-		// component is found, this components owner's transform is used as a fallback
-		FTransform baseTransform;
-		AActor *owner = GetOwner();
-		if (owner) {
-			USpineSkeletonRendererComponent *rendererComponent = static_cast<USpineSkeletonRendererComponent *>(owner->GetComponentByClass(USpineSkeletonRendererComponent::StaticClass()));
-			if (rendererComponent) baseTransform = rendererComponent->GetComponentTransform();
-			else
-				baseTransform = owner->GetActorTransform();
+void USpineSkeletonComponent::AddBoneFollower(USpineBoneFollowerComponent *Follower) {
+	for (const TSpineBoneBinding<USpineBoneFollowerComponent> &binding : boneFollowers)
+		if (binding.Component == Follower) return;
+	TSpineBoneBinding<USpineBoneFollowerComponent> binding;
+	binding.Component = Follower;
+	boneFollowers.Add(binding);
+}
+
+void USpineSkeletonComponent::RemoveBoneFollower(USpineBoneFollowerComponent *Follower) {
+	boneFollowers.RemoveAllSwap([Follower](const TSpineBoneBinding<USpineBoneFollowerComponent> &binding) { return binding.Component == Follower; });
+}
+
+void USpineSkeletonComponent::AddBoneDriver(USpineBoneDriverComponent *Driver) {
+	for (const TSpineBoneBinding<USpineBoneDriverComponent> &binding : boneDrivers)
+		if (binding.Component == Driver) return;
+	TSpineBoneBinding<USpineBoneDriverComponent> binding;
+	binding.Component = Driver;
+	boneDrivers.Add(binding);
+}
+
+void USpineSkeletonComponent::RemoveBoneDriver(USpineBoneDriverComponent *Driver) {
+	boneDrivers.RemoveAllSwap([Driver](const TSpineBoneBinding<USpineBoneDriverComponent> &binding) { return binding.Component == Driver; });
+}
+
+void USpineSkeletonComponent::UpdateSkeletonWorldTransform(bool CallDelegates) {
+	BeforeSkeletonWorldTransform(CallDelegates);
+	skeleton->updateWorldTransform();
+	AfterSkeletonWorldTransform(CallDelegates);
+}
+
+void USpineSkeletonComponent::BeforeSkeletonWorldTransform(bool CallDelegates) {
+	skeleton->setUsePoseBuffer(bUsePoseBuffer);
+	// An idle skeleton would otherwise get a new pose version, and its renderers rebuild, on every tick.
+	skeleton->setComparePoses(bComparePoses || !IsAnimated());
+	if (CallDelegates) {
+		UpdateBoneDrivers();
+		BeforeUpdateWorldTransform.Broadcast(this);
+	}
+}
+
+void USpineSkeletonComponent::AfterSkeletonWorldTransform(bool CallDelegates) {
+	if (CallDelegates) AfterUpdateWorldTransform.Broadcast(this);
+	UpdateBoneFollowers();
+}
+
+void USpineSkeletonComponent::UpdateBoneDrivers() {
+	if (!skeleton || boneDrivers.Num() == 0) return;
+	FTransform inverseBaseTransform = GetBaseTransform().Inverse();
+	for (int32 i = boneDrivers.Num() - 1; i >= 0; i--) {
+		// Moving a component may run gameplay code that removes bindings, so i is checked before each access.
+		if (i >= boneDrivers.Num()) continue;
+		USpineBoneDriverComponent *driver = boneDrivers[i].Component.Get();
+		if (!driver) {
+			boneDrivers.RemoveAtSwap(i);
+			continue;
 		}
+		Bone *bone = ResolveBone(skeleton, boneDrivers[i], driver->BoneName);
+		if (!bone) continue;
+		if (driver->UseComponentTransform) {
+			MoveBoneToWorldPosition(bone, driver->GetComponentLocation(), inverseBaseTransform);
+		} else if (AActor *owner = driver->GetOwner()) {
+			MoveBoneToWorldPosition(bone, owner->GetActorLocation(), inverseBaseTransform);
+		}
+	}
+}
+
+void USpineSkeletonComponent::ResetBoneBindings() {
+	for (TSpineBoneBinding<USpineBoneFollowerComponent> &binding : boneFollowers) binding.Bone = nullptr;
+	for (TSpineBoneBinding<USpineBoneDriverComponent> &binding : boneDrivers) binding.Bone = nullptr;
+}
 
-		baseTransform = baseTransform.Inverse();
-		FVector localPosition = baseTransform.TransformPosition(position);
-		float localX = 0, localY = 0;
-		if (bone->getParent()) {
-			bone->getParent()->worldToLocal(localPosition.X, localPosition.Z, localX, localY);
-		} else {
-			bone->worldToLocal(localPosition.X, localPosition.Z, localX, localY);
+void USpineSkeletonComponent::UpdateBoneFollowers() {
+	if (!skeleton || boneFollowers.Num() == 0) return;
+	SCOPE_CYCLE_COUNTER(STAT_SpineBoneFollowers);
+	FTransform baseTransform = GetBaseTransform();
+	for (int32 i = boneFollowers.Num() - 1; i >= 0; i--) {
+		// FollowBone moves the follower, whose overlap and transform events may remove followers.
+		if (i >= boneFollowers.Num()) continue;
+		USpineBoneFollowerComponent *follower = boneFollowers[i].Component.Get();
+		if (!follower) {
+			boneFollowers.RemoveAtSwap(i);
+			continue;
 		}
-		bone->setX(localX);
-		bone->setY(localY);
+		Bone *bone = ResolveBone(skeleton, boneFollowers[i], follower->BoneName);
+		if (bone) follower->FollowBone(BoneToWorldTransform(bone, baseTransform));
 	}
 }
 
@@ -249,6 +338,7 @@ void USpineSkeletonComponent::SetSlotColor(const FString SlotName, const FColor
 		Slot *slot = skeleton->findSlot(TCHAR_TO_UTF8(*SlotName));
 		if (slot) {
 			slot->getColor().set(color.R, color.B, color.G, color.A);
+			skeleton->incrementPoseVersion();
 		}
 	}
 }
@@ -293,11 +383,7 @@ void USpineSkeletonComponent::TickComponent(float DeltaTime, ELevelTick TickType
 void USpineSkeletonComponent::InternalTick(float DeltaTime, bool CallDelegates, bool Preview) {
 	CheckState();
 
-	if (skeleton) {
-		if (CallDelegates) BeforeUpdateWorldTransform.Broadcast(this);
-		skeleton->updateWorldTransform();
-		if (CallDelegates) AfterUpdateWorldTransform.Broadcast(this);
-	}
+	if (skeleton) UpdateSkeletonWorldTransform(CallDelegates);
 }
 
 void USpineSkeletonComponent::CheckState() {
@@ -319,23 +405,32 @@ void USpineSkeletonComponent::CheckState() {
 
 	if (needsUpdate) {
 		DisposeState();
+		if (!IsSkeletonDataReady()) return;
 
 		if (Atlas && SkeletonData) {
-			spine::SkeletonData *data = SkeletonData->GetSkeletonData(Atlas->GetAtlas());
-			skeleton = new (__FILE__, __LINE__) Skeleton(data);
+			skeletonDataHandle = SkeletonData->GetSkeletonDataHandle(Atlas->GetAtlas());
+			if (skeletonDataHandle.IsValid()) skeleton = new (__FILE__, __LINE__) Skeleton(skeletonDataHandle->SkeletonData);
 		}
 
 		lastAtlas = Atlas;
 		lastSpineAtlas = Atlas ? Atlas->GetAtlas() : nullptr;
 		lastData = SkeletonData;
+		if (skeleton) SkeletonCreated.Broadcast(this);
 	}
 }
 
+bool USpineSkeletonComponent::IsSkeletonDataReady() {
+	if (!bLoadAsync || !Atlas || !SkeletonData) return true;
+	return SkeletonData->LoadSkeletonDataAsync(Atlas->GetAtlas());
+}
+
 void USpineSkeletonComponent::DisposeState() {
 	if (skeleton) {
 		delete skeleton;
 		skeleton = nullptr;
 	}
+	ResetBoneBindings();
+	skeletonDataHandle.Reset();
 }
 
 void USpineSkeletonComponent::FinishDestroy() {
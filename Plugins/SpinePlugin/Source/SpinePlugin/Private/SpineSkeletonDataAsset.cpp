@@ -27,6 +27,9 @@
  * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************/
 
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Interfaces/ITargetPlatform.h"
 #include "Runtime/Core/Public/Misc/MessageDialog.h"
 #include "SpinePluginPrivatePCH.h"
 #include "spine/spine.h"
@@ -76,7 +79,15 @@ void USpineSkeletonDataAsset::GetAssetRegistryTags(TArray<FAssetRegistryTag> &Ou
 }
 
 void USpineSkeletonDataAsset::Serialize(FArchive &Ar) {
+	// Cooked packages keep only the data the asset is loaded from. Cooked data is native byte order, so a target with
+	// another byte order keeps the exported data.
+	bool strip = Ar.IsSaving() && Ar.IsCooking();
+	bool keepCooked = strip && UsesCookedData() && Ar.CookingTarget()->IsLittleEndian() == !!PLATFORM_LITTLE_ENDIAN;
+	TArray<uint8> stripped;
+	TArray<uint8> &unused = keepCooked ? rawData : cookedData;
+	if (strip) Swap(stripped, unused);
 	Super::Serialize(Ar);
+	if (strip) Swap(stripped, unused);
 	if (Ar.IsLoading() && Ar.UE4Ver() < VER_UE4_ASSET_IMPORT_DATA_AS_JSON && !importData)
 		importData = NewObject<UAssetImportData>(this, TEXT("AssetImportData"));
 	LoadInfo();
@@ -85,15 +96,13 @@ void USpineSkeletonDataAsset::Serialize(FArchive &Ar) {
 #endif
 
 void USpineSkeletonDataAsset::ClearNativeData() {
-	for (auto &pair : atlasToNativeData) {
-		if (pair.Value.skeletonData) delete pair.Value.skeletonData;
-		if (pair.Value.animationStateData) delete pair.Value.animationStateData;
-	}
+	// Animation states still using the data hold their own handles, so it is deleted once the last of them is.
 	atlasToNativeData.Empty();
 }
 
 void USpineSkeletonDataAsset::BeginDestroy() {
 	ClearNativeData();
+	decodedBakedAnimations.Empty();
 
 	Super::BeginDestroy();
 }
@@ -128,11 +137,22 @@ public:
 	}
 };
 
+// Decodes the animations of exported data on the task graph workers.
+class SP_API ParallelForRunner : public ParallelRunner {
+public:
+	virtual void run(int count, void (*job)(void *context, int index), void *context) {
+		ParallelFor(count, [job, context](int32 i) { job(context, i); });
+	}
+};
+
 void USpineSkeletonDataAsset::SetRawData(TArray<uint8> &Data) {
 	this->rawData.Empty();
 	this->rawData.Append(Data);
 
 	ClearNativeData();
+	rawDataVersion++;
+	pendingLoads.Empty();
+	failedLoads.Empty();
 
 	LoadInfo();
 }
@@ -162,13 +182,11 @@ static bool checkVersion(const char *version) {
 }
 
 static bool checkJson(const char *jsonData) {
-	Json json(jsonData);
-	Json *skeleton = Json::getItem(&json, "skeleton");
-	if (!skeleton) return false;
-	const char *version = Json::getString(skeleton, "spine", 0);
-	if (!version) return false;
+	// Exports write the skeleton object first, so this doesn't have to parse the document.
+	String version;
+	if (!Json::peekString(jsonData, "skeleton", "spine", version)) return false;
 
-	return checkVersion(version);
+	return checkVersion(version.buffer());
 }
 
 struct BinaryInput {
@@ -234,9 +252,12 @@ void USpineSkeletonDataAsset::LoadInfo() {
 	int dataLen = rawData.Num();
 	if (dataLen == 0) return;
 	NullAttachmentLoader loader;
+	ParallelForRunner runner;
 	SkeletonData *skeletonData = nullptr;
 	if (skeletonDataFileName.GetPlainNameString().Contains(TEXT(".json"))) {
 		SkeletonJson *json = new (__FILE__, __LINE__) SkeletonJson(&loader);
+		json->setUseArena(true);
+		json->setParallelRunner(&runner);
 		if (checkJson((const char *) rawData.GetData())) skeletonData = json->readSkeletonData((const char *) rawData.GetData());
 		if (!skeletonData) {
 			FMessageDialog::Debugf(FText::FromString(FString("Couldn't load skeleton data and/or atlas. Please ensure the version of your exported data matches your runtime version.\n\n") + skeletonDataFileName.GetPlainNameString() + FString("\n\n") + UTF8_TO_TCHAR(json->getError().buffer())));
@@ -245,6 +266,8 @@ void USpineSkeletonDataAsset::LoadInfo() {
 		delete json;
 	} else {
 		SkeletonBinary *binary = new (__FILE__, __LINE__) SkeletonBinary(&loader);
+		binary->setUseArena(true);
+		binary->setParallelRunner(&runner);
 		if (checkBinary((const char *) rawData.GetData(), (int) rawData.Num())) skeletonData = binary->readSkeletonData((const unsigned char *) rawData.GetData(), (int) rawData.Num());
 		if (!skeletonData) {
 			FMessageDialog::Debugf(FText::FromString(FString("Couldn't load skeleton data and/or atlas. Please ensure the version of your exported data matches your runtime version.\n\n") + skeletonDataFileName.GetPlainNameString() + FString("\n\n") + UTF8_TO_TCHAR(binary->getError().buffer())));
@@ -252,7 +275,12 @@ void USpineSkeletonDataAsset::LoadInfo() {
 		}
 		delete binary;
 	}
+	cookedData.Empty();
 	if (skeletonData) {
+		Vector<unsigned char> cooked;
+		SkeletonCooked::writeSkeletonData(*skeletonData, cooked);
+		cookedData.Append(cooked.buffer(), (int32) cooked.size());
+
 		Bones.Empty();
 		for (int i = 0; i < skeletonData->getBones().size(); i++)
 			Bones.Add(UTF8_TO_TCHAR(skeletonData->getBones()[i]->getName().buffer()));
@@ -274,45 +302,146 @@ void USpineSkeletonDataAsset::LoadInfo() {
 }
 
 SkeletonData *USpineSkeletonDataAsset::GetSkeletonData(Atlas *Atlas) {
+	FSpineNativeSkeletonDataPtr skeletonData = GetSkeletonDataHandle(Atlas);
+	return skeletonData.IsValid() ? skeletonData->SkeletonData : nullptr;
+}
+
+// The options parseSkeletonData reads the data with, so the native data cache doesn't share data parsed with others.
+static uint32 parseFlags(bool IsJson, bool UseArena, bool LazyAnimations, bool QuantizeCurves) {
+	return (IsJson ? 1 : 0) | (UseArena ? 2 : 0) | (LazyAnimations ? 4 : 0) | (QuantizeCurves ? 8 : 0);
+}
+
+static SkeletonData *parseSkeletonData(Atlas *Atlas, const TArray<uint8> &RawData, const TArray<uint8> &CookedData, bool IsJson, bool UseArena, bool LazyAnimations, bool QuantizeCurves, FString &Error) {
 	SkeletonData *skeletonData = nullptr;
-	AnimationStateData *animationStateData = nullptr;
-	if (atlasToNativeData.Contains(Atlas)) {
-		skeletonData = atlasToNativeData[Atlas].skeletonData;
-		animationStateData = atlasToNativeData[Atlas].animationStateData;
+	// Cooked data holds decoded animations with float curves, so lazily decoded animations and quantized curves are read
+	// from the exported binary.
+	bool lazy = LazyAnimations && !IsJson, quantize = QuantizeCurves && !IsJson;
+	if (!lazy && !quantize && SkeletonCooked::isCooked(CookedData.GetData(), CookedData.Num())) {
+		SkeletonCooked *cooked = new (__FILE__, __LINE__) SkeletonCooked(Atlas);
+		cooked->setUseArena(UseArena);
+		skeletonData = cooked->readSkeletonData(CookedData.GetData(), CookedData.Num());
+		if (!skeletonData) UE_LOG(SpineLog, Warning, TEXT("Couldn't load cooked skeleton data, parsing the exported data: %s"), UTF8_TO_TCHAR(cooked->getError().buffer()));
+		delete cooked;
+		if (skeletonData) return skeletonData;
+	}
+	if (RawData.Num() == 0) {
+		Error = TEXT("The cooked skeleton data can't be read and the exported data was not packaged.");
+		return nullptr;
 	}
 
-	if (!skeletonData) {
-		int dataLen = rawData.Num();
-		if (skeletonDataFileName.GetPlainNameString().Contains(TEXT(".json"))) {
-			SkeletonJson *json = new (__FILE__, __LINE__) SkeletonJson(Atlas);
-			if (checkJson((const char *) rawData.GetData())) skeletonData = json->readSkeletonData((const char *) rawData.GetData());
-			if (!skeletonData) {
-#if WITH_EDITORONLY_DATA
-				FMessageDialog::Debugf(FText::FromString(FString("Couldn't load skeleton data and/or atlas. Please ensure the version of your exported data matches your runtime version.\n\n") + skeletonDataFileName.GetPlainNameString() + FString("\n\n") + UTF8_TO_TCHAR(json->getError().buffer())));
-#endif
-				UE_LOG(SpineLog, Error, TEXT("Couldn't load skeleton data and atlas: %s"), UTF8_TO_TCHAR(json->getError().buffer()));
+	ParallelForRunner runner;
+	if (IsJson) {
+		SkeletonJson *json = new (__FILE__, __LINE__) SkeletonJson(Atlas);
+		json->setUseArena(UseArena);
+		json->setParallelRunner(&runner);
+		if (checkJson((const char *) RawData.GetData())) skeletonData = json->readSkeletonData((const char *) RawData.GetData());
+		if (!skeletonData) Error = UTF8_TO_TCHAR(json->getError().buffer());
+		delete json;
+	} else {
+		SkeletonBinary *binary = new (__FILE__, __LINE__) SkeletonBinary(Atlas);
+		binary->setUseArena(UseArena);
+		binary->setParallelRunner(&runner);
+		binary->setLazyAnimations(lazy);
+		binary->setQuantizeCurves(quantize);
+		if (checkBinary((const char *) RawData.GetData(), (int) RawData.Num())) skeletonData = binary->readSkeletonData((const unsigned char *) RawData.GetData(), (int) RawData.Num());
+		if (!skeletonData) Error = UTF8_TO_TCHAR(binary->getError().buffer());
+		delete binary;
+	}
+	return skeletonData;
+}
+
+FSpineNativeSkeletonDataPtr USpineSkeletonDataAsset::GetSkeletonDataHandle(Atlas *Atlas) {
+	if (NativeSkeletonData *nativeData = atlasToNativeData.Find(Atlas)) return nativeData->skeletonData;
+	if (failedLoads.Contains(Atlas)) return FSpineNativeSkeletonDataPtr();
+
+	bool isJson = IsJson();
+	FString error;
+	FSpineNativeSkeletonDataPtr skeletonData = FSpineNativeDataCache::Get().FindOrAddSkeletonData(GetSourceData(), parseFlags(isJson, bUseArena, bLazyAnimations, bQuantizeCurves), Atlas, [&]() {
+		return parseSkeletonData(Atlas, rawData, cookedData, isJson, bUseArena, bLazyAnimations, bQuantizeCurves, error);
+	});
+
+	if (skeletonData.IsValid()) AddNativeData(Atlas, skeletonData);
+	else
+		ReportLoadError(error);
+	return skeletonData;
+}
+
+bool USpineSkeletonDataAsset::LoadSkeletonDataAsync(Atlas *Atlas) {
+	if (atlasToNativeData.Contains(Atlas) || failedLoads.Contains(Atlas)) return true;
+	if (pendingLoads.Contains(Atlas)) return false;
+
+	// The worker parses against the atlas, so it has to hold a handle to it. Atlases that were not created
+	// through the native data cache have no handle and are loaded synchronously.
+	FSpineNativeAtlasPtr atlas = FSpineNativeDataCache::Get().FindAtlas(Atlas);
+	if (!atlas.IsValid()) {
+		GetSkeletonDataHandle(Atlas);
+		return true;
+	}
+
+	pendingLoads.Add(Atlas);
+	TWeakObjectPtr<USpineSkeletonDataAsset> weakThis(this);
+	TArray<uint8> data = rawData;
+	TArray<uint8> cooked = cookedData;
+	bool isJson = IsJson();
+	bool useArena = bUseArena;
+	bool lazyAnimations = bLazyAnimations;
+	bool quantizeCurves = bQuantizeCurves;
+	int32 version = rawDataVersion;
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [weakThis, atlas, data = MoveTemp(data), cooked = MoveTemp(cooked), isJson, useArena, lazyAnimations, quantizeCurves, version]() {
+		FString error;
+		FSpineNativeSkeletonDataPtr skeletonData = FSpineNativeDataCache::Get().FindOrAddSkeletonData(data.Num() > 0 ? data : cooked, parseFlags(isJson, useArena, lazyAnimations, quantizeCurves), atlas->Atlas, [&]() {
+			return parseSkeletonData(atlas->Atlas, data, cooked, isJson, useArena, lazyAnimations, quantizeCurves, error);
+		});
+
+		// Publish on the game thread, so components see either no data or the complete data.
+		AsyncTask(ENamedThreads::GameThread, [weakThis, atlas, skeletonData, error, version]() {
+			USpineSkeletonDataAsset *asset = weakThis.Get();
+			if (!asset) return;
+			asset->pendingLoads.Remove(atlas->Atlas);
+			if (asset->rawDataVersion != version || asset->atlasToNativeData.Contains(atlas->Atlas)) return;
+
+			if (skeletonData.IsValid()) asset->AddNativeData(atlas->Atlas, skeletonData);
+			else {
+				asset->failedLoads.Add(atlas->Atlas);
+				asset->ReportLoadError(error);
 			}
-			delete json;
-		} else {
-			SkeletonBinary *binary = new (__FILE__, __LINE__) SkeletonBinary(Atlas);
-			if (checkBinary((const char *) rawData.GetData(), (int) rawData.Num())) skeletonData = binary->readSkeletonData((const unsigned char *) rawData.GetData(), (int) rawData.Num());
-			if (!skeletonData) {
+		});
+	});
+	return false;
+}
+
+void USpineSkeletonDataAsset::AddNativeData(Atlas *Atlas, const FSpineNativeSkeletonDataPtr &SkeletonData) {
+	FSpineAnimationStateDataPtr animationStateData = MakeShareable(new (__FILE__, __LINE__) AnimationStateData(SkeletonData->SkeletonData));
+	SetMixes(animationStateData.Get());
+	if (AnimationCache *cache = SkeletonData->SkeletonData->getAnimationCache()) cache->setBudget((size_t) FMath::Max(AnimationBudgetKB, 0) * 1024);
+	atlasToNativeData.Add(Atlas, {SkeletonData, animationStateData});
+}
+
+void USpineSkeletonDataAsset::ReportLoadError(const FString &Error) {
 #if WITH_EDITORONLY_DATA
-				FMessageDialog::Debugf(FText::FromString(FString("Couldn't load skeleton data and/or atlas. Please ensure the version of your exported data matches your runtime version.\n\n") + skeletonDataFileName.GetPlainNameString() + FString("\n\n") + UTF8_TO_TCHAR(binary->getError().buffer())));
+	FMessageDialog::Debugf(FText::FromString(FString("Couldn't load skeleton data and/or atlas. Please ensure the version of your exported data matches your runtime version.\n\n") + skeletonDataFileName.GetPlainNameString() + FString("\n\n") + Error));
 #endif
-				UE_LOG(SpineLog, Error, TEXT("Couldn't load skeleton data and atlas: %s"), UTF8_TO_TCHAR(binary->getError().buffer()));
-			}
-			delete binary;
-		}
+	UE_LOG(SpineLog, Error, TEXT("Couldn't load skeleton data and atlas: %s"), *Error);
+}
 
-		if (skeletonData) {
-			animationStateData = new (__FILE__, __LINE__) AnimationStateData(skeletonData);
-			SetMixes(animationStateData);
-			atlasToNativeData.Add(Atlas, {skeletonData, animationStateData});
-		}
-	}
+bool USpineSkeletonDataAsset::IsJson() const {
+	return skeletonDataFileName.GetPlainNameString().Contains(TEXT(".json"));
+}
 
-	return skeletonData;
+bool USpineSkeletonDataAsset::UsesCookedData() const {
+	return SkeletonCooked::isCooked(cookedData.GetData(), cookedData.Num()) && (IsJson() || (!bLazyAnimations && !bQuantizeCurves));
+}
+
+const TArray<uint8> &USpineSkeletonDataAsset::GetSourceData() const {
+	return rawData.Num() > 0 ? rawData : cookedData;
+}
+
+void USpineSkeletonDataAsset::PostLoad() {
+	Super::PostLoad();
+	if (PreloadAtlas) {
+		PreloadAtlas->ConditionalPostLoad();
+		LoadSkeletonDataAsync(PreloadAtlas->GetAtlas());
+	}
 }
 
 void USpineSkeletonDataAsset::SetMixes(AnimationStateData *animationStateData) {
@@ -327,10 +456,14 @@ void USpineSkeletonDataAsset::SetMixes(AnimationStateData *animationStateData) {
 }
 
 AnimationStateData *USpineSkeletonDataAsset::GetAnimationStateData(Atlas *atlas) {
-	if (!atlasToNativeData.Contains(atlas)) return nullptr;
-	AnimationStateData *data = atlasToNativeData[atlas].animationStateData;
-	SetMixes(data);
-	return data;
+	return GetAnimationStateDataHandle(atlas).Get();
+}
+
+FSpineAnimationStateDataPtr USpineSkeletonDataAsset::GetAnimationStateDataHandle(Atlas *atlas) {
+	NativeSkeletonData *nativeData = atlasToNativeData.Find(atlas);
+	if (!nativeData) return FSpineAnimationStateDataPtr();
+	SetMixes(nativeData->animationStateData.Get());
+	return nativeData->animationStateData;
 }
 
 void USpineSkeletonDataAsset::SetMix(const FString &from, const FString &to, float mix) {
@@ -340,7 +473,7 @@ void USpineSkeletonDataAsset::SetMix(const FString &from, const FString &to, flo
 	data.Mix = mix;
 	this->MixData.Add(data);
 	for (auto &pair : atlasToNativeData) {
-		SetMixes(pair.Value.animationStateData);
+		SetMixes(pair.Value.animationStateData.Get());
 	}
 }
 
@@ -351,4 +484,77 @@ float USpineSkeletonDataAsset::GetMix(const FString &from, const FString &to) {
 	return 0;
 }
 
+FSpineBakedAnimationPtr USpineSkeletonDataAsset::GetBakedAnimation(const FString &Name) {
+	if (FSpineBakedAnimationPtr *decoded = decodedBakedAnimations.Find(Name)) return *decoded;
+
+	for (FSpineBakedAnimationData &data : BakedAnimations) {
+		if (!data.Name.Equals(Name)) continue;
+		FSpineBakedAnimationPtr baked(BakedAnimation::read(data.Data.GetData(), data.Data.Num()));
+		if (!baked.IsValid()) UE_LOG(SpineLog, Error, TEXT("Couldn't decode baked animation %s of %s, please bake it again."), *Name, *GetName());
+		decodedBakedAnimations.Add(Name, baked);
+		return baked;
+	}
+	return FSpineBakedAnimationPtr();
+}
+
+void USpineSkeletonDataAsset::BakeAnimations() {
+	USpineAtlasAsset *atlasAsset = BakeAtlas ? BakeAtlas : PreloadAtlas;
+	Atlas *atlas = atlasAsset ? atlasAsset->GetAtlas() : nullptr;
+	SkeletonData *skeletonData = atlas ? GetSkeletonData(atlas) : nullptr;
+	if (!skeletonData) {
+		UE_LOG(SpineLog, Error, TEXT("Couldn't bake the animations of %s, the bake atlas is not set or doesn't match the skeleton data."), *GetName());
+		return;
+	}
+
+	Skin *skin = nullptr;
+	if (!BakeSkin.IsEmpty()) {
+		skin = skeletonData->findSkin(TCHAR_TO_UTF8(*BakeSkin));
+		if (!skin) {
+			UE_LOG(SpineLog, Error, TEXT("Couldn't bake the animations of %s, skin %s doesn't exist."), *GetName(), *BakeSkin);
+			return;
+		}
+	}
+
+	Modify();
+	for (const FString &name : AnimationsToBake) {
+		// Retained, so the cache can't release the timelines while they are sampled.
+		Animation *animation = skeletonData->retainAnimation(TCHAR_TO_UTF8(*name));
+		BakedAnimation *baked = animation ? BakedAnimation::bake(*skeletonData, *animation, BakeFrameRate, skin) : nullptr;
+		if (animation) animation->release();
+		if (!baked) {
+			UE_LOG(SpineLog, Error, TEXT("Couldn't bake animation %s of %s."), *name, *GetName());
+			continue;
+		}
+
+		Vector<unsigned char> bytes;
+		baked->write(bytes);
+		FSpineBakedAnimationData *data = BakedAnimations.FindByPredicate([&name](const FSpineBakedAnimationData &existing) { return existing.Name.Equals(name); });
+		if (!data) {
+			data = &BakedAnimations.AddDefaulted_GetRef();
+			data->Name = name;
+		}
+		data->Data = TArray<uint8>(bytes.buffer(), (int32) bytes.size());
+		data->Bytes = data->Data.Num();
+
+		// Renderers still playing an earlier bake keep it alive through their handle.
+		decodedBakedAnimations.Add(name, FSpineBakedAnimationPtr(baked));
+	}
+	MarkPackageDirty();
+}
+
+void USpineSkeletonDataAsset::ReportAnimationMemory() {
+	if (atlasToNativeData.Num() == 0) UE_LOG(SpineLog, Display, TEXT("The skeleton data of %s is not loaded."), *GetName());
+	for (auto &pair : atlasToNativeData) {
+		SkeletonData *skeletonData = pair.Value.skeletonData->SkeletonData;
+		AnimationCache *cache = skeletonData->getAnimationCache();
+		if (!cache) {
+			UE_LOG(SpineLog, Display, TEXT("%s: all %d animations were decoded when the skeleton data was parsed."), *GetName(), (int32) skeletonData->getAnimations().size());
+			continue;
+		}
+		UE_LOG(SpineLog, Display, TEXT("%s: %d of %d animations decoded using about %.1f KB, budget %.1f KB, %.1f KB encoded, %d decodes, %d releases."), *GetName(),
+			   (int32) cache->getLoadedCount(), (int32) cache->getAnimationCount(), cache->getLoadedBytes() / 1024.0f, cache->getBudget() / 1024.0f,
+			   cache->getEncodedBytes() / 1024.0f, (int32) cache->getLoads(), (int32) cache->getReleases());
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,508 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpinePluginPrivatePCH.h"
+#include "Engine.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "LocalVertexFactory.h"
+#include "PrimitiveSceneProxy.h"
+#include "StaticMeshResources.h"
+#include "spine/spine.h"
+
+#define LOCTEXT_NAMESPACE "Spine"
+
+using namespace spine;
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mesh Upload Bytes"), STAT_SpineMeshUploadBytes, STATGROUP_Spine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mesh Draws"), STAT_SpineMeshDraws, STATGROUP_Spine);
+
+class FSpineSkeletonMeshSceneProxy final : public FPrimitiveSceneProxy {
+public:
+	FSpineSkeletonMeshSceneProxy(USpineSkeletonMeshComponent *Component, FSpineMeshRenderDataPtr InRenderData)
+		: FPrimitiveSceneProxy(Component),
+		  VertexFactory(GetScene().GetFeatureLevel(), "FSpineSkeletonMeshSceneProxy"),
+		  PendingRenderData(InRenderData),
+		  MaterialRelevance(Component->GetMaterialRelevance(GetScene().GetFeatureLevel())) {
+		// Texture coordinates 1 and 2 carry the dark color, all three need full precision.
+		VertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(true);
+	}
+
+	virtual ~FSpineSkeletonMeshSceneProxy() {
+		ReleaseBuffers();
+	}
+
+	virtual SIZE_T GetTypeHash() const override {
+		static size_t UniquePointer;
+		return reinterpret_cast<size_t>(&UniquePointer);
+	}
+
+	virtual void CreateRenderThreadResources() override {
+		// Render data sent after the proxy was created may already have been uploaded.
+		if (PendingRenderData.IsValid()) UpdateBuffers_RenderThread(*PendingRenderData);
+		PendingRenderData.Reset();
+	}
+
+	void SetRenderData_RenderThread(FSpineMeshRenderDataPtr InRenderData) {
+		check(IsInRenderingThread());
+		PendingRenderData.Reset();
+		UpdateBuffers_RenderThread(*InRenderData);
+	}
+
+	virtual void GetDynamicMeshElements(const TArray<const FSceneView *> &Views, const FSceneViewFamily &ViewFamily,
+										uint32 VisibilityMap, FMeshElementCollector &Collector) const override {
+		if (VertexCapacity == 0) return;
+
+		// Every view draws from the same buffers, nothing is copied here.
+		for (int32 viewIndex = 0; viewIndex < Views.Num(); viewIndex++) {
+			if (!(VisibilityMap & (1 << viewIndex))) continue;
+
+			for (const FSpineMeshBatch &batch : Batches) {
+				if (batch.NumIndices == 0 || !batch.Material) continue;
+
+				FMeshBatch &mesh = Collector.AllocateMesh();
+				mesh.VertexFactory = &VertexFactory;
+				mesh.MaterialRenderProxy = batch.Material;
+				mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+				mesh.bDisableBackfaceCulling = true;
+				mesh.Type = PT_TriangleList;
+				mesh.DepthPriorityGroup = SDPG_World;
+				mesh.bCanApplyViewModeOverrides = false;
+
+				FMeshBatchElement &element = mesh.Elements[0];
+				element.IndexBuffer = &IndexBuffer;
+				element.PrimitiveUniformBuffer = GetUniformBuffer();
+				element.FirstIndex = batch.FirstIndex;
+				element.NumPrimitives = batch.NumIndices / 3;
+				element.MinVertexIndex = batch.FirstVertex;
+				element.MaxVertexIndex = batch.FirstVertex + batch.NumVertices - 1;
+
+				Collector.AddMesh(viewIndex, mesh);
+				INC_DWORD_STAT(STAT_SpineMeshDraws);
+			}
+		}
+	}
+
+	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView *View) const override {
+		FPrimitiveViewRelevance Result;
+		Result.bDrawRelevance = IsShown(View);
+		Result.bShadowRelevance = IsShadowCast(View);
+		Result.bDynamicRelevance = true;
+		Result.bRenderInMainPass = ShouldRenderInMainPass();
+		Result.bUsesLightingChannels = GetLightingChannelMask() != GetDefaultLightingChannelMask();
+		Result.bRenderCustomDepth = ShouldRenderCustomDepth();
+		Result.bTranslucentSelfShadow = bCastVolumetricTranslucentShadow;
+		MaterialRelevance.SetPrimitiveViewRelevance(Result);
+		Result.bVelocityRelevance = IsMovable() && Result.bOpaque && Result.bRenderInMainPass;
+		return Result;
+	}
+
+	virtual bool CanBeOccluded() const override {
+		return !MaterialRelevance.bDisableDepthTest;
+	}
+
+	virtual uint32 GetMemoryFootprint() const override {
+		return sizeof(*this) + GetAllocatedSize();
+	}
+
+private:
+	/* Writes the render data into the buffers, which are only re-created when they have to grow. */
+	void UpdateBuffers_RenderThread(const FSpineMeshRenderData &Data) {
+		Batches = Data.Batches;
+
+		const int32 numVertices = Data.Vertices.Num();
+		const int32 numIndices = Data.Indices.Num();
+		if (numVertices == 0 || numIndices == 0) {
+			Batches.Reset();
+			return;
+		}
+
+		// Grows by half again, so an animation that shows more attachments over time does not re-create the buffers
+		// every frame.
+		if (numVertices > VertexCapacity || numIndices > IndexCapacity) {
+			ReleaseBuffers();
+			VertexCapacity = FMath::Max(numVertices, VertexCapacity + VertexCapacity / 2);
+			IndexCapacity = FMath::Max(numIndices, IndexCapacity + IndexCapacity / 2);
+			InitBuffers();
+		}
+
+		FPositionVertexBuffer &positions = VertexBuffers.PositionVertexBuffer;
+		FStaticMeshVertexBuffer &attributes = VertexBuffers.StaticMeshVertexBuffer;
+		FColorVertexBuffer &colors = VertexBuffers.ColorVertexBuffer;
+		for (int32 i = 0; i < numVertices; i++) {
+			const FDynamicMeshVertex &vertex = Data.Vertices[i];
+			positions.VertexPosition(i) = vertex.Position;
+			attributes.SetVertexTangents(i, vertex.TangentX.ToFVector(), vertex.GetTangentY(), vertex.TangentZ.ToFVector());
+			attributes.SetVertexUV(i, 0, vertex.TextureCoordinate[0]);
+			attributes.SetVertexUV(i, 1, vertex.TextureCoordinate[1]);
+			attributes.SetVertexUV(i, 2, vertex.TextureCoordinate[2]);
+			colors.VertexColor(i) = vertex.Color;
+		}
+
+		// The indices of a batch are relative to its first vertex, all batches share one vertex buffer here.
+		for (const FSpineMeshBatch &batch : Batches) {
+			const uint32 *source = Data.Indices.GetData() + batch.FirstIndex;
+			uint32 *target = IndexBuffer.Indices.GetData() + batch.FirstIndex;
+			for (int32 i = 0; i < batch.NumIndices; i++)
+				target[i] = batch.FirstVertex + source[i];
+		}
+
+		// Only the used part of each buffer is uploaded.
+		const uint32 tangentStride = attributes.GetTangentSize() / attributes.GetNumVertices();
+		const uint32 texCoordStride = attributes.GetTexCoordSize() / attributes.GetNumVertices();
+		UploadVertices(positions.VertexBufferRHI, positions.GetVertexData(), numVertices * positions.GetStride());
+		UploadVertices(attributes.TangentsVertexBuffer.VertexBufferRHI, attributes.GetTangentData(), numVertices * tangentStride);
+		UploadVertices(attributes.TexCoordVertexBuffer.VertexBufferRHI, attributes.GetTexCoordData(), numVertices * texCoordStride);
+		UploadVertices(colors.VertexBufferRHI, colors.GetVertexData(), numVertices * colors.GetStride());
+
+		const uint32 indexBytes = numIndices * sizeof(uint32);
+		void *indexData = RHILockIndexBuffer(IndexBuffer.IndexBufferRHI, 0, indexBytes, RLM_WriteOnly);
+		FMemory::Memcpy(indexData, IndexBuffer.Indices.GetData(), indexBytes);
+		RHIUnlockIndexBuffer(IndexBuffer.IndexBufferRHI);
+
+		INC_DWORD_STAT_BY(STAT_SpineMeshUploadBytes, numVertices * sizeof(FDynamicMeshVertex) + indexBytes);
+	}
+
+	static void UploadVertices(FRHIVertexBuffer *Buffer, const void *Source, uint32 Bytes) {
+		void *data = RHILockVertexBuffer(Buffer, 0, Bytes, RLM_WriteOnly);
+		FMemory::Memcpy(data, Source, Bytes);
+		RHIUnlockVertexBuffer(Buffer);
+	}
+
+	void InitBuffers() {
+		// The CPU copies are kept, each update writes them and uploads the used part.
+		VertexBuffers.PositionVertexBuffer.Init(VertexCapacity, true);
+		VertexBuffers.StaticMeshVertexBuffer.Init(VertexCapacity, 3, true);
+		VertexBuffers.ColorVertexBuffer.Init(VertexCapacity, true);
+		IndexBuffer.Indices.SetNumZeroed(IndexCapacity);
+
+		VertexBuffers.PositionVertexBuffer.InitResource();
+		VertexBuffers.StaticMeshVertexBuffer.InitResource();
+		VertexBuffers.ColorVertexBuffer.InitResource();
+		IndexBuffer.InitResource();
+
+		FLocalVertexFactory::FDataType data;
+		VertexBuffers.PositionVertexBuffer.BindPositionVertexBuffer(&VertexFactory, data);
+		VertexBuffers.StaticMeshVertexBuffer.BindTangentVertexBuffer(&VertexFactory, data);
+		VertexBuffers.StaticMeshVertexBuffer.BindPackedTexCoordVertexBuffer(&VertexFactory, data);
+		VertexBuffers.StaticMeshVertexBuffer.BindLightMapVertexBuffer(&VertexFactory, data, 0);
+		VertexBuffers.ColorVertexBuffer.BindColorVertexBuffer(&VertexFactory, data);
+		VertexFactory.SetData(data);
+		VertexFactory.InitResource();
+	}
+
+	void ReleaseBuffers() {
+		if (VertexCapacity == 0) return;
+		VertexFactory.ReleaseResource();
+		VertexBuffers.PositionVertexBuffer.ReleaseResource();
+		VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
+		VertexBuffers.ColorVertexBuffer.ReleaseResource();
+		IndexBuffer.ReleaseResource();
+	}
+
+	FStaticMeshVertexBuffers VertexBuffers;
+	FDynamicMeshIndexBuffer32 IndexBuffer;
+	FLocalVertexFactory VertexFactory;
+	int32 VertexCapacity = 0;
+	int32 IndexCapacity = 0;
+	TArray<FSpineMeshBatch> Batches;
+	/* The render data the proxy was created with, uploaded once its render thread resources are created. */
+	FSpineMeshRenderDataPtr PendingRenderData;
+	FMaterialRelevance MaterialRelevance;
+};
+
+USpineSkeletonMeshComponent::USpineSkeletonMeshComponent(const FObjectInitializer &ObjectInitializer)
+	: UMeshComponent(ObjectInitializer) {
+	PrimaryComponentTick.bCanEverTick = true;
+	bTickInEditor = true;
+	bAutoActivate = true;
+
+	static ConstructorHelpers::FObjectFinder<UMaterialInterface> NormalMaterialRef(TEXT("/SpinePlugin/SpineUnlitNormalMaterial"));
+	NormalBlendMaterial = NormalMaterialRef.Object;
+
+	static ConstructorHelpers::FObjectFinder<UMaterialInterface> AdditiveMaterialRef(TEXT("/SpinePlugin/SpineUnlitAdditiveMaterial"));
+	AdditiveBlendMaterial = AdditiveMaterialRef.Object;
+
+	static ConstructorHelpers::FObjectFinder<UMaterialInterface> MultiplyMaterialRef(TEXT("/SpinePlugin/SpineUnlitMultiplyMaterial"));
+	MultiplyBlendMaterial = MultiplyMaterialRef.Object;
+
+	static ConstructorHelpers::FObjectFinder<UMaterialInterface> ScreenMaterialRef(TEXT("/SpinePlugin/SpineUnlitScreenMaterial"));
+	ScreenBlendMaterial = ScreenMaterialRef.Object;
+
+	TextureParameterName = FName(TEXT("SpriteTexture"));
+
+	worldVertices.ensureCapacity(1024 * 2);
+	localBounds.Init();
+}
+
+void USpineSkeletonMeshComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	AActor *owner = GetOwner();
+	if (owner) {
+		UClass *skeletonClass = USpineSkeletonComponent::StaticClass();
+		USpineSkeletonComponent *skeleton = Cast<USpineSkeletonComponent>(owner->GetComponentByClass(skeletonClass));
+
+		// The pose has not changed in frames the animation LOD skipped.
+		USpineSkeletonAnimationComponent *animation = Cast<USpineSkeletonAnimationComponent>(skeleton);
+		if (animation && animation->WasSkippedByAnimationLOD() && Color == lastColor && DepthOffset == lastDepthOffset) return;
+
+		UpdateRenderer(skeleton);
+	}
+}
+
+void USpineSkeletonMeshComponent::UpdateRenderer(USpineSkeletonComponent *skeleton) {
+	if (skeleton && !skeleton->IsBeingDestroyed() && skeleton->GetSkeleton() && skeleton->Atlas) {
+		skeleton->GetSkeleton()->getColor().set(Color.R, Color.G, Color.B, Color.A);
+
+		UMaterialInterface *parents[] = {NormalBlendMaterial, AdditiveBlendMaterial, MultiplyBlendMaterial, ScreenBlendMaterial};
+		TArray<UMaterialInstanceDynamic *> *instances[] = {&atlasNormalBlendMaterials, &atlasAdditiveBlendMaterials,
+															&atlasMultiplyBlendMaterials, &atlasScreenBlendMaterials};
+		bool materialsChanged = materialTable.Update(this, skeleton->Atlas, TextureParameterName, parents, instances);
+
+		// The scene proxy caches the material relevance, so it has to be re-created when the materials change.
+		if (materialsChanged) MarkRenderStateDirty();
+		if (NeedsMeshUpdate(skeleton->GetSkeleton()) || materialsChanged) UpdateMesh(skeleton->GetSkeleton());
+	} else if (lastPoseVersion != 0) {
+		BeginRenderData();
+		SendRenderData();
+		lastPoseVersion = 0;
+	}
+}
+
+bool USpineSkeletonMeshComponent::NeedsMeshUpdate(Skeleton *Skeleton) {
+	bool needsUpdate = Skeleton->getPoseVersion() != lastPoseVersion || Color != lastColor || DepthOffset != lastDepthOffset;
+	lastPoseVersion = Skeleton->getPoseVersion();
+	lastColor = Color;
+	lastDepthOffset = DepthOffset;
+	return needsUpdate;
+}
+
+FSpineMeshRenderData &USpineSkeletonMeshComponent::BeginRenderData() {
+	// The buffer sent before the current one is free again once the render thread has replaced it.
+	int32 next = 1 - renderDataIndex;
+	if (!renderData[next].IsValid() || !renderData[next].IsUnique())
+		renderData[next] = MakeShared<FSpineMeshRenderData, ESPMode::ThreadSafe>();
+	renderData[next]->Reset();
+	localBounds.Init();
+	return *renderData[next];
+}
+
+void USpineSkeletonMeshComponent::SendRenderData() {
+	renderDataIndex = 1 - renderDataIndex;
+
+	UpdateBounds();
+	MarkRenderTransformDirty();
+
+	FSpineSkeletonMeshSceneProxy *proxy = (FSpineSkeletonMeshSceneProxy *) SceneProxy;
+	if (proxy) {
+		FSpineMeshRenderDataPtr data = renderData[renderDataIndex];
+		ENQUEUE_RENDER_COMMAND(SpineSkeletonMeshSetRenderData)
+		([proxy, data](FRHICommandListImmediate &RHICmdList) {
+			proxy->SetRenderData_RenderThread(data);
+		});
+	}
+}
+
+void USpineSkeletonMeshComponent::UpdateMesh(Skeleton *Skeleton) {
+	FSpineMeshRenderData &data = BeginRenderData();
+	BuildMesh(Skeleton, materialTable, DepthOffset, FLinearColor::White, worldVertices, clipper, data, localBounds);
+	SendRenderData();
+}
+
+void USpineSkeletonMeshComponent::BuildMesh(Skeleton *Skeleton, const FSpineMaterialTable &MaterialTable, float SlotDepthOffset,
+											 const FLinearColor &Tint, Vector<float> &WorldVertices, SkeletonClipping &Clipper,
+											 FSpineMeshRenderData &Data, FBox &Bounds) {
+	// Early out if skeleton is invisible
+	if (Skeleton->getColor().a * Tint.A == 0) return;
+
+	int idx = 0;
+	UMaterialInstanceDynamic *lastMaterial = nullptr;
+	float depthOffset = 0;
+	unsigned short quadIndices[] = {0, 1, 2, 0, 2, 3};
+
+	for (size_t i = 0; i < Skeleton->getSlots().size(); ++i) {
+		Vector<float> *attachmentVertices = &WorldVertices;
+		unsigned short *attachmentIndices = nullptr;
+		int numVertices;
+		int numIndices;
+		AtlasRegion *attachmentAtlasRegion = nullptr;
+		spine::Color attachmentColor;
+		attachmentColor.set(1, 1, 1, 1);
+		float *attachmentUvs = nullptr;
+
+		Slot *slot = Skeleton->getDrawOrder()[i];
+		Attachment *attachment = slot->getAttachment();
+
+		if (slot->getColor().a == 0 || !slot->getBone().isActive()) {
+			Clipper.clipEnd(*slot);
+			continue;
+		}
+
+		if (!attachment) {
+			Clipper.clipEnd(*slot);
+			continue;
+		}
+		if (!attachment->getRTTI().isExactly(RegionAttachment::rtti) && !attachment->getRTTI().isExactly(MeshAttachment::rtti) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+			Clipper.clipEnd(*slot);
+			continue;
+		}
+
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
+
+			// Early out if region is invisible
+			if (regionAttachment->getColor().a == 0) {
+				Clipper.clipEnd(*slot);
+				continue;
+			}
+
+			attachmentColor.set(regionAttachment->getColor());
+			attachmentAtlasRegion = (AtlasRegion *) regionAttachment->getRendererObject();
+			regionAttachment->computeWorldVertices(slot->getBone(), *attachmentVertices, 0, 2);
+			attachmentIndices = quadIndices;
+			attachmentUvs = regionAttachment->getUVs().buffer();
+			numVertices = 4;
+			numIndices = 6;
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = (MeshAttachment *) attachment;
+
+			// Early out if region is invisible
+			if (mesh->getColor().a == 0) {
+				Clipper.clipEnd(*slot);
+				continue;
+			}
+
+			attachmentColor.set(mesh->getColor());
+			attachmentAtlasRegion = (AtlasRegion *) mesh->getRendererObject();
+			mesh->computeWorldVertices(*slot, 0, mesh->getWorldVerticesLength(), *attachmentVertices, 0, 2);
+			attachmentIndices = mesh->getTriangles().buffer();
+			attachmentUvs = mesh->getUVs().buffer();
+			numVertices = mesh->getWorldVerticesLength() >> 1;
+			numIndices = mesh->getTriangles().size();
+		} else /* clipping */ {
+			ClippingAttachment *clip = (ClippingAttachment *) attachment;
+			Clipper.clipStart(*slot, clip);
+			continue;
+		}
+
+		// if the user switches the atlas data while not having switched
+		// to the correct skeleton data yet, we won't find any regions.
+		// ignore regions for which we can't find a material
+		UMaterialInstanceDynamic *material = MaterialTable.Find(attachmentAtlasRegion->page, slot->getData().getBlendMode());
+		if (!material) {
+			Clipper.clipEnd(*slot);
+			continue;
+		}
+
+		if (Clipper.isClipping()) {
+			Clipper.clipTriangles(attachmentVertices->buffer(), attachmentIndices, numIndices, attachmentUvs, 2);
+			attachmentVertices = &Clipper.getClippedVertices();
+			numVertices = Clipper.getClippedVertices().size() >> 1;
+			attachmentIndices = Clipper.getClippedTriangles().buffer();
+			numIndices = Clipper.getClippedTriangles().size();
+			attachmentUvs = Clipper.getClippedUVs().buffer();
+			if (Clipper.getClippedTriangles().size() == 0) {
+				Clipper.clipEnd(*slot);
+				continue;
+			}
+		}
+
+		if (lastMaterial != material) {
+			FSpineMeshBatch &batch = Data.Batches.AddDefaulted_GetRef();
+			batch.Material = material->GetRenderProxy();
+			batch.FirstVertex = Data.Vertices.Num();
+			batch.FirstIndex = Data.Indices.Num();
+			lastMaterial = material;
+			idx = 0;
+		}
+
+		uint8 r = static_cast<uint8>(Tint.R * Skeleton->getColor().r * slot->getColor().r * attachmentColor.r * 255);
+		uint8 g = static_cast<uint8>(Tint.G * Skeleton->getColor().g * slot->getColor().g * attachmentColor.g * 255);
+		uint8 b = static_cast<uint8>(Tint.B * Skeleton->getColor().b * slot->getColor().b * attachmentColor.b * 255);
+		uint8 a = static_cast<uint8>(Tint.A * Skeleton->getColor().a * slot->getColor().a * attachmentColor.a * 255);
+		FColor color(r, g, b, a);
+
+		float dr = slot->hasDarkColor() ? slot->getDarkColor().r : 0.0f;
+		float dg = slot->hasDarkColor() ? slot->getDarkColor().g : 0.0f;
+		float db = slot->hasDarkColor() ? slot->getDarkColor().b : 0.0f;
+
+		float *verticesPtr = attachmentVertices->buffer();
+		FVector normal = FVector(0, -1, 0);
+		if (numVertices > 2) {
+			int i0 = attachmentIndices[0] << 1, i1 = attachmentIndices[1] << 1, i2 = attachmentIndices[2] << 1;
+			FVector v0(verticesPtr[i0], 0, verticesPtr[i0 + 1]);
+			FVector v1(verticesPtr[i1], 0, verticesPtr[i1 + 1]);
+			FVector v2(verticesPtr[i2], 0, verticesPtr[i2 + 1]);
+			if (FVector::CrossProduct(v2 - v0, v1 - v0).Y > 0.f) normal.Y = 1;
+		}
+
+		for (int j = 0; j < numVertices << 1; j += 2) {
+			FDynamicMeshVertex &vertex = Data.Vertices.Emplace_GetRef(FVector(verticesPtr[j], depthOffset, verticesPtr[j + 1]),
+																	  FVector(1, 0, 0), normal,
+																	  FVector2D(attachmentUvs[j], attachmentUvs[j + 1]), color);
+			vertex.TextureCoordinate[1] = FVector2D(dr, dg);
+			vertex.TextureCoordinate[2] = FVector2D(db, 0);
+			Bounds += vertex.Position;
+		}
+
+		for (int j = 0; j < numIndices; j++) {
+			Data.Indices.Add(idx + attachmentIndices[j]);
+		}
+
+		FSpineMeshBatch &batch = Data.Batches.Last();
+		batch.NumVertices += numVertices;
+		batch.NumIndices += numIndices;
+
+		idx += numVertices;
+		depthOffset += SlotDepthOffset;
+
+		Clipper.clipEnd(*slot);
+	}
+
+	Clipper.clipEnd();
+}
+
+FPrimitiveSceneProxy *USpineSkeletonMeshComponent::CreateSceneProxy() {
+	return new FSpineSkeletonMeshSceneProxy(this, renderData[renderDataIndex]);
+}
+
+FBoxSphereBounds USpineSkeletonMeshComponent::CalcBounds(const FTransform &LocalToWorld) const {
+	if (!localBounds.IsValid) return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0);
+	return FBoxSphereBounds(localBounds).TransformBy(LocalToWorld);
+}
+
+void USpineSkeletonMeshComponent::GetUsedMaterials(TArray<UMaterialInterface *> &OutMaterials, bool bGetDebugMaterials) const {
+	Super::GetUsedMaterials(OutMaterials, bGetDebugMaterials);
+	OutMaterials.Append(atlasNormalBlendMaterials);
+	OutMaterials.Append(atlasAdditiveBlendMaterials);
+	OutMaterials.Append(atlasMultiplyBlendMaterials);
+	OutMaterials.Append(atlasScreenBlendMaterials);
+}
+
+#undef LOCTEXT_NAMESPACE
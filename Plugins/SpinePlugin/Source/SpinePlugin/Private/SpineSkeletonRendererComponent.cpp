@@ -70,120 +70,181 @@ void USpineSkeletonRendererComponent::BeginPlay() {
 void USpineSkeletonRendererComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	if (bPlayBakedAnimation) BakedAnimationTime += DeltaTime * BakedAnimationTimeScale;
+
 	AActor *owner = GetOwner();
 	if (owner) {
 		UClass *skeletonClass = USpineSkeletonComponent::StaticClass();
 		USpineSkeletonComponent *skeleton = Cast<USpineSkeletonComponent>(owner->GetComponentByClass(skeletonClass));
 
+		// The pose has not changed in frames the animation LOD skipped.
+		USpineSkeletonAnimationComponent *animation = Cast<USpineSkeletonAnimationComponent>(skeleton);
+		if (!bPlayBakedAnimation && animation && animation->WasSkippedByAnimationLOD() && Color == lastColor && DepthOffset == lastDepthOffset) return;
+
 		UpdateRenderer(skeleton);
 	}
 }
 
 void USpineSkeletonRendererComponent::UpdateRenderer(USpineSkeletonComponent *skeleton) {
+	if (bPlayBakedAnimation) {
+		UpdateBakedRenderer(skeleton);
+		return;
+	}
+	if (bakedAnimation.IsValid()) {
+		bakedAnimation.Reset();
+		bakedSkeletonData.Reset();
+		lastBakedFrame = -1;
+	}
+
 	if (skeleton && !skeleton->IsBeingDestroyed() && skeleton->GetSkeleton() && skeleton->Atlas) {
 		skeleton->GetSkeleton()->getColor().set(Color.R, Color.G, Color.B, Color.A);
 
-		if (atlasNormalBlendMaterials.Num() != skeleton->Atlas->atlasPages.Num()) {
-			atlasNormalBlendMaterials.SetNum(0);
-			pageToNormalBlendMaterial.Empty();
-			atlasAdditiveBlendMaterials.SetNum(0);
-			pageToAdditiveBlendMaterial.Empty();
-			atlasMultiplyBlendMaterials.SetNum(0);
-			pageToMultiplyBlendMaterial.Empty();
-			atlasScreenBlendMaterials.SetNum(0);
-			pageToScreenBlendMaterial.Empty();
-
-			for (int i = 0; i < skeleton->Atlas->atlasPages.Num(); i++) {
-				AtlasPage *currPage = skeleton->Atlas->GetAtlas()->getPages()[i];
-
-				UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(NormalBlendMaterial, this);
-				material->SetTextureParameterValue(TextureParameterName, skeleton->Atlas->atlasPages[i]);
-				atlasNormalBlendMaterials.Add(material);
-				pageToNormalBlendMaterial.Add(currPage, material);
-
-				material = UMaterialInstanceDynamic::Create(AdditiveBlendMaterial, this);
-				material->SetTextureParameterValue(TextureParameterName, skeleton->Atlas->atlasPages[i]);
-				atlasAdditiveBlendMaterials.Add(material);
-				pageToAdditiveBlendMaterial.Add(currPage, material);
-
-				material = UMaterialInstanceDynamic::Create(MultiplyBlendMaterial, this);
-				material->SetTextureParameterValue(TextureParameterName, skeleton->Atlas->atlasPages[i]);
-				atlasMultiplyBlendMaterials.Add(material);
-				pageToMultiplyBlendMaterial.Add(currPage, material);
-
-				material = UMaterialInstanceDynamic::Create(ScreenBlendMaterial, this);
-				material->SetTextureParameterValue(TextureParameterName, skeleton->Atlas->atlasPages[i]);
-				atlasScreenBlendMaterials.Add(material);
-				pageToScreenBlendMaterial.Add(currPage, material);
-			}
-		} else {
-			pageToNormalBlendMaterial.Empty();
-			pageToAdditiveBlendMaterial.Empty();
-			pageToMultiplyBlendMaterial.Empty();
-			pageToScreenBlendMaterial.Empty();
-
-			for (int i = 0; i < skeleton->Atlas->atlasPages.Num(); i++) {
-				AtlasPage *currPage = skeleton->Atlas->GetAtlas()->getPages()[i];
-				UTexture2D *texture = skeleton->Atlas->atlasPages[i];
-
-				UpdateRendererMaterial(currPage, texture, atlasNormalBlendMaterials[i], NormalBlendMaterial, pageToNormalBlendMaterial);
-				UpdateRendererMaterial(currPage, texture, atlasAdditiveBlendMaterials[i], AdditiveBlendMaterial, pageToAdditiveBlendMaterial);
-				UpdateRendererMaterial(currPage, texture, atlasMultiplyBlendMaterials[i], MultiplyBlendMaterial, pageToMultiplyBlendMaterial);
-				UpdateRendererMaterial(currPage, texture, atlasScreenBlendMaterials[i], ScreenBlendMaterial, pageToScreenBlendMaterial);
-			}
-		}
-		UpdateMesh(skeleton->GetSkeleton());
+		UMaterialInterface *parents[] = {NormalBlendMaterial, AdditiveBlendMaterial, MultiplyBlendMaterial, ScreenBlendMaterial};
+		TArray<UMaterialInstanceDynamic *> *instances[] = {&atlasNormalBlendMaterials, &atlasAdditiveBlendMaterials,
+															&atlasMultiplyBlendMaterials, &atlasScreenBlendMaterials};
+		bool materialsChanged = materialTable.Update(this, skeleton->Atlas, TextureParameterName, parents, instances);
+
+		if (NeedsMeshUpdate(skeleton->GetSkeleton()) || materialsChanged) UpdateMesh(skeleton->GetSkeleton());
 	} else {
-		ClearAllMeshSections();
+		ClearMeshSections(0);
+		lastPoseVersion = 0;
 	}
 }
 
-void USpineSkeletonRendererComponent::UpdateRendererMaterial(spine::AtlasPage *CurrentPage, UTexture2D *Texture,
-															 UMaterialInstanceDynamic *&CurrentInstance, UMaterialInterface *ParentMaterial,
-															 TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> &PageToBlendMaterial) {
+bool USpineSkeletonRendererComponent::NeedsMeshUpdate(Skeleton *Skeleton) {
+	bool needsUpdate = Skeleton->getPoseVersion() != lastPoseVersion || Color != lastColor || DepthOffset != lastDepthOffset ||
+					   bCreateCollision != bLastCreateCollision;
+	lastPoseVersion = Skeleton->getPoseVersion();
+	lastColor = Color;
+	lastDepthOffset = DepthOffset;
+	bLastCreateCollision = bCreateCollision;
+	return needsUpdate;
+}
 
-	UTexture *oldTexture = nullptr;
-	if (!CurrentInstance || !CurrentInstance->GetTextureParameterValue(TextureParameterName, oldTexture) ||
-		oldTexture != Texture || CurrentInstance->Parent != ParentMaterial) {
+void USpineSkeletonRendererComponent::UpdateBakedRenderer(USpineSkeletonComponent *skeleton) {
+	// The skeleton's pose is not used, a mesh built from it is rebuilt when playback stops.
+	lastPoseVersion = 0;
+
+	spine::Atlas *atlas = skeleton && !skeleton->IsBeingDestroyed() && skeleton->Atlas && skeleton->SkeletonData ? skeleton->Atlas->GetAtlas() : nullptr;
+	FSpineBakedAnimationPtr baked = atlas ? skeleton->SkeletonData->GetBakedAnimation(BakedAnimation) : FSpineBakedAnimationPtr();
+	FSpineNativeSkeletonDataPtr skeletonData = baked.IsValid() ? skeleton->SkeletonData->GetSkeletonDataHandle(atlas) : FSpineNativeSkeletonDataPtr();
+	if (!skeletonData.IsValid()) {
+		ClearMeshSections(0);
+		bakedAnimation.Reset();
+		bakedSkeletonData.Reset();
+		lastBakedFrame = -1;
+		return;
+	}
+
+	UMaterialInterface *parents[] = {NormalBlendMaterial, AdditiveBlendMaterial, MultiplyBlendMaterial, ScreenBlendMaterial};
+	TArray<UMaterialInstanceDynamic *> *instances[] = {&atlasNormalBlendMaterials, &atlasAdditiveBlendMaterials,
+														&atlasMultiplyBlendMaterials, &atlasScreenBlendMaterials};
+	bool materialsChanged = materialTable.Update(this, skeleton->Atlas, TextureParameterName, parents, instances);
+
+	// The attachments are looked up again when the animation is baked again or the skeleton data is re-imported.
+	if (baked != bakedAnimation || skeletonData != bakedSkeletonData) {
+		bakedAnimation = baked;
+		bakedSkeletonData = skeletonData;
+		baked->resolveAttachments(*skeletonData->SkeletonData, bakedAttachments);
+		lastBakedFrame = -1;
+	}
 
-		UMaterialInstanceDynamic *material = UMaterialInstanceDynamic::Create(ParentMaterial, this);
-		material->SetTextureParameterValue(TextureParameterName, Texture);
-		CurrentInstance = material;
+	int frame = baked->getFrame(BakedAnimationTime, bLoopBakedAnimation);
+	bool propertiesChanged = Color != lastColor || DepthOffset != lastDepthOffset || bCreateCollision != bLastCreateCollision;
+	lastColor = Color;
+	lastDepthOffset = DepthOffset;
+	bLastCreateCollision = bCreateCollision;
+	if (frame != lastBakedFrame || propertiesChanged || materialsChanged) {
+		lastBakedFrame = frame;
+		UpdateBakedMesh(frame);
 	}
-	PageToBlendMaterial.Add(CurrentPage, CurrentInstance);
 }
 
-void USpineSkeletonRendererComponent::Flush(int &Idx, TArray<FVector> &Vertices, TArray<int32> &Indices, TArray<FVector> &Normals, TArray<FVector2D> &Uvs, TArray<FColor> &Colors, TArray<FVector> &Colors2, UMaterialInstanceDynamic *Material) {
-	if (Vertices.Num() == 0) return;
+void USpineSkeletonRendererComponent::Flush(int &Idx, FSpineMeshSectionBuffers &Section, UMaterialInstanceDynamic *Material) {
+	if (Section.Vertices.Num() == 0) return;
 	SetMaterial(Idx, Material);
 
-	CreateMeshSection(Idx, Vertices, Indices, Normals, Uvs, Colors, TArray<FProcMeshTangent>(), bCreateCollision);
+	// Only re-create the section's buffers when its topology changed, otherwise update the vertex data in place.
+	if (Section.bCreated && Section.bCreatedCollision == bCreateCollision &&
+		Section.PreviousVertexCount == Section.Vertices.Num() && Section.PreviousIndices == Section.Indices) {
+		UpdateMeshSection(Idx, Section.Vertices, Section.Normals, Section.Uvs, Section.Colors, TArray<FProcMeshTangent>());
+	} else {
+		CreateMeshSection(Idx, Section.Vertices, Section.Indices, Section.Normals, Section.Uvs, Section.Colors, TArray<FProcMeshTangent>(), bCreateCollision);
+		Section.bCreated = true;
+		Section.bCreatedCollision = bCreateCollision;
+	}
 
-	Vertices.SetNum(0);
-	Indices.SetNum(0);
-	Normals.SetNum(0);
-	Uvs.SetNum(0);
-	Colors.SetNum(0);
-	Colors2.SetNum(0);
+	Swap(Section.Indices, Section.PreviousIndices);
+	Section.PreviousVertexCount = Section.Vertices.Num();
 	Idx++;
 }
 
-void USpineSkeletonRendererComponent::UpdateMesh(Skeleton *Skeleton) {
-	TArray<FVector> vertices;
-	TArray<int32> indices;
-	TArray<FVector> normals;
-	TArray<FVector2D> uvs;
-	TArray<FColor> colors;
-	TArray<FVector> darkColors;
+FSpineMeshSectionBuffers &USpineSkeletonRendererComponent::BeginMeshSection(int Idx) {
+	if (Idx >= meshSections.Num()) meshSections.SetNum(Idx + 1);
+	FSpineMeshSectionBuffers &section = meshSections[Idx];
+	section.Vertices.Reset();
+	section.Indices.Reset();
+	section.Normals.Reset();
+	section.Uvs.Reset();
+	section.Colors.Reset();
+	section.DarkColors.Reset();
+	return section;
+}
+
+void USpineSkeletonRendererComponent::ClearMeshSections(int FirstSection) {
+	for (int i = FirstSection; i < meshSections.Num(); i++) {
+		FSpineMeshSectionBuffers &section = meshSections[i];
+		if (!section.bCreated) continue;
+		ClearMeshSection(i);
+		section.bCreated = false;
+		section.PreviousIndices.Reset();
+		section.PreviousVertexCount = 0;
+	}
+}
 
+void USpineSkeletonRendererComponent::AddVertices(FSpineMeshSectionBuffers &Section, int &Idx, const float *Vertices, const float *Uvs, int NumVertices,
+													const unsigned short *Indices, int NumIndices, FColor VertexColor, FVector DarkColor, float Depth) {
+	TArray<FVector> &vertices = Section.Vertices;
+	TArray<int32> &indices = Section.Indices;
+	for (int j = 0; j < NumVertices << 1; j += 2) {
+		Section.Colors.Add(VertexColor);
+		Section.DarkColors.Add(DarkColor);
+		vertices.Add(FVector(Vertices[j], Depth, Vertices[j + 1]));
+		Section.Uvs.Add(FVector2D(Uvs[j], Uvs[j + 1]));
+	}
+
+	int firstIndex = indices.Num();
+	for (int j = 0; j < NumIndices; j++) {
+		indices.Add(Idx + Indices[j]);
+	}
+
+	FVector normal = FVector(0, -1, 0);
+	if (NumVertices > 2 &&
+		FVector::CrossProduct(
+				vertices[indices[firstIndex + 2]] - vertices[indices[firstIndex]],
+				vertices[indices[firstIndex + 1]] - vertices[indices[firstIndex]])
+						.Y > 0.f) {
+		normal.Y = 1;
+	}
+	for (int j = 0; j < NumVertices; j++) {
+		Section.Normals.Add(normal);
+	}
+
+	Idx += NumVertices;
+}
+
+void USpineSkeletonRendererComponent::UpdateMesh(Skeleton *Skeleton) {
 	int idx = 0;
 	int meshSection = 0;
 	UMaterialInstanceDynamic *lastMaterial = nullptr;
 
-	ClearAllMeshSections();
-
 	// Early out if skeleton is invisible
-	if (Skeleton->getColor().a == 0) return;
+	if (Skeleton->getColor().a == 0) {
+		ClearMeshSections(0);
+		return;
+	}
+
+	FSpineMeshSectionBuffers *section = &BeginMeshSection(meshSection);
 
 	float depthOffset = 0;
 	unsigned short quadIndices[] = {0, 1, 2, 0, 2, 3};
@@ -256,42 +317,10 @@ void USpineSkeletonRendererComponent::UpdateMesh(Skeleton *Skeleton) {
 		// if the user switches the atlas data while not having switched
 		// to the correct skeleton data yet, we won't find any regions.
 		// ignore regions for which we can't find a material
-		UMaterialInstanceDynamic *material = nullptr;
-		switch (slot->getData().getBlendMode()) {
-			case BlendMode_Normal:
-				if (!pageToNormalBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = pageToNormalBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			case BlendMode_Additive:
-				if (!pageToAdditiveBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = pageToAdditiveBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			case BlendMode_Multiply:
-				if (!pageToMultiplyBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = pageToMultiplyBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			case BlendMode_Screen:
-				if (!pageToScreenBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = pageToScreenBlendMaterial[attachmentAtlasRegion->page];
-				break;
-			default:
-				if (!pageToNormalBlendMaterial.Contains(attachmentAtlasRegion->page)) {
-					clipper.clipEnd(*slot);
-					continue;
-				}
-				material = pageToNormalBlendMaterial[attachmentAtlasRegion->page];
+		UMaterialInstanceDynamic *material = materialTable.Find(attachmentAtlasRegion->page, slot->getData().getBlendMode());
+		if (!material) {
+			clipper.clipEnd(*slot);
+			continue;
 		}
 
 		if (clipper.isClipping()) {
@@ -308,13 +337,14 @@ void USpineSkeletonRendererComponent::UpdateMesh(Skeleton *Skeleton) {
 		}
 
 		if (lastMaterial != material) {
-			Flush(meshSection, vertices, indices, normals, uvs, colors, darkColors, lastMaterial);
+			if (section->Vertices.Num() > 0) {
+				Flush(meshSection, *section, lastMaterial);
+				section = &BeginMeshSection(meshSection);
+			}
 			lastMaterial = material;
 			idx = 0;
 		}
 
-		SetMaterial(meshSection, material);
-
 		uint8 r = static_cast<uint8>(Skeleton->getColor().r * slot->getColor().r * attachmentColor.r * 255);
 		uint8 g = static_cast<uint8>(Skeleton->getColor().g * slot->getColor().g * attachmentColor.g * 255);
 		uint8 b = static_cast<uint8>(Skeleton->getColor().b * slot->getColor().b * attachmentColor.b * 255);
@@ -324,39 +354,92 @@ void USpineSkeletonRendererComponent::UpdateMesh(Skeleton *Skeleton) {
 		float dg = slot->hasDarkColor() ? slot->getDarkColor().g : 0.0f;
 		float db = slot->hasDarkColor() ? slot->getDarkColor().b : 0.0f;
 
-		float *verticesPtr = attachmentVertices->buffer();
-		for (int j = 0; j < numVertices << 1; j += 2) {
-			colors.Add(FColor(r, g, b, a));
-			darkColors.Add(FVector(dr, dg, db));
-			vertices.Add(FVector(verticesPtr[j], depthOffset, verticesPtr[j + 1]));
-			uvs.Add(FVector2D(attachmentUvs[j], attachmentUvs[j + 1]));
-		}
+		AddVertices(*section, idx, attachmentVertices->buffer(), attachmentUvs, numVertices, attachmentIndices, numIndices,
+					FColor(r, g, b, a), FVector(dr, dg, db), depthOffset);
+		depthOffset += this->DepthOffset;
 
-		int firstIndex = indices.Num();
-		for (int j = 0; j < numIndices; j++) {
-			indices.Add(idx + attachmentIndices[j]);
-		}
+		clipper.clipEnd(*slot);
+	}
+
+	Flush(meshSection, *section, lastMaterial);
+	ClearMeshSections(meshSection);
+	clipper.clipEnd();
+}
 
-		FVector normal = FVector(0, -1, 0);
-		if (numVertices > 2 &&
-			FVector::CrossProduct(
-					vertices[indices[firstIndex + 2]] - vertices[indices[firstIndex]],
-					vertices[indices[firstIndex + 1]] - vertices[indices[firstIndex]])
-							.Y > 0.f) {
-			normal.Y = 1;
+void USpineSkeletonRendererComponent::UpdateBakedMesh(int Frame) {
+	spine::BakedAnimation &baked = *bakedAnimation;
+	SkeletonData &skeletonData = *bakedSkeletonData->SkeletonData;
+	int idx = 0;
+	int meshSection = 0;
+	UMaterialInstanceDynamic *lastMaterial = nullptr;
+
+	// Early out if skeleton is invisible
+	if (Color.A == 0) {
+		ClearMeshSections(0);
+		return;
+	}
+
+	FSpineMeshSectionBuffers *section = &BeginMeshSection(meshSection);
+
+	float depthOffset = 0;
+	unsigned short quadIndices[] = {0, 1, 2, 0, 2, 3};
+
+	for (int i = 0, n = baked.getPartCount(Frame); i < n; i++) {
+		BakedPart &part = baked.getPart(Frame, i);
+		BakedAttachment &bakedAttachment = baked.getAttachments()[part.attachmentIndex];
+		Attachment *attachment = bakedAttachments[part.attachmentIndex];
+		if (!attachment) continue;
+
+		// Only region and mesh attachments are resolved.
+		AtlasRegion *attachmentAtlasRegion;
+		unsigned short *attachmentIndices;
+		int numIndices;
+		float *attachmentUvs;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
+			attachmentAtlasRegion = (AtlasRegion *) regionAttachment->getRendererObject();
+			attachmentIndices = quadIndices;
+			numIndices = 6;
+			attachmentUvs = regionAttachment->getUVs().buffer();
+		} else {
+			MeshAttachment *mesh = (MeshAttachment *) attachment;
+			attachmentAtlasRegion = (AtlasRegion *) mesh->getRendererObject();
+			attachmentIndices = mesh->getTriangles().buffer();
+			numIndices = mesh->getTriangles().size();
+			attachmentUvs = mesh->getUVs().buffer();
 		}
-		for (int j = 0; j < numVertices; j++) {
-			normals.Add(normal);
+
+		SlotData *slotData = skeletonData.getSlots()[bakedAttachment.slotIndex];
+		UMaterialInstanceDynamic *material = materialTable.Find(attachmentAtlasRegion->page, slotData->getBlendMode());
+		if (!material) continue;
+
+		if (lastMaterial != material) {
+			if (section->Vertices.Num() > 0) {
+				Flush(meshSection, *section, lastMaterial);
+				section = &BeginMeshSection(meshSection);
+			}
+			lastMaterial = material;
+			idx = 0;
 		}
 
-		idx += numVertices;
-		depthOffset += this->DepthOffset;
+		uint8 r = static_cast<uint8>(Color.R * (part.color >> 24));
+		uint8 g = static_cast<uint8>(Color.G * ((part.color >> 16) & 0xff));
+		uint8 b = static_cast<uint8>(Color.B * ((part.color >> 8) & 0xff));
+		uint8 a = static_cast<uint8>(Color.A * (part.color & 0xff));
 
-		clipper.clipEnd(*slot);
+		float dr = ((part.darkColor >> 16) & 0xff) / 255.0f;
+		float dg = ((part.darkColor >> 8) & 0xff) / 255.0f;
+		float db = (part.darkColor & 0xff) / 255.0f;
+
+		worldVertices.setSize(bakedAttachment.vertexCount << 1, 0);
+		baked.computeWorldVertices(part, worldVertices.buffer());
+		AddVertices(*section, idx, worldVertices.buffer(), attachmentUvs, bakedAttachment.vertexCount, attachmentIndices, numIndices,
+					FColor(r, g, b, a), FVector(dr, dg, db), depthOffset);
+		depthOffset += this->DepthOffset;
 	}
 
-	Flush(meshSection, vertices, indices, normals, uvs, colors, darkColors, lastMaterial);
-	clipper.clipEnd();
+	Flush(meshSection, *section, lastMaterial);
+	ClearMeshSections(meshSection);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -161,11 +161,11 @@ void USpineWidget::CheckState() {
 		DisposeState();
 
 		if (Atlas && SkeletonData) {
-			spine::SkeletonData *data = SkeletonData->GetSkeletonData(Atlas->GetAtlas());
-			if (data) {
-				skeleton = new (__FILE__, __LINE__) Skeleton(data);
-				AnimationStateData *stateData = SkeletonData->GetAnimationStateData(Atlas->GetAtlas());
-				state = new (__FILE__, __LINE__) AnimationState(stateData);
+			skeletonDataHandle = SkeletonData->GetSkeletonDataHandle(Atlas->GetAtlas());
+			if (skeletonDataHandle.IsValid()) {
+				skeleton = new (__FILE__, __LINE__) Skeleton(skeletonDataHandle->SkeletonData);
+				stateDataHandle = SkeletonData->GetAnimationStateDataHandle(Atlas->GetAtlas());
+				state = new (__FILE__, __LINE__) AnimationState(stateDataHandle.Get());
 				state->setRendererObject((void *) this);
 				state->setListener(callbackWidget);
 				trackEntries.Empty();
@@ -183,6 +183,7 @@ void USpineWidget::DisposeState() {
 		delete state;
 		state = nullptr;
 	}
+	stateDataHandle.Reset();
 
 	if (skeleton) {
 		delete skeleton;
@@ -193,6 +194,7 @@ void USpineWidget::DisposeState() {
 		delete customSkin;
 		customSkin = nullptr;
 	}
+	skeletonDataHandle.Reset();
 
 	trackEntries.Empty();
 }
@@ -409,9 +411,10 @@ float USpineWidget::GetTimeScale() {
 
 UTrackEntry *USpineWidget::SetAnimation(int trackIndex, FString animationName, bool loop) {
 	CheckState();
-	if (state && skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*animationName))) {
+	spine::Animation *animation = state ? skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*animationName)) : nullptr;
+	if (animation) {
 		state->disableQueue();
-		TrackEntry *entry = state->setAnimation(trackIndex, TCHAR_TO_UTF8(*animationName), loop);
+		TrackEntry *entry = state->setAnimation(trackIndex, animation, loop);
 		state->enableQueue();
 		UTrackEntry *uEntry = NewObject<UTrackEntry>();
 		uEntry->SetTrackEntry(entry);
@@ -423,9 +426,10 @@ UTrackEntry *USpineWidget::SetAnimation(int trackIndex, FString animationName, b
 
 UTrackEntry *USpineWidget::AddAnimation(int trackIndex, FString animationName, bool loop, float delay) {
 	CheckState();
-	if (state && skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*animationName))) {
+	spine::Animation *animation = state ? skeleton->getData()->findAnimation(TCHAR_TO_UTF8(*animationName)) : nullptr;
+	if (animation) {
 		state->disableQueue();
-		TrackEntry *entry = state->addAnimation(trackIndex, TCHAR_TO_UTF8(*animationName), loop, delay);
+		TrackEntry *entry = state->addAnimation(trackIndex, animation, loop, delay);
 		state->enableQueue();
 		UTrackEntry *uEntry = NewObject<UTrackEntry>();
 		uEntry->SetTrackEntry(entry);
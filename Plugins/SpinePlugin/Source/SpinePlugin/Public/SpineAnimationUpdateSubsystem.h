@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#pragma once
+
+// clang-format off
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpineAnimationUpdateSubsystem.generated.h"
+// clang-format on
+
+class USpineAnimationUpdateSubsystem;
+class USpineSkeletonAnimationComponent;
+
+/* Runs the animation update subsystem of a world in the pre physics tick group, before any component ticks. */
+struct FSpineAnimationUpdateTickFunction : public FTickFunction {
+	USpineAnimationUpdateSubsystem *Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef &MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+/* Updates all animation components of a world that have bUpdateInParallel set. The animation state update and apply
+ * and the world transform update run on worker threads. Listener events, bone drivers, bone followers and the world
+ * transform delegates run on the game thread in between, component by component in registration order.
+ *
+ * Also holds the world's spine.AnimationUpdateBudget: animation components using animation LOD request their updates,
+ * granted in the same frame while the frame's count is under the budget. Requests over the budget carry over and are
+ * granted first in the next frame, the most overdue before the others. */
+UCLASS()
+class SPINEPLUGIN_API USpineAnimationUpdateSubsystem : public UWorldSubsystem {
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void AddComponent(USpineSkeletonAnimationComponent *Component);
+	void RemoveComponent(USpineSkeletonAnimationComponent *Component);
+
+	void Update(float DeltaTime, ELevelTick TickType);
+
+	/* Returns true if the component may update this frame. With a budget set, the update is granted if this frame's
+	 * count is still under the budget, else the request is recorded with the priority and granted ahead of new requests
+	 * in the next frame. Components with higher priorities, e.g. those that waited longer, are granted first. */
+	bool ClaimUpdateBudget(USpineSkeletonAnimationComponent *Component, float Priority);
+
+protected:
+	struct FBudgetRequest {
+		TWeakObjectPtr<USpineSkeletonAnimationComponent> Component;
+		float Priority;
+	};
+
+	UPROPERTY()
+	TArray<USpineSkeletonAnimationComponent *> components;
+
+	// Game thread code run between the passes, e.g. listener events, may destroy any component, so the updated components
+	// are held weakly and those still valid are gathered into passComponents for the workers before each pass.
+	TArray<TWeakObjectPtr<USpineSkeletonAnimationComponent>> updatedComponents;
+	TArray<USpineSkeletonAnimationComponent *> passComponents;
+	TArray<FBudgetRequest> budgetRequests;
+	TSet<TWeakObjectPtr<USpineSkeletonAnimationComponent>> budgetGrants;
+	uint64 budgetFrame = 0;
+	int32 budgetUsed = 0;
+	FSpineAnimationUpdateTickFunction tickFunction;
+
+	void RegisterTickFunction();
+	void GrantUpdateBudget();
+	bool GatherPassComponents();
+};
@@ -32,9 +32,37 @@
 // clang-format off
 #include "Engine.h"
 #include "spine/spine.h"
+#include "SpineNativeDataCache.h"
 #include "SpineAtlasAsset.generated.h"
 // clang-format on
 
+class USpineAtlasAsset;
+
+/* The material instance of each atlas page and blend mode, for renderers to resolve a region's material with a single
+ * array lookup. The instances themselves are kept in the renderer's per blend mode arrays, which also keep them from being
+ * garbage collected. Only rebuilt when the atlas, its page textures, the parent materials or the instance arrays change. */
+struct SPINEPLUGIN_API FSpineMaterialTable {
+	/* Rebuilds the table if needed, re-creating material instances that no longer match. Returns true if it was rebuilt.
+	 * Parents and Instances are in BlendMode order. */
+	bool Update(UObject *Outer, USpineAtlasAsset *Atlas, FName TextureParameterName, UMaterialInterface *const (&Parents)[4],
+				TArray<UMaterialInstanceDynamic *> *const (&Instances)[4]);
+
+	/* Returns nullptr if the page is not from the atlas the table was built for. */
+	UMaterialInstanceDynamic *Find(spine::AtlasPage *Page, spine::BlendMode BlendMode) const {
+		int32 index = Page ? Page->index : -1;
+		if (!pages.IsValidIndex(index) || pages[index] != Page) return nullptr;
+		int32 blendMode = (uint32) BlendMode < 4 ? (int32) BlendMode : (int32) spine::BlendMode_Normal;
+		return materials[index * 4 + blendMode];
+	}
+
+protected:
+	TArray<spine::AtlasPage *> pages;
+	TArray<UTexture2D *> textures;
+	TArray<UMaterialInstanceDynamic *> materials; // [page index * 4 + blend mode]
+	UMaterialInterface *parents[4] = {};
+	FName textureParameterName;
+};
+
 UCLASS(BlueprintType, ClassGroup = (Spine))
 class SPINEPLUGIN_API USpineAtlasAsset : public UObject {
 	GENERATED_BODY()
@@ -52,7 +80,7 @@ public:
 	virtual void BeginDestroy() override;
 
 protected:
-	spine::Atlas *atlas = nullptr;
+	FSpineNativeAtlasPtr nativeAtlas;
 
 	UPROPERTY()
 	FString rawData;
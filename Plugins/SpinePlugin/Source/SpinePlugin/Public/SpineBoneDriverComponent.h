@@ -64,9 +64,11 @@ public:
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 
+	virtual void OnUnregister() override;
+
 protected:
-	UFUNCTION()
-	void BeforeUpdateWorldTransform(USpineSkeletonComponent *skeleton);
+	void BindSkeleton(USpineSkeletonComponent *skeleton);
 
-	USpineSkeletonComponent *lastBoundComponent = nullptr;
+	TWeakObjectPtr<AActor> lastTarget;
+	TWeakObjectPtr<USpineSkeletonComponent> boundSkeleton;
 };
@@ -32,6 +32,7 @@
 #include "Components/ActorComponent.h"
 #include "SpineBoneFollowerComponent.generated.h"
 
+class USpineSkeletonComponent;
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class SPINEPLUGIN_API USpineBoneFollowerComponent : public USceneComponent {
@@ -62,4 +63,16 @@ public:
 	virtual void BeginPlay() override;
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+	virtual void OnUnregister() override;
+
+	// Moves this component or the owning actor to the bone's transform. Called by the target's skeleton component after it
+	// updated its world transform.
+	void FollowBone(const FTransform &BoneTransform);
+
+protected:
+	void BindSkeleton(USpineSkeletonComponent *skeleton);
+
+	TWeakObjectPtr<AActor> lastTarget;
+	TWeakObjectPtr<USpineSkeletonComponent> boundSkeleton;
 };
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#pragma once
+
+#include "SpineSkeletonMeshComponent.h"
+#include "SpineCrowdComponent.generated.h"
+
+/* Where one batch of an instance's geometry goes in the merged render data of its crowd. */
+struct FSpineCrowdTarget {
+	int32 Batch = 0;
+	int32 FirstVertex = 0;
+	int32 FirstIndex = 0;
+	/* Added to the instance's indices, the offset of the copied vertices in the merged batch. */
+	int32 BaseVertex = 0;
+};
+
+/* A skeleton drawn by a crowd component. Its geometry is kept in skeleton space and only rebuilt when its pose changes,
+ * moving the instance only changes where the vertices end up when they are copied into the merged render data. */
+struct FSpineCrowdInstance {
+	TWeakObjectPtr<USpineSkeletonComponent> Skeleton;
+	/* The atlas the instance was last rejected for, so the warning is logged once per atlas. */
+	TWeakObjectPtr<USpineAtlasAsset> RejectedAtlas;
+	spine::Skeleton *SpineSkeleton = nullptr;
+	size_t LastPoseVersion = 0;
+	FTransform Transform;
+	FSpineMeshRenderData Geometry;
+	FBox Bounds = FBox(ForceInit);
+	TArray<FSpineCrowdTarget> Targets;
+	spine::Vector<float> WorldVertices;
+	spine::SkeletonClipping Clipper;
+};
+
+/* Draws many skeleton components that share an atlas with one draw call per material. The geometry of all instances is
+ * merged by material into a single buffer; instances are built and copied on worker threads. The instances need no
+ * renderer component of their own, they are placed like their bones, by their renderer component or else their owner.
+ * Within an instance the slots keep their draw order and depth offset, but instances are not sorted against each other
+ * and all slots using one material are drawn before those of the next. Instances using a different atlas than the first
+ * one are not drawn, a warning is logged for them. */
+UCLASS(ClassGroup = (Spine), meta = (BlueprintSpawnableComponent))
+class SPINEPLUGIN_API USpineCrowdComponent : public USpineSkeletonMeshComponent {
+	GENERATED_BODY()
+
+public:
+	USpineCrowdComponent(const FObjectInitializer &ObjectInitializer);
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+	UFUNCTION(BlueprintCallable, Category = "Components|Spine|Crowd")
+	void AddInstance(USpineSkeletonComponent *Instance);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|Spine|Crowd")
+	void RemoveInstance(USpineSkeletonComponent *Instance);
+
+	UFUNCTION(BlueprintPure, Category = "Components|Spine|Crowd")
+	int32 GetNumInstances() const { return crowdInstances.Num(); }
+
+protected:
+	void UpdateCrowd();
+
+	/* Allocated separately, the clipper of an instance must not be moved. */
+	TArray<TUniquePtr<FSpineCrowdInstance>> crowdInstances;
+	TArray<FSpineCrowdInstance *> builtInstances;
+	TArray<FSpineCrowdInstance *> drawnInstances;
+	TArray<FSpineCrowdInstance *> lastDrawnInstances;
+	bool instancesChanged = false;
+};
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "spine/spine.h"
+
+class UTexture2D;
+
+/* A parsed atlas shared by every atlas asset with the same text and page textures. Deleted with its last handle. */
+struct SPINEPLUGIN_API FSpineNativeAtlas {
+	spine::Atlas *Atlas = nullptr;
+	// The atlas text and pages, compared on a key match so a hash collision can't return another atlas.
+	FString Source;
+	TArray<UTexture2D *> Pages;
+	uint64 Key = 0;
+	int32 Bytes = 0;
+	bool bCached = false;
+
+	~FSpineNativeAtlas();
+};
+
+/* Parsed skeleton data shared by every skeleton data asset with the same data and atlas. Keeps its atlas alive and is
+ * deleted with its last handle. */
+struct SPINEPLUGIN_API FSpineNativeSkeletonData {
+	spine::SkeletonData *SkeletonData = nullptr;
+	TSharedPtr<FSpineNativeAtlas, ESPMode::ThreadSafe> Atlas;
+	// The source data and parse flags, compared on a key match so a hash collision can't return other skeleton data.
+	TArray<uint8> Source;
+	uint32 Flags = 0;
+	uint64 Key = 0;
+	int32 Bytes = 0;
+	bool bCached = false;
+
+	~FSpineNativeSkeletonData();
+};
+
+typedef TSharedPtr<FSpineNativeAtlas, ESPMode::ThreadSafe> FSpineNativeAtlasPtr;
+typedef TSharedPtr<FSpineNativeSkeletonData, ESPMode::ThreadSafe> FSpineNativeSkeletonDataPtr;
+
+/* Process wide cache of native spine-cpp data, keyed by a hash of the source data and checked against a copy of it.
+ * Assets and the components using them hold refcounted handles; an entry is evicted when its last handle is released.
+ * Hits, misses, cached bytes and parse time are reported in the Spine stat group. */
+class SPINEPLUGIN_API FSpineNativeDataCache {
+public:
+	static FSpineNativeDataCache &Get();
+
+	/* Returns the atlas parsed from the given atlas text, parsing it if no live entry matches. */
+	FSpineNativeAtlasPtr FindOrAddAtlas(const FString &RawData, const TArray<UTexture2D *> &Pages);
+
+	/* Returns the handle of a cached atlas, or an invalid handle if the atlas was not created by this cache. */
+	FSpineNativeAtlasPtr FindAtlas(spine::Atlas *Atlas);
+
+	/* Returns the skeleton data for the given source data, parse flags and atlas, calling Parse if no live entry
+	 * matches. Flags holds every option Parse reads the data with, e.g. JSON, arena, lazy animations, so data parsed
+	 * with other options is not shared. Atlases not created by this cache are not shared, the returned entry is then
+	 * owned by the caller alone. Parse may return nullptr, in which case nothing is cached and an invalid handle is
+	 * returned. */
+	FSpineNativeSkeletonDataPtr FindOrAddSkeletonData(const TArray<uint8> &SourceData, uint32 Flags, spine::Atlas *Atlas,
+													  TFunctionRef<spine::SkeletonData *()> Parse);
+
+private:
+	friend struct FSpineNativeAtlas;
+	friend struct FSpineNativeSkeletonData;
+
+	void RemoveAtlas(uint64 Key, spine::Atlas *Atlas, int32 Bytes);
+	void RemoveSkeletonData(uint64 Key, int32 Bytes);
+
+	FCriticalSection lock;
+	TMap<uint64, TWeakPtr<FSpineNativeAtlas, ESPMode::ThreadSafe>> atlases;
+	TMap<spine::Atlas *, TWeakPtr<FSpineNativeAtlas, ESPMode::ThreadSafe>> atlasesByNative;
+	TMap<uint64, TWeakPtr<FSpineNativeSkeletonData, ESPMode::ThreadSafe>> skeletonDatas;
+};
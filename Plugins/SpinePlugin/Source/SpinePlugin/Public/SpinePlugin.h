@@ -33,6 +33,8 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(SpineLog, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("Spine"), STATGROUP_Spine, STATCAT_Advanced);
+
 class SPINEPLUGIN_API SpinePlugin : public IModuleInterface {
 
 public:
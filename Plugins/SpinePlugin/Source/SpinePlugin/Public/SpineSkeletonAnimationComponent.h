@@ -74,6 +74,26 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSpineAnimationCompleteDelegate, UTr
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSpineAnimationEndDelegate, UTrackEntry *, entry);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSpineAnimationDisposeDelegate, UTrackEntry *, entry);
 
+/* Refers to a track entry without a UObject. Resolve it with USpineSkeletonAnimationComponent::ResolveTrackEntry, which
+ * returns null once the entry was disposed, even if spine reused its memory for another entry. */
+struct FSpineTrackEntryHandle {
+	int32 TrackIndex = -1;
+	uint64 Id = 0;
+
+	FSpineTrackEntryHandle() {}
+	explicit FSpineTrackEntryHandle(spine::TrackEntry *entry) {
+		if (entry) {
+			TrackIndex = entry->getTrackIndex();
+			Id = entry->getId();
+		}
+	}
+
+	bool IsSet() const { return Id != 0; }
+};
+
+/* Wraps a spine track entry for blueprints. A wrapper is valid until its AnimationDispose delegate was broadcast or the
+ * skeleton was recreated. After that it is pooled by its component and may wrap another entry, compare GetHandle() with
+ * a handle kept earlier to tell. */
 UCLASS(ClassGroup = (Spine), meta = (BlueprintSpawnableComponent), BlueprintType)
 class SPINEPLUGIN_API UTrackEntry : public UObject {
 	GENERATED_BODY()
@@ -82,117 +102,121 @@ public:
 	UTrackEntry() {}
 
 	void SetTrackEntry(spine::TrackEntry *trackEntry);
-	spine::TrackEntry *GetTrackEntry() { return entry; }
+	spine::TrackEntry *GetTrackEntry() { return IsValidEntry() ? entry : nullptr; }
+	FSpineTrackEntryHandle GetHandle() { return handle; }
+
+	/* Clears the track entry and all delegates, once the entry was disposed. */
+	void Release();
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	int GetTrackIndex() { return entry ? entry->getTrackIndex() : 0; }
+	int GetTrackIndex() { return IsValidEntry() ? entry->getTrackIndex() : 0; }
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	bool GetLoop() { return entry ? entry->getLoop() : false; }
+	bool GetLoop() { return IsValidEntry() ? entry->getLoop() : false; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetLoop(bool loop) {
-		if (entry) entry->setLoop(loop);
+		if (IsValidEntry()) entry->setLoop(loop);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetEventThreshold() { return entry ? entry->getEventThreshold() : 0; }
+	float GetEventThreshold() { return IsValidEntry() ? entry->getEventThreshold() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetEventThreshold(float eventThreshold) {
-		if (entry) entry->setEventThreshold(eventThreshold);
+		if (IsValidEntry()) entry->setEventThreshold(eventThreshold);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetAttachmentThreshold() { return entry ? entry->getAttachmentThreshold() : 0; }
+	float GetAttachmentThreshold() { return IsValidEntry() ? entry->getAttachmentThreshold() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetAttachmentThreshold(float attachmentThreshold) {
-		if (entry) entry->setAttachmentThreshold(attachmentThreshold);
+		if (IsValidEntry()) entry->setAttachmentThreshold(attachmentThreshold);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetDrawOrderThreshold() { return entry ? entry->getDrawOrderThreshold() : 0; }
+	float GetDrawOrderThreshold() { return IsValidEntry() ? entry->getDrawOrderThreshold() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetDrawOrderThreshold(float drawOrderThreshold) {
-		if (entry) entry->setDrawOrderThreshold(drawOrderThreshold);
+		if (IsValidEntry()) entry->setDrawOrderThreshold(drawOrderThreshold);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetAnimationStart() { return entry ? entry->getAnimationStart() : 0; }
+	float GetAnimationStart() { return IsValidEntry() ? entry->getAnimationStart() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetAnimationStart(float animationStart) {
-		if (entry) entry->setAnimationStart(animationStart);
+		if (IsValidEntry()) entry->setAnimationStart(animationStart);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetAnimationEnd() { return entry ? entry->getAnimationEnd() : 0; }
+	float GetAnimationEnd() { return IsValidEntry() ? entry->getAnimationEnd() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetAnimationEnd(float animationEnd) {
-		if (entry) entry->setAnimationEnd(animationEnd);
+		if (IsValidEntry()) entry->setAnimationEnd(animationEnd);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetAnimationLast() { return entry ? entry->getAnimationLast() : 0; }
+	float GetAnimationLast() { return IsValidEntry() ? entry->getAnimationLast() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetAnimationLast(float animationLast) {
-		if (entry) entry->setAnimationLast(animationLast);
+		if (IsValidEntry()) entry->setAnimationLast(animationLast);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetDelay() { return entry ? entry->getDelay() : 0; }
+	float GetDelay() { return IsValidEntry() ? entry->getDelay() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetDelay(float delay) {
-		if (entry) entry->setDelay(delay);
+		if (IsValidEntry()) entry->setDelay(delay);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetTrackTime() { return entry ? entry->getTrackTime() : 0; }
+	float GetTrackTime() { return IsValidEntry() ? entry->getTrackTime() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetTrackTime(float trackTime) {
-		if (entry) entry->setTrackTime(trackTime);
+		if (IsValidEntry()) entry->setTrackTime(trackTime);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetTrackEnd() { return entry ? entry->getTrackEnd() : 0; }
+	float GetTrackEnd() { return IsValidEntry() ? entry->getTrackEnd() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetTrackEnd(float trackEnd) {
-		if (entry) entry->setTrackEnd(trackEnd);
+		if (IsValidEntry()) entry->setTrackEnd(trackEnd);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetTimeScale() { return entry ? entry->getTimeScale() : 0; }
+	float GetTimeScale() { return IsValidEntry() ? entry->getTimeScale() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetTimeScale(float timeScale) {
-		if (entry) entry->setTimeScale(timeScale);
+		if (IsValidEntry()) entry->setTimeScale(timeScale);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetAlpha() { return entry ? entry->getAlpha() : 0; }
+	float GetAlpha() { return IsValidEntry() ? entry->getAlpha() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetAlpha(float alpha) {
-		if (entry) entry->setAlpha(alpha);
+		if (IsValidEntry()) entry->setAlpha(alpha);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetMixTime() { return entry ? entry->getMixTime() : 0; }
+	float GetMixTime() { return IsValidEntry() ? entry->getMixTime() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetMixTime(float mixTime) {
-		if (entry) entry->setMixTime(mixTime);
+		if (IsValidEntry()) entry->setMixTime(mixTime);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float GetMixDuration() { return entry ? entry->getMixDuration() : 0; }
+	float GetMixDuration() { return IsValidEntry() ? entry->getMixDuration() : 0; }
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
 	void SetMixDuration(float mixDuration) {
-		if (entry) entry->setMixDuration(mixDuration);
+		if (IsValidEntry()) entry->setMixDuration(mixDuration);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	FString getAnimationName() { return entry ? entry->getAnimation()->getName().buffer() : ""; }
+	FString getAnimationName() { return IsValidEntry() && entry->getAnimation() ? entry->getAnimation()->getName().buffer() : ""; }
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float getAnimationDuration() { return entry ? entry->getAnimation()->getDuration() : 0; }
+	float getAnimationDuration() { return IsValidEntry() && entry->getAnimation() ? entry->getAnimation()->getDuration() : 0; }
 
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|TrackEntry")
-	float isValidAnimation() { return entry != nullptr; }
+	float isValidAnimation() { return IsValidEntry(); }
 
 	UPROPERTY(BlueprintAssignable, Category = "Components|Spine|TrackEntry")
 	FSpineAnimationStartDelegate AnimationStart;
@@ -214,9 +238,24 @@ public:
 
 protected:
 	spine::TrackEntry *entry = nullptr;
+	// The id of the wrapped entry. spine reuses the memory of disposed entries, so entry is only used while its id matches.
+	// A disposed entry keeps its id until reused but has no animation, which is the case while its queued events are broadcast.
+	FSpineTrackEntryHandle handle;
+
+	bool IsValidEntry() { return entry && entry->getId() == handle.Id; }
+};
+
+/* A listener event raised on a worker thread, broadcast later on the game thread. */
+struct FSpineQueuedEvent {
+	spine::EventType Type;
+	UTrackEntry *Entry;
+	// The id the wrapper had when the event was queued, it changes once the wrapper is pooled.
+	uint64 EntryId;
+	FSpineEvent Event;
 };
 
 class USpineAtlasAsset;
+class USpineAnimationUpdateSubsystem;
 UCLASS(ClassGroup = (Spine), meta = (BlueprintSpawnableComponent))
 class SPINEPLUGIN_API USpineSkeletonAnimationComponent : public USpineSkeletonComponent {
 	GENERATED_BODY()
@@ -224,14 +263,44 @@ class SPINEPLUGIN_API USpineSkeletonAnimationComponent : public USpineSkeletonCo
 public:
 	spine::AnimationState *GetAnimationState() { return state; };
 
+	/** Update the animation on a worker thread, together with all other components that have this set, instead of in
+	 * this component's tick. Listener events are broadcast after the animation state update, before the world transform
+	 * update. Only applies in game worlds. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine)
+	bool bUpdateInParallel = false;
+
+	/** Update the animation less often when it is far from the camera or was not rendered recently. The skipped time is
+	 * added to the next update. The spine.AnimationUpdateBudget console variable limits how many of these components
+	 * update per frame in each world. Only applies in game worlds. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine)
+	bool bUseAnimationLOD = false;
+
+	/** Distance to the nearest player camera beyond which the animation updates every second frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine, meta = (EditCondition = "bUseAnimationLOD"))
+	float HalfRateDistance = 2000;
+
+	/** Distance to the nearest player camera beyond which the animation updates every fourth frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine, meta = (EditCondition = "bUseAnimationLOD"))
+	float QuarterRateDistance = 4000;
+
+	/** Frames between updates while the skeleton is not rendered, 0 to not update until it is rendered again. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine, meta = (EditCondition = "bUseAnimationLOD"))
+	int32 OffscreenUpdateInterval = 8;
+
 	USpineSkeletonAnimationComponent();
 
 	virtual void BeginPlay() override;
 
+	virtual void OnUnregister() override;
+
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 
 	virtual void FinishDestroy() override;
 
+	/* True if the animation LOD skipped the last update and the pose has not changed since, so renderers may skip the
+	 * frame too. Holds until the next update, so it does not depend on whether the renderer ticks before or after. */
+	bool WasSkippedByAnimationLOD() const { return bLODSkipped && skeleton && skeleton->getPoseVersion() == lodSkippedPoseVersion; }
+
 	//Added functions for manual configuration
 
 	/* Manages if this skeleton should update automatically or is paused. */
@@ -264,6 +333,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|Animation")
 	UTrackEntry *GetCurrent(int trackIndex);
 
+	/* The functions below return handles instead of UTrackEntry wrappers, so C++ code can play animations without
+	 * creating UObjects. A handle is not set if the animation was not found. Their entries get a wrapper only when an
+	 * event is raised while the component's Animation delegates are bound, so those delegates still receive all events. */
+	FSpineTrackEntryHandle SetAnimationHandle(int TrackIndex, const FString &AnimationName, bool bLoop);
+	FSpineTrackEntryHandle AddAnimationHandle(int TrackIndex, const FString &AnimationName, bool bLoop, float Delay);
+	FSpineTrackEntryHandle SetEmptyAnimationHandle(int TrackIndex, float MixDuration);
+	FSpineTrackEntryHandle AddEmptyAnimationHandle(int TrackIndex, float MixDuration, float Delay);
+	FSpineTrackEntryHandle GetCurrentHandle(int TrackIndex);
+
+	/* Returns the track entry if it is still current, queued or mixed out on its track, else null. */
+	spine::TrackEntry *ResolveTrackEntry(const FSpineTrackEntryHandle &Handle);
+
 	UFUNCTION(BlueprintCallable, Category = "Components|Spine|Animation")
 	void ClearTracks();
 
@@ -296,25 +377,73 @@ public:
 
 	// used in C event callback. Needs to be public as we can't call
 	// protected methods from plain old C function.
-	void GCTrackEntry(UTrackEntry *entry) { trackEntries.Remove(entry); }
+	void GCTrackEntry(UTrackEntry *entry);
+	void HandleEvent(spine::EventType type, spine::TrackEntry *trackEntry, spine::Event *event);
 
 protected:
 	virtual void CheckState() override;
 	virtual void InternalTick(float DeltaTime, bool CallDelegates = true, bool Preview = false) override;
 	virtual void DisposeState() override;
+	virtual bool IsAnimated() override;
+
+	/* Returns false if the animation LOD skips this frame, else adds the time skipped before to DeltaTime. */
+	bool UpdateAnimationLOD(float &DeltaTime);
+	int32 GetAnimationLODInterval();
 
 	spine::AnimationState *state;
+	// Keeps the animation state data alive while the state uses it, even if the asset is re-imported or unloaded.
+	FSpineAnimationStateDataPtr stateDataHandle;
 
 	// keep track of track entries so they won't get GCed while
 	// in transit within a blueprint
 	UPROPERTY()
 	TSet<UTrackEntry *> trackEntries;
 
+	/* Released wrappers, reused for new entries. */
+	UPROPERTY()
+	TArray<UTrackEntry *> trackEntryPool;
+
+	/* Returned when no animation was set, so failing calls don't create a wrapper each time. */
+	UPROPERTY()
+	UTrackEntry *invalidTrackEntry = nullptr;
+
+	/* Returns the wrapper of the track entry, taking one from the pool if it has none yet. */
+	UTrackEntry *ObtainTrackEntry(spine::TrackEntry *entry);
+	/* Obtains wrappers for all entries of the state, so events raised on workers reach the component's delegates. */
+	void ObtainTrackEntries();
+	bool HasAnimationDelegates() const;
+	UTrackEntry *GetInvalidTrackEntry();
+	/* Releases the wrappers of all track entries, when the animation state is disposed. */
+	void ReleaseTrackEntries();
+
 private:
+	friend class USpineAnimationUpdateSubsystem;
+
+	void BroadcastEvent(spine::EventType type, UTrackEntry *entry, const FSpineEvent &event);
+	void SetUpdateSubsystem(USpineAnimationUpdateSubsystem *subsystem);
+
+	// Called by the update subsystem, the Parallel functions on worker threads.
+	bool BeginParallelUpdate(float DeltaTime);
+	void UpdateAnimationStateParallel();
+	void BeforeParallelWorldTransform();
+	void UpdateWorldTransformParallel();
+	void AfterParallelWorldTransform();
+
 	/* If the animation should update automatically. */
 	UPROPERTY()
 	bool bAutoPlaying;
 
+	TWeakObjectPtr<USpineAnimationUpdateSubsystem> updateSubsystem;
+	float parallelDeltaTime = 0;
+	bool bQueueEvents = false;
+	TArray<FSpineQueuedEvent> queuedEvents;
+
+	TWeakObjectPtr<UPrimitiveComponent> lodRenderer;
+	float lodSkippedTime = 0;
+	int32 lodSkippedFrames = 0;
+	bool bLODSkipped = false;
+	size_t lodSkippedPoseVersion = 0;
+
 	FString lastPreviewAnimation;
 	FString lastPreviewSkin;
 };
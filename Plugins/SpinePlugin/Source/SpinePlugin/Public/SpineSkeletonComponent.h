@@ -40,8 +40,21 @@ class USpineSkeletonComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSpineBeforeUpdateWorldTransformDelegate, USpineSkeletonComponent *, skeleton);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSpineAfterUpdateWorldTransformDelegate, USpineSkeletonComponent *, skeleton);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSpineSkeletonCreatedDelegate, USpineSkeletonComponent *, skeleton);
 
 class USpineAtlasAsset;
+class USpineBoneFollowerComponent;
+class USpineBoneDriverComponent;
+
+/* A follower or driver registered with a skeleton component. The bone is resolved once and again only when the bone name
+ * or the skeleton changes. */
+template<typename T>
+struct TSpineBoneBinding {
+	TWeakObjectPtr<T> Component;
+	FString BoneName;
+	spine::Bone *Bone = nullptr;
+};
+
 UCLASS(ClassGroup = (Spine), meta = (BlueprintSpawnableComponent))
 class SPINEPLUGIN_API USpineSkeletonComponent : public UActorComponent {
 	GENERATED_BODY()
@@ -53,8 +66,24 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine)
 	USpineSkeletonDataAsset *SkeletonData;
 
+	/** Batch world transform updates of child bones through the skeleton's pose buffer. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine)
+	bool bUsePoseBuffer = false;
+
+	/** Compare each pose to the previous one, so renderers skip rebuilding while a paused or static skeleton is unchanged.
+	 * Always done while no animation is playing. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine)
+	bool bComparePoses = false;
+
+	/** Parse the skeleton data on a worker thread instead of during the first tick. Nothing is shown until it is ready. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Spine)
+	bool bLoadAsync = false;
+
 	spine::Skeleton *GetSkeleton() { return skeleton; };
 
+	/* The renderer component's transform, or the owner's if there is no renderer component. */
+	FTransform GetBaseTransform();
+
 	UFUNCTION(BlueprintPure, Category = "Components|Spine|Skeleton")
 	void GetSkins(TArray<FString> &Skins);
 
@@ -130,6 +159,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Components|Spine|Skeleton")
 	FSpineAfterUpdateWorldTransformDelegate AfterUpdateWorldTransform;
 
+	/** Called when the skeleton has been created from its skeleton data, e.g. when an asynchronous load completes. */
+	UPROPERTY(BlueprintAssignable, Category = "Components|Spine|Skeleton")
+	FSpineSkeletonCreatedDelegate SkeletonCreated;
+
 	USpineSkeletonComponent();
 
 	virtual void BeginPlay() override;
@@ -138,14 +171,39 @@ public:
 
 	virtual void FinishDestroy() override;
 
+	/* Bone followers and drivers register with the skeleton component of their target, which updates all of them in one
+	 * pass around its world transform update. */
+	void AddBoneFollower(USpineBoneFollowerComponent *Follower);
+	void RemoveBoneFollower(USpineBoneFollowerComponent *Follower);
+	void AddBoneDriver(USpineBoneDriverComponent *Driver);
+	void RemoveBoneDriver(USpineBoneDriverComponent *Driver);
+
 protected:
 	virtual void CheckState();
 	virtual void InternalTick(float DeltaTime, bool CallDelegates = true, bool Preview = false);
 	virtual void DisposeState();
+	/* False if nothing but bone drivers and gameplay code changes the pose. Such skeletons always compare poses. */
+	virtual bool IsAnimated() { return false; }
+
+	/* Updates the world transform, driving bones before and moving followers after it. */
+	void UpdateSkeletonWorldTransform(bool CallDelegates);
+	void BeforeSkeletonWorldTransform(bool CallDelegates);
+	void AfterSkeletonWorldTransform(bool CallDelegates);
+	void UpdateBoneDrivers();
+	void UpdateBoneFollowers();
+	/* Forgets the resolved bones, called when the skeleton is disposed. */
+	void ResetBoneBindings();
+
+	/* Returns false while the skeleton data for the current assets is still being loaded asynchronously. */
+	bool IsSkeletonDataReady();
 
 	spine::Skeleton *skeleton;
+	// Keeps the skeleton data alive while the skeleton uses it, even if the asset is re-imported or unloaded.
+	FSpineNativeSkeletonDataPtr skeletonDataHandle;
 	USpineAtlasAsset *lastAtlas = nullptr;
 	spine::Atlas *lastSpineAtlas = nullptr;
 	USpineSkeletonDataAsset *lastData = nullptr;
 	spine::Skin *customSkin = nullptr;
+	TArray<TSpineBoneBinding<USpineBoneFollowerComponent>> boneFollowers;
+	TArray<TSpineBoneBinding<USpineBoneDriverComponent>> boneDrivers;
 };
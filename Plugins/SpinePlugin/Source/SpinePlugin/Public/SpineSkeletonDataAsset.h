@@ -32,9 +32,31 @@
 // clang-format off
 #include "Engine.h"
 #include "spine/spine.h"
+#include "SpineNativeDataCache.h"
 #include "SpineSkeletonDataAsset.generated.h"
 // clang-format on
 
+class USpineAtlasAsset;
+
+typedef TSharedPtr<spine::BakedAnimation, ESPMode::ThreadSafe> FSpineBakedAnimationPtr;
+typedef TSharedPtr<spine::AnimationStateData, ESPMode::ThreadSafe> FSpineAnimationStateDataPtr;
+
+/* An animation baked by USpineSkeletonDataAsset::BakeAnimations, encoded by spine::BakedAnimation::write. */
+USTRUCT()
+struct SPINEPLUGIN_API FSpineBakedAnimationData {
+	GENERATED_BODY();
+
+public:
+	UPROPERTY(VisibleAnywhere)
+	FString Name;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 Bytes = 0;
+
+	UPROPERTY()
+	TArray<uint8> Data;
+};
+
 USTRUCT(BlueprintType, Category = "Spine")
 struct SPINEPLUGIN_API FSpineAnimationStateMixData {
 	GENERATED_BODY();
@@ -57,21 +79,88 @@ class SPINEPLUGIN_API USpineSkeletonDataAsset : public UObject {
 public:
 	spine::SkeletonData *GetSkeletonData(spine::Atlas *Atlas);
 
+	/* Returns a handle that keeps the skeleton data alive after this asset releases or re-imports it. */
+	FSpineNativeSkeletonDataPtr GetSkeletonDataHandle(spine::Atlas *Atlas);
+
+	/* Starts parsing the skeleton data for the atlas on a worker thread, if it is not loaded or loading yet. Returns
+	 * true once GetSkeletonData no longer has to parse, because the data has been loaded or has failed to load. */
+	bool LoadSkeletonDataAsync(spine::Atlas *Atlas);
+
 	spine::AnimationStateData *GetAnimationStateData(spine::Atlas *atlas);
+
+	/* Returns a handle that keeps the animation state data alive after this asset releases or re-imports it. Holders
+	 * of an animation state keep it, together with the skeleton data handle, for as long as the state exists. */
+	FSpineAnimationStateDataPtr GetAnimationStateDataHandle(spine::Atlas *atlas);
 	void SetMix(const FString &from, const FString &to, float mix);
 	float GetMix(const FString &from, const FString &to);
 
+	/* Returns the baked animation with the given name, decoded on first use, or an invalid pointer if it was not baked. */
+	FSpineBakedAnimationPtr GetBakedAnimation(const FString &Name);
+
+	/* Samples AnimationsToBake with BakeAtlas and BakeSkin at BakeFrameRate and stores the result in BakedAnimations,
+	 * replacing earlier bakes of the same animations. */
+	UFUNCTION(CallInEditor)
+	void BakeAnimations();
+
+	/* Logs, for each atlas the skeleton data is loaded for, how many animations are decoded and the memory they use. */
+	UFUNCTION(CallInEditor)
+	void ReportAnimationMemory();
+
 	FName GetSkeletonDataFileName() const;
 	void SetRawData(TArray<uint8> &Data);
 
 	virtual void BeginDestroy() override;
 
+	virtual void PostLoad() override;
+
+	/* If set, the skeleton data for this atlas is parsed on a worker thread as soon as this asset is loaded. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	USpineAtlasAsset *PreloadAtlas = nullptr;
+
+	/* If set, the skeleton data and the skeletons created from it are allocated from a few large blocks instead of
+	 * thousands of small heap allocations. Takes effect the next time the skeleton data is parsed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bUseArena = false;
+
+	/* If set and the skeleton data was exported as binary, the timelines of an animation are decoded the first time it is
+	 * played instead of when the skeleton data is parsed. Takes effect the next time the skeleton data is parsed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bLazyAnimations = false;
+
+	/* With lazy animations, the kilobytes the decoded animations may use before those that are not playing are released,
+	 * to be decoded again when played. 0 keeps all decoded animations. Takes effect when the skeleton data is loaded. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bLazyAnimations", ClampMin = "0"))
+	int32 AnimationBudgetKB = 0;
+
+	/* If set and the skeleton data was exported as binary, bezier curves are stored as 4 control values of 16 bits each and
+	 * evaluated when applied, instead of as 18 floats of samples. Takes effect the next time the skeleton data is parsed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bQuantizeCurves = false;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float DefaultMix = 0;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TArray<FSpineAnimationStateMixData> MixData;
 
+	/* The animations baked by BakeAnimations, for renderers playing back baked vertices instead of evaluating bones. */
+	UPROPERTY(EditAnywhere)
+	TArray<FString> AnimationsToBake;
+
+	UPROPERTY(EditAnywhere)
+	float BakeFrameRate = 30;
+
+	/* The skin to bake with, the default skin if empty. */
+	UPROPERTY(EditAnywhere)
+	FString BakeSkin;
+
+	/* The atlas to bake with, the preload atlas if not set. Region attachments are sized by their atlas region. */
+	UPROPERTY(EditAnywhere)
+	USpineAtlasAsset *BakeAtlas = nullptr;
+
+	UPROPERTY(VisibleAnywhere)
+	TArray<FSpineBakedAnimationData> BakedAnimations;
+
 	UPROPERTY(Transient, VisibleAnywhere)
 	TArray<FString> Bones;
 
@@ -91,19 +180,46 @@ protected:
 	UPROPERTY()
 	TArray<uint8> rawData;
 
+	// rawData as written by spine::SkeletonCooked when the asset was imported or loaded in the editor. Loading prefers
+	// it and falls back to rawData if it was cooked by another runtime version. Cooked packages keep only one of the two,
+	// see UsesCookedData().
+	UPROPERTY()
+	TArray<uint8> cookedData;
+
 	UPROPERTY()
 	FName skeletonDataFileName;
 
 	// These are created at runtime
 	struct NativeSkeletonData {
-		spine::SkeletonData *skeletonData;
-		spine::AnimationStateData *animationStateData;
+		FSpineNativeSkeletonDataPtr skeletonData;
+		FSpineAnimationStateDataPtr animationStateData;
 	};
 
 	TMap<spine::Atlas *, NativeSkeletonData> atlasToNativeData;
 
+	// Atlases whose skeleton data is being parsed on a worker thread, or failed to parse there.
+	TSet<spine::Atlas *> pendingLoads;
+	TSet<spine::Atlas *> failedLoads;
+	int32 rawDataVersion = 0;
+
+	// Baked animations decoded from BakedAnimations.
+	TMap<FString, FSpineBakedAnimationPtr> decodedBakedAnimations;
+
 	void ClearNativeData();
 
+	void AddNativeData(spine::Atlas *Atlas, const FSpineNativeSkeletonDataPtr &SkeletonData);
+
+	void ReportLoadError(const FString &Error);
+
+	bool IsJson() const;
+
+	// True if the skeleton data is read from cookedData rather than rawData, which is needed to decode animations
+	// lazily or with quantized curves.
+	bool UsesCookedData() const;
+
+	// The data the native data cache identifies the skeleton data by, rawData unless a cooked package stripped it.
+	const TArray<uint8> &GetSourceData() const;
+
 	void SetMixes(spine::AnimationStateData *animationStateData);
 
 #if WITH_EDITORONLY_DATA
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Components/MeshComponent.h"
+#include "DynamicMeshBuilder.h"
+#include "SpineSkeletonAnimationComponent.h"
+#include "SpineSkeletonMeshComponent.generated.h"
+
+/* Vertices and indices of one draw call, using a single material. The indices are relative to the batch's first vertex. */
+struct FSpineMeshBatch {
+	FMaterialRenderProxy *Material = nullptr;
+	int32 FirstVertex = 0;
+	int32 NumVertices = 0;
+	int32 FirstIndex = 0;
+	int32 NumIndices = 0;
+};
+
+/* Geometry of a whole skeleton, filled on the game thread and then read once by the render thread, which writes it into
+ * the scene proxy's vertex and index buffers. The dark color of two color tinting is passed in texture coordinates 1 (red, green) and 2 (blue). */
+struct FSpineMeshRenderData {
+	TArray<FDynamicMeshVertex> Vertices;
+	TArray<uint32> Indices;
+	TArray<FSpineMeshBatch> Batches;
+
+	void Reset() {
+		Vertices.Reset();
+		Indices.Reset();
+		Batches.Reset();
+	}
+};
+
+typedef TSharedPtr<FSpineMeshRenderData, ESPMode::ThreadSafe> FSpineMeshRenderDataPtr;
+
+/* Renders a skeleton through its own scene proxy instead of a procedural mesh. Geometry is double buffered: one buffer
+ * is filled while the render thread uploads the other, and buffers are handed over without copying. The proxy keeps
+ * its vertex and index buffers across frames and uploads into them once per update, all views draw from them. Draws
+ * one mesh batch per material, has no collision and no tangents. */
+UCLASS(ClassGroup = (Spine), meta = (BlueprintSpawnableComponent))
+class SPINEPLUGIN_API USpineSkeletonMeshComponent : public UMeshComponent {
+	GENERATED_BODY()
+
+public:
+	USpineSkeletonMeshComponent(const FObjectInitializer &ObjectInitializer);
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+	/* Updates this skeleton renderer using the provided skeleton animation component. */
+	void UpdateRenderer(USpineSkeletonComponent *Skeleton);
+
+	// Material Instance parents
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	UMaterialInterface *NormalBlendMaterial;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	UMaterialInterface *AdditiveBlendMaterial;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	UMaterialInterface *MultiplyBlendMaterial;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	UMaterialInterface *ScreenBlendMaterial;
+
+	// Need to hold on to the dynamic instances, or the GC will kill us while updating them
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	TArray<UMaterialInstanceDynamic *> atlasNormalBlendMaterials;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	TArray<UMaterialInstanceDynamic *> atlasAdditiveBlendMaterials;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	TArray<UMaterialInstanceDynamic *> atlasMultiplyBlendMaterials;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	TArray<UMaterialInstanceDynamic *> atlasScreenBlendMaterials;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	float DepthOffset = 0.1f;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	FName TextureParameterName;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	FLinearColor Color = FLinearColor(1, 1, 1, 1);
+
+	virtual FPrimitiveSceneProxy *CreateSceneProxy() override;
+
+	virtual FBoxSphereBounds CalcBounds(const FTransform &LocalToWorld) const override;
+
+	virtual void GetUsedMaterials(TArray<UMaterialInterface *> &OutMaterials, bool bGetDebugMaterials = false) const override;
+
+protected:
+	void UpdateMesh(spine::Skeleton *Skeleton);
+
+	/* Appends the skeleton's geometry in skeleton space to the render data, one batch per run of slots sharing a
+	 * material, and grows the bounds to contain it. Only reads the skeleton and the material table, so several
+	 * skeletons can be built at the same time as long as each has its own scratch vertices and clipper. Tint multiplies
+	 * the skeleton's color. */
+	static void BuildMesh(spine::Skeleton *Skeleton, const FSpineMaterialTable &MaterialTable, float SlotDepthOffset,
+						  const FLinearColor &Tint, spine::Vector<float> &WorldVertices, spine::SkeletonClipping &Clipper,
+						  FSpineMeshRenderData &Data, FBox &Bounds);
+
+	/* Returns false while the skeleton's pose and the properties the mesh is built from are unchanged. */
+	bool NeedsMeshUpdate(spine::Skeleton *Skeleton);
+
+	/* Returns the buffer to fill next, which is not referenced by the render thread. */
+	FSpineMeshRenderData &BeginRenderData();
+
+	/* Hands the filled buffer to the scene proxy. */
+	void SendRenderData();
+
+	FSpineMaterialTable materialTable;
+	spine::Vector<float> worldVertices;
+	size_t lastPoseVersion = 0;
+	FLinearColor lastColor;
+	float lastDepthOffset = 0;
+	spine::SkeletonClipping clipper;
+
+	FSpineMeshRenderDataPtr renderData[2];
+	int32 renderDataIndex = 0;
+	FBox localBounds;
+};
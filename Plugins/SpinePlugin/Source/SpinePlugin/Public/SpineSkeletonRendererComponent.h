@@ -34,6 +34,21 @@
 #include "SpineSkeletonAnimationComponent.h"
 #include "SpineSkeletonRendererComponent.generated.h"
 
+/* Geometry of one procedural mesh section, kept across frames so its arrays keep their allocations. */
+struct FSpineMeshSectionBuffers {
+	TArray<FVector> Vertices;
+	TArray<int32> Indices;
+	TArray<FVector> Normals;
+	TArray<FVector2D> Uvs;
+	TArray<FColor> Colors;
+	TArray<FVector> DarkColors;
+
+	/* Indices and vertex count the section was last uploaded with. */
+	TArray<int32> PreviousIndices;
+	int32 PreviousVertexCount = 0;
+	bool bCreated = false;
+	bool bCreatedCollision = false;
+};
 
 UCLASS(ClassGroup = (Spine), meta = (BlueprintSpawnableComponent))
 class SPINEPLUGIN_API USpineSkeletonRendererComponent : public UProceduralMeshComponent {
@@ -65,19 +80,15 @@ public:
 	// Need to hold on to the dynamic instances, or the GC will kill us while updating them
 	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
 	TArray<UMaterialInstanceDynamic *> atlasNormalBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToNormalBlendMaterial;
 
 	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
 	TArray<UMaterialInstanceDynamic *> atlasAdditiveBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToAdditiveBlendMaterial;
 
 	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
 	TArray<UMaterialInstanceDynamic *> atlasMultiplyBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToMultiplyBlendMaterial;
 
 	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
 	TArray<UMaterialInstanceDynamic *> atlasScreenBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToScreenBlendMaterial;
 
 	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
 	float DepthOffset = 0.1f;
@@ -92,17 +103,57 @@ public:
 	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
 	bool bCreateCollision;
 
+	/** Plays an animation baked into the skeleton data asset instead of rendering the skeleton's pose. The skeleton
+	 * component only provides the atlas and skeleton data and can have its tick disabled, no bones are evaluated. */
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	bool bPlayBakedAnimation = false;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	FString BakedAnimation;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	bool bLoopBakedAnimation = true;
+
+	/** The playback time of the baked animation, advanced every tick. */
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	float BakedAnimationTime = 0;
+
+	UPROPERTY(Category = Spine, EditAnywhere, BlueprintReadWrite)
+	float BakedAnimationTimeScale = 1;
+
 	virtual void FinishDestroy() override;
 
 protected:
-	void UpdateRendererMaterial(spine::AtlasPage *CurrentPage, UTexture2D *Texture,
-								UMaterialInstanceDynamic *&CurrentInstance, UMaterialInterface *ParentMaterial,
-								TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> &PageToBlendMaterial);
-
 	void UpdateMesh(spine::Skeleton *Skeleton);
 
-	void Flush(int &Idx, TArray<FVector> &Vertices, TArray<int32> &Indices, TArray<FVector> &Normals, TArray<FVector2D> &Uvs, TArray<FColor> &Colors, TArray<FVector> &Colors2, UMaterialInstanceDynamic *Material);
+	/* Renders the frame of the baked animation at the current playback time. */
+	void UpdateBakedRenderer(USpineSkeletonComponent *Skeleton);
+	void UpdateBakedMesh(int Frame);
+
+	/* Appends an attachment's vertices and triangles to the section. */
+	void AddVertices(FSpineMeshSectionBuffers &Section, int &Idx, const float *Vertices, const float *Uvs, int NumVertices,
+					 const unsigned short *Indices, int NumIndices, FColor VertexColor, FVector DarkColor, float Depth);
+
+	/* Returns false while the skeleton's pose and the properties the mesh is built from are unchanged. */
+	bool NeedsMeshUpdate(spine::Skeleton *Skeleton);
 
+	void Flush(int &Idx, FSpineMeshSectionBuffers &Section, UMaterialInstanceDynamic *Material);
+
+	FSpineMeshSectionBuffers &BeginMeshSection(int Idx);
+
+	void ClearMeshSections(int FirstSection);
+
+	FSpineMaterialTable materialTable;
 	spine::Vector<float> worldVertices;
+	size_t lastPoseVersion = 0;
+	FLinearColor lastColor;
+	float lastDepthOffset = 0;
+	bool bLastCreateCollision = false;
+	TArray<FSpineMeshSectionBuffers> meshSections;
 	spine::SkeletonClipping clipper;
+
+	FSpineBakedAnimationPtr bakedAnimation;
+	FSpineNativeSkeletonDataPtr bakedSkeletonData;
+	spine::Vector<spine::Attachment *> bakedAttachments;
+	int lastBakedFrame = -1;
 };
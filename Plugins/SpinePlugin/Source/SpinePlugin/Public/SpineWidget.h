@@ -226,6 +226,10 @@ protected:
 
 	spine::Skeleton *skeleton;
 	spine::AnimationState *state;
+	// Keep the skeleton and animation state data alive while the skeleton and state use them, even if the asset is
+	// re-imported or unloaded.
+	FSpineNativeSkeletonDataPtr skeletonDataHandle;
+	FSpineAnimationStateDataPtr stateDataHandle;
 	USpineAtlasAsset *lastAtlas = nullptr;
 	spine::Atlas *lastSpineAtlas = nullptr;
 	USpineSkeletonDataAsset *lastData = nullptr;
@@ -234,19 +238,17 @@ protected:
 	// Need to hold on to the dynamic instances, or the GC will kill us while updating them
 	UPROPERTY()
 	TArray<UMaterialInstanceDynamic *> atlasNormalBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToNormalBlendMaterial;
 
 	UPROPERTY()
 	TArray<UMaterialInstanceDynamic *> atlasAdditiveBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToAdditiveBlendMaterial;
 
 	UPROPERTY()
 	TArray<UMaterialInstanceDynamic *> atlasMultiplyBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToMultiplyBlendMaterial;
 
 	UPROPERTY()
 	TArray<UMaterialInstanceDynamic *> atlasScreenBlendMaterials;
-	TMap<spine::AtlasPage *, UMaterialInstanceDynamic *> pageToScreenBlendMaterial;
+
+	FSpineMaterialTable materialTable;
 
 	spine::Vector<float> worldVertices;
 	spine::SkeletonClipping clipper;
@@ -47,6 +47,8 @@ namespace spine {
 
 	class AnimationState;
 
+	class AnimationCache;
+
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
@@ -54,6 +56,14 @@ namespace spine {
 
 		friend class AnimationStateData;
 
+		friend class AnimationCache;
+
+		friend class EventQueue;
+
+		friend class SkeletonBinary;
+
+		friend class SkeletonCooked;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
@@ -96,6 +106,8 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class Timeline;
+
 	public:
 		Animation(const String &name, Vector<Timeline *> &timelines, float duration);
 
@@ -110,19 +122,44 @@ namespace spine {
 
 		Vector<Timeline *> &getTimelines();
 
-		bool hasTimeline(Vector<PropertyId> ids);
+		bool hasTimeline(Vector<PropertyId> &ids);
 
 		float getDuration();
 
 		void setDuration(float inValue);
 
+		/// False while the timelines of an animation read lazily are not decoded, see SkeletonBinary::setLazyAnimations().
+		bool isLoaded();
+
+		/// Decodes the timelines of an animation read lazily if they are not decoded yet. SkeletonData::findAnimation() calls
+		/// it. The timelines of an animation that is not retained may be released again when the AnimationCache is over
+		/// budget, on any thread that loads or trims. Returns false if the timelines could not be decoded.
+		bool load();
+
+		/// Like load(), and keeps the timelines from being released until a matching release(). AnimationState retains the
+		/// animations of its track entries; other code that uses the timelines while the cache may be trimmed retains the
+		/// animation for that time, see SkeletonData::retainAnimation(). Each call must be matched by release(), even if it
+		/// returns false.
+		bool retain();
+
+		void release();
+
 	private:
 		Vector<Timeline *> _timelines;
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
 		String _name;
+		AnimationCache *_cache; // Set when the timelines are decoded on demand.
+		size_t _offset; // Where the encoded timelines start, for the cache.
+		size_t _loadedBytes;
+		size_t _lastUse;
+		int _users;
+		bool _loaded;
+
+		void setTimelines(Vector<Timeline *> &timelines);
 
-		/// @param target After the first and before the last entry.
+		/// Binary search for the index of the last frame whose time is less than or equal to target, ignoring the
+		/// first frame's time (target is assumed to be after the first entry). Frame times must be non-decreasing.
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_AnimationCache_h
+#define Spine_AnimationCache_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class Animation;
+
+	class Timeline;
+
+	/// Decodes the timelines of animations the first time they are used and, when given a budget, releases the timelines of
+	/// the least recently used animations that no AnimationState is playing. Created by SkeletonBinary when animations are
+	/// read lazily, see SkeletonBinary::setLazyAnimations(), and owned by the SkeletonData. Thread safe.
+	class SP_API AnimationCache : public SpineObject {
+		friend class Animation;
+
+	public:
+		AnimationCache();
+
+		virtual ~AnimationCache();
+
+		/// The estimated bytes the decoded timelines may use before unused animations are released. 0, the default, keeps
+		/// decoded animations until the SkeletonData is destroyed.
+		size_t getBudget();
+
+		void setBudget(size_t bytes);
+
+		/// The number of animations whose timelines are decoded on demand.
+		size_t getAnimationCount();
+
+		/// The number of animations whose timelines are currently decoded.
+		size_t getLoadedCount();
+
+		/// The estimated bytes used by the currently decoded timelines.
+		size_t getLoadedBytes();
+
+		/// The bytes kept to decode the animations.
+		virtual size_t getEncodedBytes() = 0;
+
+		/// The number of times timelines were decoded, including animations decoded again after being released.
+		size_t getLoads();
+
+		/// The number of times the timelines of an unused animation were released to stay within the budget.
+		size_t getReleases();
+
+	protected:
+		/// Adds an animation whose timelines are decoded by decode() when it is first used.
+		void add(Animation *animation);
+
+		/// Decodes the timelines of an animation added by add(). Called with the cache locked and no arena current.
+		virtual bool decode(Animation &animation, Vector<Timeline *> &timelines) = 0;
+
+	private:
+		struct Lock;
+
+		Lock *_lock;
+		Vector<Animation *> _animations;
+		size_t _budget;
+		size_t _loadedCount;
+		size_t _loadedBytes;
+		size_t _loads;
+		size_t _releases;
+		size_t _useCount; // Stamps animations when used, the lowest stamp is released first.
+
+		AnimationCache(const AnimationCache &);
+
+		AnimationCache &operator=(const AnimationCache &);
+
+		bool load(Animation &animation, bool retain);
+
+		void release(Animation &animation);
+
+		void unload(Animation &animation);
+
+		void trim(Animation *keep);
+
+		static size_t getBytes(Vector<Timeline *> &timelines);
+	};
+}
+
+#endif /* Spine_AnimationCache_h */
@@ -102,6 +102,10 @@ namespace spine {
 		/// The index of the track where this entry is either current or queued.
 		int getTrackIndex();
 
+		/// An id unique among the entries created by the animation state, which is not reused when the entry is returned
+		/// to the pool. Can be used to check that a track entry still is the one that was set or queued earlier.
+		size_t getId();
+
 		/// The animation to apply for this track entry.
 		Animation *getAnimation();
 
@@ -274,6 +278,7 @@ namespace spine {
 		TrackEntry *_mixingFrom;
 		TrackEntry *_mixingTo;
 		int _trackIndex;
+		size_t _id;
 
 		bool _loop, _holdPrevious, _reverse;
 		float _eventThreshold, _attachmentThreshold, _drawOrderThreshold;
@@ -284,10 +289,15 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		Vector<size_t> _timelineCursors;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
 
 		void reset();
+
+		/// The frame cursor of each of the animation's timelines for Timeline::searchFrame(), so entries playing the same
+		/// animation at different times don't invalidate each other's cursors. Sized on first use.
+		size_t *getTimelineCursors();
 	};
 
 	class SP_API EventQueueEntry : public SpineObject {
@@ -450,16 +460,18 @@ namespace spine {
 
 		int _unkeyedState;
 
+		size_t _nextTrackEntryId;
+
 		float _timeScale;
 
 		static Animation *getEmptyAnimation();
 
 		static void
 		applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha, MixBlend pose,
-							Vector<float> &timelinesRotation, size_t i, bool firstFrame);
+							Vector<float> &timelinesRotation, size_t i, bool firstFrame, size_t *cursor);
 
 		void applyAttachmentTimeline(AttachmentTimeline *attachmentTimeline, Skeleton &skeleton, float animationTime,
-									 MixBlend pose, bool firstFrame);
+									 MixBlend pose, bool firstFrame, size_t *cursor);
 
 		/// Returns true when all mixing from entries are complete.
 		bool updateMixingFrom(TrackEntry *to, float delta);
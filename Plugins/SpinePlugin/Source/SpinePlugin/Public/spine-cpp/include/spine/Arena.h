@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_Arena_h
+#define Spine_Arena_h
+
+#include <spine/Extension.h>
+
+namespace spine {
+	/// A bump allocator owning a list of memory blocks. While an arena is current on a thread, see ArenaScope, all spine
+	/// allocations made by that thread are taken from it, provided the SpineExtension instance is an ArenaExtension.
+	/// Freeing arena memory is a no-op, all of it is released at once when the arena is destroyed. An arena must
+	/// therefore outlive every object allocated from it.
+	class SP_API Arena {
+		friend class ArenaExtension;
+
+		friend class ArenaScope;
+
+	public:
+		Arena();
+
+		~Arena();
+
+		/// The number of allocations served by this arena.
+		size_t getAllocationCount();
+
+		/// The number of blocks allocated from the underlying extension.
+		size_t getBlockCount();
+
+		/// The number of bytes allocated from the underlying extension.
+		size_t getBlockBytes();
+
+		/// The number of bytes handed out, including allocation headers.
+		size_t getUsedBytes();
+
+		/// Sizes the next block to hold the given number of bytes, e.g. the getUsedBytes() of a similar arena, so the
+		/// expected allocations fit a single block.
+		void reserve(size_t bytes);
+
+	private:
+		struct Block {
+			Block *next;
+			size_t size;
+			size_t used;
+		};
+
+		Block *_blocks;
+		SpineExtension *_blockAllocator;
+		size_t _reserve;
+		size_t _allocationCount;
+		size_t _blockCount;
+		size_t _blockBytes;
+		size_t _usedBytes;
+
+		Arena(const Arena &);
+
+		Arena &operator=(const Arena &);
+
+		void *alloc(size_t size, SpineExtension &blockAllocator);
+
+		bool grow(void *ptr, size_t size);
+
+		static void releaseBlocks(Block *blocks, SpineExtension *blockAllocator);
+
+		static size_t getSize(void *ptr);
+
+		bool owns(void *ptr);
+
+		static bool contains(void *ptr);
+	};
+
+	/// Makes an arena current on the calling thread for the lifetime of the scope, restoring the previous one afterwards.
+	/// Passing NULL suspends arena allocation, e.g. for objects that may outlive the arena.
+	class SP_API ArenaScope {
+	public:
+		explicit ArenaScope(Arena *arena);
+
+		~ArenaScope();
+
+	private:
+		Arena *_arena;
+		Arena *_previous;
+	};
+
+	/// Wraps another extension, serving allocations from the calling thread's current Arena if there is one and passing
+	/// everything else through. Reallocating arena memory moves it to the current arena, or to the wrapped extension if
+	/// no arena is current. Memory from the wrapped extension is never moved into an arena.
+	class SP_API ArenaExtension : public SpineExtension {
+	public:
+		explicit ArenaExtension(SpineExtension *extension);
+
+		virtual ~ArenaExtension();
+
+	protected:
+		virtual void *_alloc(size_t size, const char *file, int line);
+
+		virtual void *_calloc(size_t size, const char *file, int line);
+
+		virtual void *_realloc(void *ptr, size_t size, const char *file, int line);
+
+		virtual void _free(void *mem, const char *file, int line);
+
+		virtual char *_readFile(const String &path, int *length);
+
+		virtual void _beforeFree(void *ptr);
+
+	private:
+		SpineExtension *_extension;
+	};
+}
+
+#endif /* Spine_Arena_h */
@@ -75,11 +75,12 @@ namespace spine {
 		TextureWrap vWrap;
 		int width, height;
 		bool pma;
+		int index; // Position in the atlas' pages, so renderers can look up per page data by index.
 
 		explicit AtlasPage(const String &inName) : name(inName), format(Format_RGBA8888),
 												   minFilter(TextureFilter_Nearest),
 												   magFilter(TextureFilter_Nearest), uWrap(TextureWrap_ClampToEdge),
-												   vWrap(TextureWrap_ClampToEdge), width(0), height(0), pma(false) {
+												   vWrap(TextureWrap_ClampToEdge), width(0), height(0), pma(false), index(-1) {
 		}
 	};
 
@@ -57,9 +57,11 @@ namespace spine {
 
 		virtual ~AttachmentTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, const String &attachmentName);
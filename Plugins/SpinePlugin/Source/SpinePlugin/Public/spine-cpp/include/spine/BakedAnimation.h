@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Animation;
+
+	class Attachment;
+
+	class Skin;
+
+	/// An attachment drawn by a baked animation, identified by its slot and its name in the skin.
+	struct SP_API BakedAttachment {
+		int slotIndex;
+		String name;
+		int vertexCount;
+	};
+
+	/// One attachment drawn in a frame of a baked animation, in draw order.
+	struct SP_API BakedPart {
+		int attachmentIndex;
+		/// The slot color multiplied by the attachment color, as RGBA8888.
+		unsigned int color;
+		/// The slot's dark color as RGB888, 0 if the slot has none.
+		unsigned int darkColor;
+		/// Index of the part's first vertex in the frame data.
+		int firstVertex;
+	};
+
+	/// The world vertices, colors and draw order of an animation sampled at a fixed frame rate, so it can be played back
+	/// without evaluating bones. Vertex positions are quantized to 16 bits within the bounds of the whole animation. Clipping
+	/// attachments are not applied.
+	class SP_API BakedAnimation : public SpineObject {
+	public:
+		BakedAnimation();
+
+		/// Samples the animation with the given skin, or the default skin if none is given, by applying it through an
+		/// AnimationState to a skeleton in its setup pose. Returns NULL if the animation or skin is not part of the data.
+		static BakedAnimation *bake(SkeletonData &skeletonData, Animation &animation, float frameRate, Skin *skin = NULL);
+
+		/// Reads a baked animation written by write(). Returns NULL if the data is not a baked animation.
+		static BakedAnimation *read(const unsigned char *data, size_t length);
+
+		void write(Vector<unsigned char> &output);
+
+		/// Finds the attachments the parts refer to in the skin the animation was baked with, or the default skin. Attachments
+		/// that are not found are NULL.
+		void resolveAttachments(SkeletonData &skeletonData, Vector<Attachment *> &attachments);
+
+		const String &getName();
+
+		/// The name of the skin the animation was baked with, empty for the default skin.
+		const String &getSkinName();
+
+		float getDuration();
+
+		float getFrameRate();
+
+		int getFrameCount();
+
+		/// Returns the frame shown at the given time. Loops, or clamps to the last frame.
+		int getFrame(float time, bool loop);
+
+		Vector<BakedAttachment> &getAttachments();
+
+		int getPartCount(int frame);
+
+		BakedPart &getPart(int frame, int index);
+
+		/// Writes the part's world vertices as x,y pairs.
+		void computeWorldVertices(BakedPart &part, float *worldVertices);
+
+		/// Bytes used by the frames, attachments and parts.
+		size_t getMemorySize();
+
+	private:
+		String _name;
+		String _skinName;
+		float _duration;
+		float _frameRate;
+		float _minX, _minY, _scaleX, _scaleY;
+		Vector<BakedAttachment> _attachments;
+		/// Index of each frame's first part, followed by the total number of parts.
+		Vector<int> _frames;
+		Vector<BakedPart> _parts;
+		Vector<unsigned short> _vertices;
+	};
+}
+
+#endif /* Spine_BakedAnimation_h */
@@ -39,6 +39,8 @@ namespace spine {
 	class SP_API BoneData : public SpineObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class AnimationState;
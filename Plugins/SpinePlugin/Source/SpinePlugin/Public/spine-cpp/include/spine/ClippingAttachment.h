@@ -39,6 +39,8 @@ namespace spine {
 	class SP_API ClippingAttachment : public VertexAttachment {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class SkeletonClipping;
@@ -56,9 +58,16 @@ namespace spine {
 
 		virtual Attachment *copy();
 
+		/// Decomposes the clipping polygon into convex polygons in bone local space, so clipping only has to transform them
+		/// instead of triangulating the polygon every frame. Must be called after the vertices are changed. Weighted
+		/// clipping attachments are not decomposed up front.
+		void updateConvexPolygons();
+
 	private:
 		SlotData *_endSlot;
 		Color _color;
+		Vector<float> _convexPolygons; // Clockwise local vertices of all convex polygons.
+		Vector<size_t> _convexPolygonEnds; // End offset in _convexPolygons per convex polygon.
 	};
 }
 
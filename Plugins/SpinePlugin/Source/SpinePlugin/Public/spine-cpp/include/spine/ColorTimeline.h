@@ -45,9 +45,11 @@ namespace spine {
 
 		virtual ~RGBATimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b, float a);
@@ -78,9 +80,11 @@ namespace spine {
 
 		virtual ~RGBTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b);
@@ -110,9 +114,11 @@ namespace spine {
 
 		virtual ~AlphaTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getSlotIndex() { return _slotIndex; };
 
@@ -134,9 +140,11 @@ namespace spine {
 
 		virtual ~RGBA2Timeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b, float a, float r2, float g2, float b2);
@@ -170,9 +178,11 @@ namespace spine {
 
 		virtual ~RGB2Timeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b, float r2, float g2, float b2);
@@ -36,6 +36,8 @@
 namespace spine {
 	/// Base class for frames that use an interpolation bezier curve.
 	class SP_API CurveTimeline : public Timeline {
+		friend class SkeletonCooked;
+
 	RTTI_DECL
 
 	public:
@@ -53,8 +55,27 @@ namespace spine {
 
 		float getBezierValue(float time, size_t frame, size_t valueOffset, size_t i);
 
+		/// Marks a timeline constructed with a bezier count of 0 as having quantized beziers. setBezier() then only sets the
+		/// curve type of the frame, and setQuantizedBeziers() sets the curves once all are known.
+		void setQuantized(bool quantized);
+
+		bool isQuantized();
+
+		/// Sets the beziers of a timeline marked by setQuantized(). The cx1, cy1, cx2, cy2 of each bezier, with x relative to the bezier's frames (0 to 1), are
+		/// stored in 16 bits each instead of as BEZIER_SIZE floats of samples, y relative to the range of the y values, and
+		/// the samples are computed when the curve is applied. See SkeletonBinary::setQuantizeCurves().
+		void setQuantizedBeziers(Vector<float> &controls);
+
 		Vector<float> &getCurves();
 
+		/// The cx1, cy1, cx2, cy2 of each bezier when quantized, see setQuantizedBeziers(). x is relative to the bezier's
+		/// frames, y is getQuantizedMin() + value * getQuantizedScale().
+		Vector<unsigned short> &getQuantizedCurves();
+
+		float getQuantizedMin();
+
+		float getQuantizedScale();
+
 	protected:
 		static const int LINEAR = 0;
 		static const int STEPPED = 1;
@@ -62,6 +83,11 @@ namespace spine {
 		static const int BEZIER_SIZE = 18;
 
 		Vector<float> _curves; // type, x, y, ...
+		Vector<unsigned short> _quantizedCurves; // cx1, cy1, cx2, cy2, ...
+		float _quantizedMin, _quantizedScale;
+		bool _quantized;
+
+		float getQuantizedBezierValue(float time, float time1, float value1, float time2, float value2, size_t bezier);
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -74,7 +100,8 @@ namespace spine {
 
 		void setFrame(size_t frame, float time, float value);
 
-		float getCurveValue(float time);
+		/// @param cursor See Timeline::searchFrame(). May be NULL.
+		float getCurveValue(float time, size_t *cursor);
 
 	protected:
 		static const int ENTRIES = 2;
@@ -45,9 +45,11 @@ namespace spine {
 	public:
 		explicit DeformTimeline(size_t frameCount, size_t bezierCount, int slotIndex, VertexAttachment *attachment);
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frameIndex, float time, Vector<float> &vertices);
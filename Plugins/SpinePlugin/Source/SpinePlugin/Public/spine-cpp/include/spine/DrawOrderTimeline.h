@@ -43,9 +43,11 @@ namespace spine {
 	public:
 		explicit DrawOrderTimeline(size_t frameCount);
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		/// @param drawOrder May be NULL to use bind pose draw order
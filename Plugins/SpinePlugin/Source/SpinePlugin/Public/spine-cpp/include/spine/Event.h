@@ -40,6 +40,8 @@ namespace spine {
 	class SP_API Event : public SpineObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class AnimationState;
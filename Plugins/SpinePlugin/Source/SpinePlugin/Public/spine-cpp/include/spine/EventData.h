@@ -38,6 +38,8 @@ namespace spine {
 	class SP_API EventData : public SpineObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class Event;
@@ -45,9 +45,11 @@ namespace spine {
 
 		~EventTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(size_t frame, Event *event);
@@ -40,6 +40,52 @@
 #endif
 
 namespace spine {
+	/// Hash functor used by HashMap. Integral and pointer keys are mixed directly,
+	/// any other key type must provide a size_t hashCode() const member that is
+	/// consistent with its operator==.
+	template<typename K>
+	struct HashMapHash {
+		static size_t hash(const K &key) {
+			return key.hashCode();
+		}
+	};
+
+	inline size_t hashMapMix(unsigned long long h) {
+		// fmix64 finalizer from MurmurHash3, spreads sequential ids across buckets.
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+		return (size_t) h;
+	}
+
+#define SPINE_HASHMAP_INTEGRAL_HASH(type) \
+	template<> \
+	struct HashMapHash<type> { \
+		static size_t hash(const type &key) { return hashMapMix((unsigned long long) key); } \
+	};
+
+	SPINE_HASHMAP_INTEGRAL_HASH(int)
+	SPINE_HASHMAP_INTEGRAL_HASH(unsigned int)
+	SPINE_HASHMAP_INTEGRAL_HASH(long)
+	SPINE_HASHMAP_INTEGRAL_HASH(unsigned long)
+	SPINE_HASHMAP_INTEGRAL_HASH(long long)
+	SPINE_HASHMAP_INTEGRAL_HASH(unsigned long long)
+
+#undef SPINE_HASHMAP_INTEGRAL_HASH
+
+	template<typename T>
+	struct HashMapHash<T *> {
+		static size_t hash(T *const &key) {
+			return hashMapMix((unsigned long long) (size_t) key);
+		}
+	};
+
+	/// Open addressing hash map with linear probing. All entries live in a single
+	/// contiguous slot array whose capacity is a power of two; clear() keeps the
+	/// array so maps that are refilled every frame do not allocate. Removal uses
+	/// backward shift deletion, so there are no tombstones.
 	template<typename K, typename V>
 	class SP_API HashMap : public SpineObject {
 	private:
@@ -58,47 +104,52 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(Entry *entries, size_t capacity) : _hasChecked(false), _entry(entries), _end(entries + capacity) {
+				skipUnused();
 			}
 
 			Pair next() {
-				assert(_entry);
+				assert(_entry < _end);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				Entry *entry = _entry++;
+				skipUnused();
 				_hasChecked = false;
-				return pair;
+				return Pair(entry->_key, entry->_value);
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				return _entry < _end;
 			}
 
 		private:
+			void skipUnused() {
+				while (_entry < _end && !_entry->_used) _entry++;
+			}
+
 			bool _hasChecked;
-			Entry _start;
 			Entry *_entry;
+			Entry *_end;
 		};
 
 		HashMap() :
-				_head(NULL),
+				_entries(NULL),
+				_capacity(0),
 				_size(0) {
 		}
 
 		~HashMap() {
-			clear();
+			if (_entries) {
+				destroyEntries(_entries, _capacity);
+				SpineExtension::free(_entries, __FILE__, __LINE__);
+			}
 		}
 
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
+			if (_size == 0) return;
+			for (size_t i = 0; i < _capacity; i++) {
+				_entries[i]._used = false;
 			}
-			_head = NULL;
 			_size = 0;
 		}
 
@@ -107,32 +158,14 @@ namespace spine {
 		}
 
 		void put(const K &key, const V &value) {
-			Entry *entry = find(key);
-			if (entry) {
-				entry->_key = key;
-				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
-				_size++;
-			}
+			putEntry(key, value);
 		}
 
 		bool addAll(Vector <K> &keys, const V &value) {
 			size_t oldSize = _size;
+			ensureCapacity(_size + keys.size());
 			for (size_t i = 0; i < keys.size(); i++) {
-				put(keys[i], value);
+				putEntry(keys[i], value);
 			}
 			return _size != oldSize;
 		}
@@ -145,14 +178,22 @@ namespace spine {
 			Entry *entry = find(key);
 			if (!entry) return false;
 
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			size_t mask = _capacity - 1;
+			size_t hole = (size_t) (entry - _entries);
+			size_t i = hole;
+			for (;;) {
+				i = (i + 1) & mask;
+				Entry &candidate = _entries[i];
+				if (!candidate._used) break;
+				// Move the candidate into the hole unless its home bucket lies
+				// cyclically within (hole, i], in which case it must stay put.
+				size_t home = HashMapHash<K>::hash(candidate._key) & mask;
+				if (hole <= i ? (hole < home && home <= i) : (hole < home || home <= i)) continue;
+				_entries[hole]._key = candidate._key;
+				_entries[hole]._value = candidate._value;
+				hole = i;
+			}
+			_entries[hole]._used = false;
 			_size--;
 
 			return true;
@@ -168,29 +209,81 @@ namespace spine {
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(_entries, _capacity);
 		}
 
 	private:
 		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+			if (_size == 0) return NULL;
+			size_t mask = _capacity - 1;
+			for (size_t i = HashMapHash<K>::hash(key) & mask;; i = (i + 1) & mask) {
+				Entry *entry = _entries + i;
+				if (!entry->_used) return NULL;
+				if (entry->_key == key) return entry;
+			}
+		}
+
+		bool putEntry(const K &key, const V &value) {
+			ensureCapacity(_size + 1);
+			size_t mask = _capacity - 1;
+			for (size_t i = HashMapHash<K>::hash(key) & mask;; i = (i + 1) & mask) {
+				Entry &entry = _entries[i];
+				if (!entry._used) {
+					entry._key = key;
+					entry._value = value;
+					entry._used = true;
+					_size++;
+					return true;
+				}
+				if (entry._key == key) {
+					entry._key = key;
+					entry._value = value;
+					return false;
+				}
+			}
+		}
+
+		// Keeps the load factor at or below 1/2 so probe sequences stay short.
+		void ensureCapacity(size_t size) {
+			if (size * 2 <= _capacity) return;
+			size_t newCapacity = _capacity ? _capacity : 16;
+			while (size * 2 > newCapacity) newCapacity <<= 1;
+
+			Entry *oldEntries = _entries;
+			size_t oldCapacity = _capacity;
+			_entries = SpineExtension::alloc<Entry>(newCapacity, __FILE__, __LINE__);
+			for (size_t i = 0; i < newCapacity; i++) {
+				new(_entries + i) Entry();
+			}
+			_capacity = newCapacity;
+			_size = 0;
+
+			if (oldEntries) {
+				for (size_t i = 0; i < oldCapacity; i++) {
+					if (oldEntries[i]._used) putEntry(oldEntries[i]._key, oldEntries[i]._value);
+				}
+				destroyEntries(oldEntries, oldCapacity);
+				SpineExtension::free(oldEntries, __FILE__, __LINE__);
+			}
+		}
+
+		static void destroyEntries(Entry *entries, size_t capacity) {
+			for (size_t i = 0; i < capacity; i++) {
+				entries[i].~Entry();
 			}
-			return NULL;
 		}
 
-		class SP_API Entry : public SpineObject {
+		class SP_API Entry {
 		public:
 			K _key;
 			V _value;
-			Entry *next;
-			Entry *prev;
+			bool _used;
 
-			Entry() : next(NULL), prev(NULL) {}
+			Entry() : _key(), _value(), _used(false) {}
 		};
 
-		Entry *_head;
+		Entry *_entries;
+		size_t _capacity;
 		size_t _size;
 	};
 }
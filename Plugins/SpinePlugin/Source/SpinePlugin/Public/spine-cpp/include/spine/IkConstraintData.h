@@ -41,6 +41,8 @@ namespace spine {
 	class SP_API IkConstraintData : public ConstraintData {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class IkConstraint;
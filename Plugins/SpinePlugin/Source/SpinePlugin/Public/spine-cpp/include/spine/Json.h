@@ -38,6 +38,10 @@
 #endif
 
 namespace spine {
+	class Arena;
+
+	class String;
+
 	class SP_API Json : public SpineObject {
 		friend class SkeletonJson;
 
@@ -64,10 +68,17 @@ namespace spine {
 
 		static bool getBoolean(Json *object, const char *name, bool defaultValue);
 
+		/* Finds the string member "name" of the member "object" of the top level object without building nodes, e.g. the
+		 * version of a skeleton export. Members before it are skipped, so this is cheap when it comes first. Case
+		 * insensitive, returns false if not found or if the text before it is malformed. */
+		static bool peekString(const char *value, const char *object, const char *name, String &result);
+
 		/* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when Json_create() returns 0. 0 when Json_create() succeeds. */
 		static const char *getError();
 
-		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. */
+		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished.
+		 * If the SpineExtension is an ArenaExtension, all nodes and strings are allocated from an arena owned by this
+		 * object and released at once with it. */
 		explicit Json(const char *value);
 
 		~Json();
@@ -91,6 +102,8 @@ namespace spine {
 
 		const char *_name; /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
 
+		Arena *_arena; /* The arena holding the nodes below the root, if any. Only set on the root. */
+
 		/* Utility to jump whitespace and cr/lf */
 		static const char *skip(const char *inValue);
 
@@ -109,6 +122,13 @@ namespace spine {
 		/* Build an object from the text. */
 		static const char *parseObject(Json *item, const char *value);
 
+		/* Skip a value or a string without building nodes. */
+		static const char *skipValue(const char *value);
+
+		static const char *skipString(const char *str);
+
+		static bool nameEquals(const char *str, const char *name);
+
 		static int json_strcasecmp(const char *s1, const char *s2);
 	};
 }
@@ -40,6 +40,8 @@ namespace spine {
 	class SP_API MeshAttachment : public VertexAttachment, public HasRendererObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class AtlasAttachmentLoader;
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+#include <assert.h>
+#include <string.h>
+
+namespace spine {
+	/// Maps the names of a vector's items to their indices, so finding an item by name hashes the name instead of comparing
+	/// it against every item. Lookups take a plain C string and do not allocate. If the vector has changed size since the
+	/// index was last updated, lookups fall back to a linear scan. Like the linear scan, the first item with a name wins.
+	class SP_API NameIndex : public SpineObject {
+	public:
+		NameIndex() : _count(0) {
+		}
+
+		template<typename T>
+		void update(Vector<T *> &items) {
+			size_t capacity = 16;
+			while (capacity < items.size() * 2) capacity <<= 1;
+			_buckets.setSize(capacity, -1);
+			for (size_t i = 0; i < capacity; i++) _buckets[i] = -1;
+
+			size_t mask = capacity - 1;
+			for (size_t i = 0, n = items.size(); i < n; i++) {
+				if (!items[i]) continue;
+				const String &name = items[i]->getName();
+				for (size_t b = hash(name.buffer(), name.length()) & mask;; b = (b + 1) & mask) {
+					int index = _buckets[b];
+					if (index == -1) {
+						_buckets[b] = (int) i;
+						break;
+					}
+					if (items[index]->getName() == name) break;
+				}
+			}
+			_count = items.size();
+		}
+
+		/// @return -1 if no item has the name.
+		template<typename T>
+		int find(Vector<T *> &items, const char *name) {
+			assert(name && name[0]);
+			if (!name) return -1;
+			size_t length = strlen(name);
+			if (_buckets.size() == 0 || _count != items.size()) {
+				for (size_t i = 0, n = items.size(); i < n; i++)
+					if (items[i] && equals(items[i]->getName(), name, length)) return (int) i;
+				return -1;
+			}
+
+			size_t mask = _buckets.size() - 1;
+			for (size_t b = hash(name, length) & mask;; b = (b + 1) & mask) {
+				int index = _buckets[b];
+				if (index == -1) return -1;
+				if (equals(items[index]->getName(), name, length)) return index;
+			}
+		}
+
+	private:
+		Vector<int> _buckets;
+		size_t _count;
+
+		/// Same FNV-1a hash as String::hashCode().
+		static size_t hash(const char *name, size_t length) {
+			size_t hash = (size_t) 2166136261u;
+			for (size_t i = 0; i < length; i++) {
+				hash ^= (unsigned char) name[i];
+				hash *= (size_t) 16777619u;
+			}
+			return hash;
+		}
+
+		static bool equals(const String &a, const char *b, size_t length) {
+			return a.length() == length && memcmp(a.buffer(), b, length) == 0;
+		}
+	};
+}
+
+#endif /* Spine_NameIndex_h */
@@ -37,6 +37,8 @@ namespace spine {
 	class SP_API PathAttachment : public VertexAttachment {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 	RTTI_DECL
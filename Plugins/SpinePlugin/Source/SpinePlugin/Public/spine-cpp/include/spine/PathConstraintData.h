@@ -46,6 +46,8 @@ namespace spine {
 	class SP_API PathConstraintData : public ConstraintData {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class PathConstraint;
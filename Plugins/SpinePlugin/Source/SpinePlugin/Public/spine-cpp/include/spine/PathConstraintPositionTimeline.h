@@ -48,9 +48,11 @@ namespace spine {
 
 		virtual ~PathConstraintPositionTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getPathConstraintIndex() { return _pathConstraintIndex; }
 
@@ -45,6 +45,8 @@ namespace spine {
 	class SP_API PointAttachment : public Attachment {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 	RTTI_DECL
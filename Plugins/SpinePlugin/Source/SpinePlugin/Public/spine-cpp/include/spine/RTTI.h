@@ -32,18 +32,38 @@
 
 #include <spine/dll.h>
 
+#include <stddef.h>
+
 namespace spine {
+	/// Every class using RTTI_DECL owns exactly one static RTTI instance, so the
+	/// address of that instance is the class identity. Comparing addresses instead
+	/// of class names keeps isExactly() a single compare and instanceOf() a short
+	/// pointer walk up the (at most a few levels deep) parent chain.
+	///
+	/// The constructors are constexpr so the static instances are constant-initialized
+	/// and can be queried during static initialization of other translation units.
 	class SP_API RTTI {
 	public:
-		explicit RTTI(const char *className);
+		explicit constexpr RTTI(const char *className) : _className(className), _pBaseRTTI(NULL) {
+		}
 
-		RTTI(const char *className, const RTTI &baseRTTI);
+		constexpr RTTI(const char *className, const RTTI &baseRTTI) : _className(className), _pBaseRTTI(&baseRTTI) {
+		}
 
 		const char *getClassName() const;
 
-		bool isExactly(const RTTI &rtti) const;
+		bool isExactly(const RTTI &rtti) const {
+			return this == &rtti;
+		}
 
-		bool instanceOf(const RTTI &rtti) const;
+		bool instanceOf(const RTTI &rtti) const {
+			const RTTI *pCompare = this;
+			do {
+				if (pCompare == &rtti) return true;
+				pCompare = pCompare->_pBaseRTTI;
+			} while (pCompare);
+			return false;
+		}
 
 	private:
 		// Prevent copying
@@ -45,6 +45,8 @@ namespace spine {
 	class SP_API RegionAttachment : public Attachment, public HasRendererObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class AtlasAttachmentLoader;
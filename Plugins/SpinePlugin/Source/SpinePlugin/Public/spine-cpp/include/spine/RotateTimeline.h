@@ -45,9 +45,11 @@ namespace spine {
 	public:
 		explicit RotateTimeline(size_t frameCount, size_t bezierCount, int boneIndex);
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
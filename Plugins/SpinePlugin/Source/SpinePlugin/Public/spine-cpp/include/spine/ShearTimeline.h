@@ -45,9 +45,11 @@ namespace spine {
 
 		virtual ~ShearTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
@@ -69,9 +71,11 @@ namespace spine {
 
 		virtual ~ShearXTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
@@ -93,9 +97,11 @@ namespace spine {
 
 		virtual ~ShearYTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
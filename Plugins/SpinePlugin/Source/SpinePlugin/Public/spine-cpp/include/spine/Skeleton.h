@@ -35,6 +35,7 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/Color.h>
+#include <spine/Arena.h>
 
 namespace spine {
 	class SkeletonData;
@@ -128,6 +129,35 @@ namespace spine {
 
 		void updateWorldTransform(Bone *parent);
 
+		/// When enabled, consecutive update cache entries that are child bones using TransformMode_Normal are updated
+		/// as a batch from a structure-of-arrays pose buffer: their local matrices are computed in one independent
+		/// loop and then composed with their parents in update cache order, instead of one virtual Bone::update() call
+		/// per bone. Constraints and bones using other transform modes still run in their update cache position.
+		/// Local rotations use MathUtil::sinCosDeg, so world transforms match Bone::update() to within float precision.
+		/// Disabled by default.
+		void setUsePoseBuffer(bool inValue);
+
+		bool getUsePoseBuffer();
+
+		/// Returns a counter that changes whenever what is rendered may have changed: on every updateWorldTransform(), when a
+		/// slot's attachment is changed or when the slots are set to the setup pose. With setComparePoses(), an
+		/// updateWorldTransform() only changes it if the bone world transforms, slot attachments, slot colors, deforms, draw
+		/// order or skeleton color differ from the previous call. Versions are unique across all skeletons, so a new skeleton
+		/// never has the version of a deleted one. Renderers can skip rebuilding their geometry while it is unchanged.
+		size_t getPoseVersion();
+
+		/// Changes the pose version, for changes that are not followed by updateWorldTransform(), e.g. setting a slot color
+		/// on a skeleton that is not animated.
+		void incrementPoseVersion();
+
+		/// When true, updateWorldTransform() compares the pose to a copy of the previous one and only changes the pose version
+		/// if they differ. The copy and comparison cost about as much as the world transforms, so this pays off only for
+		/// skeletons that are often idle, e.g. paused or holding a static pose, whose renderers then skip rebuilding.
+		/// Disabled by default.
+		void setComparePoses(bool inValue);
+
+		bool getComparePoses();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -139,9 +169,15 @@ namespace spine {
 		/// @return May be NULL.
 		Bone *findBone(const String &boneName);
 
+		/// @return May be NULL.
+		Bone *findBone(const char *boneName);
+
 		/// @return May be NULL.
 		Slot *findSlot(const String &slotName);
 
+		/// @return May be NULL.
+		Slot *findSlot(const char *slotName);
+
 		/// Sets a skin by name (see setSkin).
 		void setSkin(const String &skinName);
 
@@ -227,6 +263,7 @@ namespace spine {
 		void setScaleY(float inValue);
 
 	private:
+		Arena _arena; // Declared first so it is destroyed after all other members.
 		SkeletonData *_data;
 		Vector<Bone *> _bones;
 		Vector<Slot *> _slots;
@@ -235,6 +272,13 @@ namespace spine {
 		Vector<TransformConstraint *> _transformConstraints;
 		Vector<PathConstraint *> _pathConstraints;
 		Vector<Updatable *> _updateCache;
+		bool _usePoseBuffer;
+		Vector<size_t> _poseRuns; // [start, end) update cache index pairs of batched bones.
+		Vector<float> _poseX, _poseY, _poseA, _poseB, _poseC, _poseD; // Applied local transform per batched bone.
+		size_t _poseVersion;
+		bool _comparePoses;
+		Vector<float> _poseSnapshot; // World transforms, colors and deforms of the last updateWorldTransform().
+		Vector<void *> _poseSnapshotObjects; // Draw order slots and their attachments of the last updateWorldTransform().
 		Skin *_skin;
 		Color _color;
 		float _time;
@@ -253,6 +297,12 @@ namespace spine {
 
 		void sortBone(Bone *bone);
 
+		void updatePoseRuns();
+
+		void updateBoneRun(size_t start, size_t end);
+
+		void updatePoseVersion();
+
 		static void sortReset(Vector<Bone *> &bones);
 	};
 }
@@ -61,6 +61,8 @@ namespace spine {
 
 	class CurveTimeline2;
 
+	class ParallelRunner;
+
 	class SP_API SkeletonBinary : public SpineObject {
 	public:
 		static const int BONE_ROTATE = 0;
@@ -101,6 +103,26 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// When true, the skeleton data and the skeletons created from it allocate from arenas, which is faster to load and
+		/// instantiate and releases memory in a few blocks. Requires the SpineExtension to be an ArenaExtension.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		/// When set, animations are decoded by jobs run on the runner, after a first pass finds where each animation
+		/// starts. The animations are split into jobs by size only, so the result doesn't depend on the runner. The runner
+		/// is not owned. NULL, the default, decodes the animations one after another.
+		void setParallelRunner(ParallelRunner *runner) { _parallelRunner = runner; }
+
+		/// When true, the animations are read as stubs holding their name, duration and where their timelines start, and
+		/// the timelines are decoded the first time the animation is used, see Animation::load() and
+		/// SkeletonData::getAnimationCache(). The encoded timelines are kept by the SkeletonData. Default is false.
+		void setLazyAnimations(bool lazyAnimations) { _lazyAnimations = lazyAnimations; }
+
+		/// When true, the bezier curves of the timelines are stored as their control values quantized to 16 bits and are
+		/// evaluated when applied, instead of as BEZIER_SIZE floats of samples, see CurveTimeline::setQuantizedBeziers().
+		/// This takes 8 instead of 72 bytes per curve, for an error within about 1/40000 of the range of a timeline's values.
+		/// Default is false.
+		void setQuantizeCurves(bool quantizeCurves) { _quantizeCurves = quantizeCurves; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -109,11 +131,19 @@ namespace spine {
 			const unsigned char *end;
 		};
 
+		class LazyAnimationCache;
+
 		AttachmentLoader *_attachmentLoader;
 		Vector<LinkedMesh *> _linkedMeshes;
 		String _error;
 		float _scale;
 		const bool _ownsLoader;
+		bool _useArena;
+		ParallelRunner *_parallelRunner;
+		bool _lazyAnimations;
+		bool _quantizeCurves;
+		Vector<float> _bezierControls;
+		CurveTimeline *_bezierTimeline;
 
 		void setError(const char *value1, const char *value2);
 
@@ -135,6 +165,8 @@ namespace spine {
 
 		int readVarint(DataInput *input, bool optimizePositive);
 
+		int readBezierCount(DataInput *input);
+
 		Skin *readSkin(DataInput *input, bool defaultSkin, SkeletonData *skeletonData, bool nonessential);
 
 		Attachment *readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName,
@@ -148,6 +180,28 @@ namespace spine {
 
 		Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData);
 
+		int readAnimations(DataInput *input, int animationsCount, SkeletonData *skeletonData);
+
+		static void readAnimationsJob(void *context, int job);
+
+		int readLazyAnimations(DataInput *input, int animationsCount, SkeletonData *skeletonData);
+
+		static bool skipBytes(DataInput *input, size_t count);
+
+		static bool readCheckedByte(DataInput *input, unsigned char &value);
+
+		static bool readCheckedVarint(DataInput *input, bool optimizePositive, int &value);
+
+		static bool readCheckedCount(DataInput *input, int &count);
+
+		static bool skipString(DataInput *input);
+
+		bool skipFrames(DataInput *input, int frameCount, int frameSize, int valueCount, float &duration);
+
+		bool skipAnimation(DataInput *input, SkeletonData *skeletonData, float &duration);
+
+		void quantizeBeziers(CurveTimeline *next);
+
 		void
 		setBezier(DataInput *input, CurveTimeline *timeline, int bezier, int frame, int value, float time1, float time2,
 				  float value1, float value2, float scale);
@@ -42,6 +42,8 @@ namespace spine {
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
@@ -62,6 +64,9 @@ namespace spine {
 
 		Vector<float> &getClippedUVs();
 
+		/// Reverses the polygon if it is not clockwise.
+		static void makeClockwise(Vector<float> &polygon);
+
 	private:
 		Triangulator _triangulator;
 		Vector<float> _clippingPolygon;
@@ -72,13 +77,23 @@ namespace spine {
 		Vector<float> _scratch;
 		ClippingAttachment *_clipAttachment;
 		Vector<Vector<float> *> *_clippingPolygons;
+		Vector<Vector<float> *> _transformedPolygons; // The clip attachment's convex polygons in world space.
+		Vector<Vector<float> *> _polygonPool;
+		Vector<float> _clippingBounds; // minX, minY, maxX, maxY per clipping polygon.
+		float _minX, _minY, _maxX, _maxY;
+
+		void transformConvexPolygons(Slot &slot, ClippingAttachment *clip);
+
+		void updateBounds();
+
+		/// Returns true if the triangle lies entirely within the convex, clockwise clipping area, in which case clip() would
+		/// return false. The clipping area must duplicate the first vertex at the end of the vertices list.
+		static bool containsTriangle(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> &clippingArea);
 
 		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
 		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
 		bool clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 				  Vector<float> *output);
-
-		static void makeClockwise(Vector<float> &polygon);
 	};
 }
 
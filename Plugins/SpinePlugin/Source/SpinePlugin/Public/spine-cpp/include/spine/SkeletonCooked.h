@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonCooked_h
+#define Spine_SkeletonCooked_h
+
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Atlas;
+
+	class AttachmentLoader;
+
+	class Skin;
+
+	class Attachment;
+
+	class VertexAttachment;
+
+	class Animation;
+
+	class Timeline;
+
+	class CurveTimeline;
+
+	/// Reads and writes cooked skeleton data: a SkeletonData as it is after loading, with references stored as indices,
+	/// bezier curves, deform keys, skinning blocks and clipping polygons already computed, and every array stored as raw
+	/// values in native byte order. Reading it is mostly copying, there is nothing left to decode or resolve. Cooked data
+	/// is written from loaded skeleton data, with the scale it was loaded with, and can only be read by the same runtime
+	/// version on a platform with the same byte order and type sizes; readSkeletonData fails otherwise, so the caller can
+	/// fall back to the exported data.
+	class SP_API SkeletonCooked : public SpineObject {
+	public:
+		/// Changes with the order or meaning of what is written. The sizes the raw arrays depend on are checked separately,
+		/// see isCooked().
+		static const int VERSION = 3;
+
+		explicit SkeletonCooked(Atlas *atlas);
+
+		explicit SkeletonCooked(AttachmentLoader *attachmentLoader, bool ownsLoader = false);
+
+		~SkeletonCooked();
+
+		SkeletonData *readSkeletonData(const unsigned char *data, int length);
+
+		/// Appends the cooked form of the skeleton data to the output.
+		static void writeSkeletonData(SkeletonData &skeletonData, Vector<unsigned char> &output);
+
+		/// Returns true if the data starts like cooked data written by this runtime version, with the same byte order and
+		/// sizes of the stored types.
+		static bool isCooked(const unsigned char *data, int length);
+
+		/// See SkeletonBinary::setUseArena(). Cooked data records the arena size of the data it was written from, so the
+		/// data is usually read into a single block.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		String &getError() { return _error; }
+
+	private:
+		class DataInput;
+
+		class DataOutput;
+
+		static const int TIMELINE_ROTATE = 0;
+		static const int TIMELINE_TRANSLATE = 1;
+		static const int TIMELINE_TRANSLATEX = 2;
+		static const int TIMELINE_TRANSLATEY = 3;
+		static const int TIMELINE_SCALE = 4;
+		static const int TIMELINE_SCALEX = 5;
+		static const int TIMELINE_SCALEY = 6;
+		static const int TIMELINE_SHEAR = 7;
+		static const int TIMELINE_SHEARX = 8;
+		static const int TIMELINE_SHEARY = 9;
+		static const int TIMELINE_RGBA = 10;
+		static const int TIMELINE_RGB = 11;
+		static const int TIMELINE_RGBA2 = 12;
+		static const int TIMELINE_RGB2 = 13;
+		static const int TIMELINE_ALPHA = 14;
+		static const int TIMELINE_ATTACHMENT = 15;
+		static const int TIMELINE_DEFORM = 16;
+		static const int TIMELINE_DRAW_ORDER = 17;
+		static const int TIMELINE_EVENT = 18;
+		static const int TIMELINE_IK = 19;
+		static const int TIMELINE_TRANSFORM = 20;
+		static const int TIMELINE_PATH_POSITION = 21;
+		static const int TIMELINE_PATH_SPACING = 22;
+		static const int TIMELINE_PATH_MIX = 23;
+
+		AttachmentLoader *_attachmentLoader;
+		String _error;
+		const bool _ownsLoader;
+		bool _useArena;
+
+		void setError(const char *value1, const char *value2);
+
+		static unsigned int getLayout();
+
+		bool readSkins(DataInput &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments);
+
+		Attachment *readAttachment(DataInput &input, Skin &skin, SkeletonData *skeletonData);
+
+		/// Reads the vertices and skinning layout, failing the input unless every index stays within the arrays it is used on.
+		void readVertices(DataInput &input, VertexAttachment *attachment, SkeletonData *skeletonData);
+
+		Animation *readAnimation(DataInput &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments);
+
+		Timeline *readTimeline(DataInput &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments);
+
+		static void readCurves(DataInput &input, CurveTimeline *timeline);
+
+		static void writeSkins(DataOutput &output, SkeletonData &skeletonData, Vector<Attachment *> &attachments);
+
+		static void writeAttachment(DataOutput &output, Attachment *attachment, SkeletonData &skeletonData,
+									Vector<Attachment *> &attachments);
+
+		static void writeVertices(DataOutput &output, VertexAttachment *attachment);
+
+		static void writeAnimation(DataOutput &output, Animation *animation, SkeletonData &skeletonData,
+								   Vector<Attachment *> &attachments);
+
+		static void writeTimeline(DataOutput &output, Timeline *timeline, SkeletonData &skeletonData,
+								  Vector<Attachment *> &attachments);
+
+		static void writeCurves(DataOutput &output, int type, int index, CurveTimeline *timeline);
+
+		static void writeCurveArrays(DataOutput &output, CurveTimeline *timeline);
+	};
+}
+
+#endif /* Spine_SkeletonCooked_h */
@@ -32,6 +32,10 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/Arena.h>
+#include <spine/NameIndex.h>
+
+#include <atomic>
 
 namespace spine {
 	class BoneData;
@@ -44,6 +48,8 @@ namespace spine {
 
 	class Animation;
 
+	class AnimationCache;
+
 	class IkConstraintData;
 
 	class TransformConstraintData;
@@ -54,41 +60,74 @@ namespace spine {
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class Skeleton;
 
+		friend class AnimationStateData;
+
 	public:
 		SkeletonData();
 
 		~SkeletonData();
 
-		/// Finds a bone by comparing each bone's name.
-		/// It is more efficient to cache the results of this method than to call it multiple times.
+		/// Finds a bone by name, using the name index if it is up to date, see updateNameIndices().
 		/// @return May be NULL.
 		BoneData *findBone(const String &boneName);
 
+		BoneData *findBone(const char *boneName);
+
 		/// @return May be NULL.
 		SlotData *findSlot(const String &slotName);
 
+		SlotData *findSlot(const char *slotName);
+
 		/// @return May be NULL.
 		Skin *findSkin(const String &skinName);
 
+		Skin *findSkin(const char *skinName);
+
 		/// @return May be NULL.
 		spine::EventData *findEvent(const String &eventDataName);
 
+		spine::EventData *findEvent(const char *eventDataName);
+
+		/// Finds an animation by name, decoding its timelines if they were read lazily and are not decoded yet. The timelines
+		/// of an animation that is not retained may be released by another thread trimming the AnimationCache, so code
+		/// using them outside an AnimationState uses retainAnimation() instead.
 		/// @return May be NULL.
 		Animation *findAnimation(const String &animationName);
 
+		Animation *findAnimation(const char *animationName);
+
+		/// Finds an animation by name and retains it, see Animation::retain(). The caller releases it with
+		/// Animation::release() once done with its timelines.
+		/// @return May be NULL, if there is no such animation or its timelines could not be decoded.
+		Animation *retainAnimation(const String &animationName);
+
+		Animation *retainAnimation(const char *animationName);
+
 		/// @return May be NULL.
 		IkConstraintData *findIkConstraint(const String &constraintName);
 
+		IkConstraintData *findIkConstraint(const char *constraintName);
+
 		/// @return May be NULL.
 		TransformConstraintData *findTransformConstraint(const String &constraintName);
 
+		TransformConstraintData *findTransformConstraint(const char *constraintName);
+
 		/// @return May be NULL.
 		PathConstraintData *findPathConstraint(const String &constraintName);
 
+		PathConstraintData *findPathConstraint(const char *constraintName);
+
+		/// Indexes the names of the bones, slots, skins, events, animations and constraints, so the find methods do not have
+		/// to scan them. Must be called after any of these are added or removed. The loaders call it.
+		void updateNameIndices();
+
 		const String &getName();
 
 		void setName(const String &inValue);
@@ -110,8 +149,13 @@ namespace spine {
 
 		Vector<spine::EventData *> &getEvents();
 
+		/// The animations, whose timelines are not decoded yet if they were read lazily, see Animation::load().
 		Vector<Animation *> &getAnimations();
 
+		/// The cache decoding the timelines of animations read lazily, see SkeletonBinary::setLazyAnimations().
+		/// @return May be NULL.
+		AnimationCache *getAnimationCache();
+
 		Vector<IkConstraintData *> &getIkConstraints();
 
 		Vector<TransformConstraintData *> &getTransformConstraints();
@@ -156,7 +200,18 @@ namespace spine {
 
 		void setFps(float inValue);
 
+		/// Whether the data and the skeletons created from it allocate from arenas instead of individual heap allocations.
+		/// Set by the loader, see SkeletonJson::setUseArena() and SkeletonBinary::setUseArena().
+		bool getUseArena();
+
+		/// The arena holding the objects read by the loader. Empty unless getUseArena() is true.
+		Arena &getArena();
+
 	private:
+		Arena _arena; // Declared first so it is destroyed after all other members.
+		Vector<Arena *> _animationArenas; // Arenas of animations decoded in parallel, one per job.
+		bool _useArena;
+		std::atomic<size_t> _skeletonArenaBytes; // Arena bytes used by the largest skeleton so far, reserved by the next.
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
 		Vector<SlotData *> _slots; // Setup pose draw order.
@@ -164,9 +219,12 @@ namespace spine {
 		Skin *_defaultSkin;
 		Vector<EventData *> _events;
 		Vector<Animation *> _animations;
+		AnimationCache *_animationCache;
 		Vector<IkConstraintData *> _ikConstraints;
 		Vector<TransformConstraintData *> _transformConstraints;
 		Vector<PathConstraintData *> _pathConstraints;
+		NameIndex _boneIndex, _slotIndex, _skinIndex, _eventIndex, _animationIndex;
+		NameIndex _ikConstraintIndex, _transformConstraintIndex, _pathConstraintIndex;
 		float _x, _y, _width, _height;
 		String _version;
 		String _hash;
@@ -176,6 +234,9 @@ namespace spine {
 		float _fps;
 		String _imagesPath;
 		String _audioPath;
+
+		/// Finds an animation by name without decoding its timelines.
+		Animation *lookupAnimation(const char *animationName);
 	};
 }
 
@@ -59,6 +59,8 @@ namespace spine {
 
 	class String;
 
+	class ParallelRunner;
+
 	class SP_API SkeletonJson : public SpineObject {
 	public:
 		explicit SkeletonJson(Atlas *atlas);
@@ -73,6 +75,15 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// When true, the skeleton data and the skeletons created from it allocate from arenas, which is faster to load and
+		/// instantiate and releases memory in a few blocks. Requires the SpineExtension to be an ArenaExtension.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		/// When set, animations are decoded by jobs run on the runner, each job reading a range of the parsed animations.
+		/// The animations are split into jobs by size only, so the result doesn't depend on the runner. The runner is not
+		/// owned. NULL, the default, decodes the animations one after another.
+		void setParallelRunner(ParallelRunner *runner) { _parallelRunner = runner; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -80,6 +91,8 @@ namespace spine {
 		Vector<LinkedMesh *> _linkedMeshes;
 		float _scale;
 		const bool _ownsLoader;
+		bool _useArena;
+		ParallelRunner *_parallelRunner;
 		String _error;
 
 		static void
@@ -99,6 +112,12 @@ namespace spine {
 
 		Animation *readAnimation(Json *root, SkeletonData *skeletonData);
 
+		bool readAnimations(Json *animations, SkeletonData *skeletonData);
+
+		static void readAnimationsJob(void *context, int job);
+
+		static size_t countNodes(Json *json, int depth);
+
 		void readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength);
 
 		void setError(Json *root, const String &value1, const String &value2);
@@ -41,6 +41,8 @@ namespace spine {
 	class SP_API SlotData : public SpineObject {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class AttachmentTimeline;
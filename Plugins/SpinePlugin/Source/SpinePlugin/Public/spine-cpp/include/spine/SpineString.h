@@ -182,6 +182,16 @@ namespace spine {
 			return *this;
 		}
 
+		/// FNV-1a hash of the characters, consistent with operator==.
+		size_t hashCode() const {
+			size_t hash = (size_t) 2166136261u;
+			for (size_t i = 0; i < _length; i++) {
+				hash ^= (unsigned char) _buffer[i];
+				hash *= (size_t) 16777619u;
+			}
+			return hash;
+		}
+
 		friend bool operator==(const String &a, const String &b) {
 			if (a._buffer == b._buffer) return true;
 			if (a._length != b._length) return false;
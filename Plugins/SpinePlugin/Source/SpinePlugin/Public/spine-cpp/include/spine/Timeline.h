@@ -60,9 +60,17 @@ namespace spine {
 		///	time, an animation can be mixed in or out. alpha can also be useful to apply animations on top of each other (layered).
 		/// @param blend Controls how mixing is applied when alpha is than 1.
 		/// @param direction Indicates whether the timeline is mixing in or out. Used by timelines which perform instant transitions such as DrawOrderTimeline and AttachmentTimeline.
+		/// @param cursor The caller's frame cursor for this timeline, passed to searchFrame(). May be NULL.
+		/// Subclasses override this or, if they don't use a cursor, the overload without one. Each calls the other by default.
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction) = 0;
+			  MixDirection direction, size_t *cursor);
+
+		/// Sets the value(s) for the specified time without a frame cursor. Kept for timelines and callers written before
+		/// the cursor was added.
+		virtual void
+		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
+			  MixDirection direction);
 
 		size_t getFrameEntries();
 
@@ -72,6 +80,12 @@ namespace spine {
 
 		float getDuration();
 
+		/// Returns the index of the first entry of the frame at or before time. The result is identical to
+		/// Animation::search(getFrames(), time, getFrameEntries()). If cursor is not NULL, it holds the frame found by the
+		/// previous search for the same caller, e.g. the track entry playing this timeline. That frame is checked first and
+		/// the search advances from it, so monotonic playback costs O(1) per apply. The cursor is then set to the result.
+		int searchFrame(float time, size_t *cursor);
+
 		virtual Vector <PropertyId> &getPropertyIds();
 
 	protected:
@@ -41,6 +41,8 @@ namespace spine {
 	class SP_API TransformConstraintData : public ConstraintData {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class TransformConstraint;
@@ -49,9 +49,11 @@ namespace spine {
 
 		virtual ~TranslateTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
@@ -73,9 +75,11 @@ namespace spine {
 
 		virtual ~TranslateXTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
@@ -97,9 +101,11 @@ namespace spine {
 
 		virtual ~TranslateYTimeline();
 
+		using Timeline::apply;
+
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, size_t *cursor);
 
 		int getBoneIndex() { return _boneIndex; }
 
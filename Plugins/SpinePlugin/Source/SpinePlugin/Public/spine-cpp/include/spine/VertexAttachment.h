@@ -41,6 +41,8 @@ namespace spine {
 	class SP_API VertexAttachment : public Attachment {
 		friend class SkeletonBinary;
 
+		friend class SkeletonCooked;
+
 		friend class SkeletonJson;
 
 		friend class DeformTimeline;
@@ -85,6 +87,10 @@ namespace spine {
 
 		void copyTo(VertexAttachment *other);
 
+		/// Rebuilds the skinning layout used by computeWorldVertices for weighted vertices. The loaders call this
+		/// after reading the vertices; call it again after changing Bones or Vertices of a weighted attachment.
+		void updateSkinning();
+
 	protected:
 		Vector <size_t> _bones;
 		Vector<float> _vertices;
@@ -94,6 +100,15 @@ namespace spine {
 	private:
 		const int _id;
 
+		// Weighted vertices grouped by weight count into blocks of 4, see updateSkinning().
+		Vector <size_t> _skinBones; // Skeleton bone index of each bone referenced by _bones.
+		Vector<int> _skinBuckets; // Weight count and block count of each bucket.
+		Vector<int> _skinIndices; // Per block and weight: 4 bone matrix offsets, then 4 deform offsets.
+		Vector<float> _skinVertices; // Per block and weight: 4 x, 4 y, then 4 weights.
+		Vector<int> _skinOutputs; // Per block: 4 vertex indices, the last vertex is repeated to fill a block.
+
+		void computeSkinnedVertices(Slot &slot, float *worldVertices, size_t offset, size_t stride);
+
 		static int getNextID();
 	};
 }
@@ -31,14 +31,17 @@
 #define SPINE_SPINE_H_
 
 #include <spine/Animation.h>
+#include <spine/AnimationCache.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
+#include <spine/Arena.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BakedAnimation.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
@@ -66,6 +69,7 @@
 #include <spine/MeshAttachment.h>
 #include <spine/MixBlend.h>
 #include <spine/MixDirection.h>
+#include <spine/ParallelRunner.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraint.h>
 #include <spine/PathConstraintData.h>
@@ -85,6 +89,7 @@
 #include <spine/SkeletonBinary.h>
 #include <spine/SkeletonBounds.h>
 #include <spine/SkeletonClipping.h>
+#include <spine/SkeletonCooked.h>
 #include <spine/SkeletonData.h>
 #include <spine/SkeletonJson.h>
 #include <spine/Skin.h>
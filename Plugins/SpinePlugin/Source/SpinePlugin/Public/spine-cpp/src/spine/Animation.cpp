@@ -32,6 +32,7 @@
 #endif
 
 #include <spine/Animation.h>
+#include <spine/AnimationCache.h>
 #include <spine/Event.h>
 #include <spine/Skeleton.h>
 #include <spine/Timeline.h>
@@ -45,16 +46,20 @@ using namespace spine;
 Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
 																						  _timelineIds(),
 																						  _duration(duration),
-																						  _name(name) {
+																						  _name(name),
+																						  _cache(NULL),
+																						  _offset(0),
+																						  _loadedBytes(0),
+																						  _lastUse(0),
+																						  _users(0),
+																						  _loaded(true) {
 	assert(_name.length() > 0);
 	for (size_t i = 0; i < timelines.size(); i++) {
-		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
-		for (size_t ii = 0; ii < propertyIds.size(); ii++)
-			_timelineIds.put(propertyIds[ii], true);
+		_timelineIds.addAll(timelines[i]->getPropertyIds(), true);
 	}
 }
 
-bool Animation::hasTimeline(Vector<PropertyId> ids) {
+bool Animation::hasTimeline(Vector<PropertyId> &ids) {
 	for (size_t i = 0; i < ids.size(); i++) {
 		if (_timelineIds.containsKey(ids[i])) return true;
 	}
@@ -75,7 +80,7 @@ void Animation::apply(Skeleton &skeleton, float lastTime, float time, bool loop,
 	}
 
 	for (size_t i = 0, n = _timelines.size(); i < n; ++i) {
-		_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+		_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction, NULL);
 	}
 }
 
@@ -95,17 +100,44 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
-int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return i - 1;
+bool Animation::isLoaded() {
+	return _loaded;
+}
+
+bool Animation::load() {
+	return !_cache || _cache->load(*this, false);
+}
+
+bool Animation::retain() {
+	return !_cache || _cache->load(*this, true);
+}
+
+void Animation::release() {
+	if (_cache) _cache->release(*this);
+}
+
+void Animation::setTimelines(Vector<Timeline *> &timelines) {
+	ContainerUtil::cleanUpVectorOfPointers(_timelines);
+	_timelineIds.clear();
+	_timelines.addAll(timelines);
+	for (size_t i = 0; i < timelines.size(); i++) {
+		_timelineIds.addAll(timelines[i]->getPropertyIds(), true);
 	}
-	return n - 1;
+}
+
+int Animation::search(Vector<float> &frames, float target) {
+	return search(frames, target, 1);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return i - step;
-	return n - step;
+	// Find the first frame after frame 0 whose time is greater than target.
+	float *values = frames.buffer();
+	size_t low = 1, high = frames.size() / step;
+	while (low < high) {
+		size_t mid = (low + high) >> 1;
+		if (values[mid * step] > target) high = mid;
+		else
+			low = mid + 1;
+	}
+	return (int) ((low - 1) * step);
 }
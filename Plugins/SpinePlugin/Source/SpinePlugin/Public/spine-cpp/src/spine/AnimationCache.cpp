@@ -0,0 +1,199 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/AnimationCache.h>
+
+#include <spine/Animation.h>
+#include <spine/Arena.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/ContainerUtil.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/Event.h>
+#include <spine/EventTimeline.h>
+
+#include <mutex>
+
+using namespace spine;
+
+struct AnimationCache::Lock : public SpineObject {
+	std::mutex mutex;
+};
+
+AnimationCache::AnimationCache() : _lock(new (__FILE__, __LINE__) Lock()),
+								   _budget(0),
+								   _loadedCount(0),
+								   _loadedBytes(0),
+								   _loads(0),
+								   _releases(0),
+								   _useCount(0) {
+}
+
+AnimationCache::~AnimationCache() {
+	delete _lock;
+}
+
+size_t AnimationCache::getBudget() {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	return _budget;
+}
+
+void AnimationCache::setBudget(size_t bytes) {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	_budget = bytes;
+	trim(NULL);
+}
+
+size_t AnimationCache::getAnimationCount() {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	return _animations.size();
+}
+
+size_t AnimationCache::getLoadedCount() {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	return _loadedCount;
+}
+
+size_t AnimationCache::getLoadedBytes() {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	return _loadedBytes;
+}
+
+size_t AnimationCache::getLoads() {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	return _loads;
+}
+
+size_t AnimationCache::getReleases() {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	return _releases;
+}
+
+void AnimationCache::add(Animation *animation) {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	animation->_cache = this;
+	animation->_loaded = false;
+	_animations.add(animation);
+}
+
+bool AnimationCache::load(Animation &animation, bool retain) {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	animation._lastUse = ++_useCount;
+	if (retain) animation._users++;
+	if (animation._loaded) return true;
+
+	// The timelines are allocated from the heap, so releasing them returns their memory.
+	ArenaScope noArena(NULL);
+	Vector<Timeline *> timelines;
+	if (!decode(animation, timelines)) {
+		ContainerUtil::cleanUpVectorOfPointers(timelines);
+		return false;
+	}
+	animation.setTimelines(timelines);
+	animation._loaded = true;
+	animation._loadedBytes = getBytes(timelines);
+	_loadedCount++;
+	_loadedBytes += animation._loadedBytes;
+	_loads++;
+	trim(&animation);
+	return true;
+}
+
+void AnimationCache::release(Animation &animation) {
+	std::lock_guard<std::mutex> guard(_lock->mutex);
+	if (animation._users > 0) animation._users--;
+	trim(NULL);
+}
+
+void AnimationCache::unload(Animation &animation) {
+	ArenaScope noArena(NULL);
+	Vector<Timeline *> timelines;
+	animation.setTimelines(timelines);
+	animation._loaded = false;
+	_loadedCount--;
+	_loadedBytes -= animation._loadedBytes;
+	animation._loadedBytes = 0;
+	_releases++;
+}
+
+/// Releases the least recently used animations that are not retained, except keep, until the budget is met.
+void AnimationCache::trim(Animation *keep) {
+	if (_budget == 0) return;
+	while (_loadedBytes > _budget) {
+		Animation *oldest = NULL;
+		for (size_t i = 0, n = _animations.size(); i < n; i++) {
+			Animation *animation = _animations[i];
+			if (!animation->_loaded || animation->_users > 0 || animation == keep) continue;
+			if (!oldest || animation->_lastUse < oldest->_lastUse) oldest = animation;
+		}
+		if (!oldest) break;
+		unload(*oldest);
+	}
+}
+
+/// Estimates the heap bytes used by decoded timelines, counting the objects and the capacity of their arrays.
+size_t AnimationCache::getBytes(Vector<Timeline *> &timelines) {
+	size_t bytes = timelines.size() * sizeof(Timeline *);
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Timeline *timeline = timelines[i];
+		bytes += sizeof(CurveTimeline2) + timeline->getFrames().getCapacity() * sizeof(float) +
+				 timeline->getPropertyIds().getCapacity() * sizeof(PropertyId);
+		const RTTI &rtti = timeline->getRTTI();
+		if (rtti.instanceOf(CurveTimeline::rtti)) {
+			CurveTimeline *curveTimeline = static_cast<CurveTimeline *>(timeline);
+			bytes += curveTimeline->getCurves().getCapacity() * sizeof(float) +
+					 curveTimeline->getQuantizedCurves().getCapacity() * sizeof(unsigned short);
+		}
+		if (rtti.isExactly(DeformTimeline::rtti)) {
+			Vector<Vector<float> > &vertices = static_cast<DeformTimeline *>(timeline)->getVertices();
+			bytes += vertices.getCapacity() * sizeof(Vector<float>);
+			for (size_t ii = 0, nn = vertices.size(); ii < nn; ii++)
+				bytes += vertices[ii].getCapacity() * sizeof(float);
+		} else if (rtti.isExactly(AttachmentTimeline::rtti)) {
+			Vector<String> &names = static_cast<AttachmentTimeline *>(timeline)->getAttachmentNames();
+			bytes += names.getCapacity() * sizeof(String);
+			for (size_t ii = 0, nn = names.size(); ii < nn; ii++)
+				if (!names[ii].isEmpty()) bytes += names[ii].length() + 1;
+		} else if (rtti.isExactly(DrawOrderTimeline::rtti)) {
+			Vector<Vector<int> > &drawOrders = static_cast<DrawOrderTimeline *>(timeline)->getDrawOrders();
+			bytes += drawOrders.getCapacity() * sizeof(Vector<int>);
+			for (size_t ii = 0, nn = drawOrders.size(); ii < nn; ii++)
+				bytes += drawOrders[ii].getCapacity() * sizeof(int);
+		} else if (rtti.isExactly(EventTimeline::rtti)) {
+			Vector<Event *> &events = static_cast<EventTimeline *>(timeline)->getEvents();
+			bytes += events.getCapacity() * sizeof(Event *) + events.size() * sizeof(Event);
+		}
+	}
+	return bytes;
+}
@@ -58,7 +58,7 @@ void dummyOnAnimationEventFunc(AnimationState *state, spine::EventType type, Tra
 }
 
 TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixingFrom(NULL), _mixingTo(0),
-						   _trackIndex(0), _loop(false), _holdPrevious(false), _reverse(false),
+						   _trackIndex(0), _id(0), _loop(false), _holdPrevious(false), _reverse(false),
 						   _eventThreshold(0), _attachmentThreshold(0), _drawOrderThreshold(0), _animationStart(0),
 						   _animationEnd(0), _animationLast(0), _nextAnimationLast(0), _delay(0), _trackTime(0),
 						   _trackLast(0), _nextTrackLast(0), _trackEnd(0), _timeScale(1.0f), _alpha(0), _mixTime(0),
@@ -70,6 +70,8 @@ TrackEntry::~TrackEntry() {}
 
 int TrackEntry::getTrackIndex() { return _trackIndex; }
 
+size_t TrackEntry::getId() { return _id; }
+
 Animation *TrackEntry::getAnimation() { return _animation; }
 
 TrackEntry *TrackEntry::getPrevious() { return _previous; }
@@ -191,11 +193,21 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelineCursors.clear();
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
 }
 
+size_t *TrackEntry::getTimelineCursors() {
+	size_t timelineCount = _animation->_timelines.size();
+	if (_timelineCursors.size() != timelineCount) {
+		_timelineCursors.clear();
+		_timelineCursors.setSize(timelineCount, 0);
+	}
+	return _timelineCursors.buffer();
+}
+
 float TrackEntry::getTrackComplete() {
 	float duration = _animationEnd - _animationStart;
 	if (duration != 0) {
@@ -294,6 +306,7 @@ void EventQueue::drain() {
 				else
 					state._listenerObject->callback(&state, EventType_Dispose, trackEntry, NULL);
 
+				if (trackEntry->_animation) trackEntry->_animation->release();
 				trackEntry->reset();
 				_trackEntryPool.free(trackEntry);
 				break;
@@ -319,6 +332,7 @@ AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 														   _listener(dummyOnAnimationEventFunc),
 														   _listenerObject(NULL),
 														   _unkeyedState(0),
+														   _nextTrackEntryId(1),
 														   _timeScale(1) {
 }
 
@@ -330,17 +344,29 @@ AnimationState::~AnimationState() {
 			while (from) {
 				TrackEntry *curr = from;
 				from = curr->_mixingFrom;
+				curr->_animation->release();
 				delete curr;
 			}
 			TrackEntry *next = entry->_next;
 			while (next) {
 				TrackEntry *curr = next;
 				next = curr->_next;
+				curr->_animation->release();
 				delete curr;
 			}
+			entry->_animation->release();
 			delete entry;
 		}
 	}
+	// Entries ended or disposed since the queue was last drained are no longer on a track, but still hold their animation.
+	Vector<EventQueueEntry> &queued = _queue->_eventQueueEntries;
+	for (size_t i = 0; i < queued.size(); i++) {
+		if (queued[i]._type != EventType_End && queued[i]._type != EventType_Dispose) continue;
+		TrackEntry *entry = queued[i]._entry;
+		if (entry->_animation) entry->_animation->release();
+		entry->reset();
+		_trackEntryPool.free(entry);
+	}
 	delete _queue;
 }
 
@@ -445,14 +471,16 @@ bool AnimationState::apply(Skeleton &skeleton) {
 		}
 		size_t timelineCount = current._animation->_timelines.size();
 		Vector<Timeline *> &timelines = current._animation->_timelines;
+		size_t *timelineCursors = current.getTimelineCursors();
 		if ((i == 0 && mix == 1) || blend == MixBlend_Add) {
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
 				Timeline *timeline = timelines[ii];
 				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
-											true);
+											true, timelineCursors + ii);
 				else
-					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, blend, MixDirection_In);
+					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, blend, MixDirection_In,
+									timelineCursors + ii);
 			}
 		} else {
 			Vector<int> &timelineMode = current._timelineMode;
@@ -469,13 +497,13 @@ bool AnimationState::apply(Skeleton &skeleton) {
 
 				if (timeline->getRTTI().isExactly(RotateTimeline::rtti))
 					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, mix,
-										timelineBlend, timelinesRotation, ii << 1, firstFrame);
+										timelineBlend, timelinesRotation, ii << 1, firstFrame, timelineCursors + ii);
 				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime,
-											timelineBlend, true);
+											timelineBlend, true, timelineCursors + ii);
 				else
 					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, timelineBlend,
-									MixDirection_In);
+									MixDirection_In, timelineCursors + ii);
 			}
 		}
 
@@ -671,7 +699,7 @@ Animation *AnimationState::getEmptyAnimation() {
 }
 
 void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimeline, Skeleton &skeleton, float time,
-											 MixBlend blend, bool attachments) {
+											 MixBlend blend, bool attachments, size_t *cursor) {
 	Slot *slot = skeleton.getSlots()[attachmentTimeline->getSlotIndex()];
 	if (!slot->getBone().isActive()) return;
 
@@ -680,7 +708,7 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
 			setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), attachments);
 	} else {
-		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[Animation::search(frames, time)],
+		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[attachmentTimeline->searchFrame(time, cursor)],
 					  attachments);
 	}
 
@@ -690,11 +718,12 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 
 
 void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha,
-										 MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame) {
+										 MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame,
+										 size_t *cursor) {
 	if (firstFrame) timelinesRotation[i] = 0;
 
 	if (alpha == 1) {
-		rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In);
+		rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In, cursor);
 		return;
 	}
 
@@ -714,7 +743,7 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 		}
 	} else {
 		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation;
-		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time);
+		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time, cursor);
 	}
 
 	// Mix between rotations using the direction of the shortest route on the first frame while detecting crosses.
@@ -799,6 +828,7 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	bool attachments = mix < from->_attachmentThreshold, drawOrder = mix < from->_drawOrderThreshold;
 	Vector<Timeline *> &timelines = from->_animation->_timelines;
 	size_t timelineCount = timelines.size();
+	size_t *timelineCursors = from->getTimelineCursors();
 	float alphaHold = from->_alpha * to->_interruptAlpha, alphaMix = alphaHold * (1 - mix);
 	float animationLast = from->_animationLast, animationTime = from->getAnimationTime();
 	float applyTime = animationTime;
@@ -811,7 +841,8 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 
 	if (blend == MixBlend_Add) {
 		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out,
+								timelineCursors + i);
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -854,15 +885,16 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 			from->_totalAlpha += alpha;
 			if ((timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
 				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
-									timelinesRotation, i << 1, firstFrame);
+									timelinesRotation, i << 1, firstFrame, timelineCursors + i);
 			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
 				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, timelineBlend,
-										attachments);
+										attachments, timelineCursors + i);
 			} else {
 				if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) &&
 					timelineBlend == MixBlend_Setup)
 					direction = MixDirection_In;
-				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
+				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction,
+								timelineCursors + i);
 			}
 		}
 	}
@@ -949,7 +981,9 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 	TrackEntry &entry = *entryP;
 
 	entry._trackIndex = trackIndex;
+	entry._id = _nextTrackEntryId++;
 	entry._animation = animation;
+	animation->retain();
 	entry._loop = loop;
 	entry._holdPrevious = 0;
 
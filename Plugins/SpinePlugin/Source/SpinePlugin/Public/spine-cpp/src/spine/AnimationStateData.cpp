@@ -41,8 +41,9 @@ AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonDa
 }
 
 void AnimationStateData::setMix(const String &fromName, const String &toName, float duration) {
-	Animation *from = _skeletonData->findAnimation(fromName);
-	Animation *to = _skeletonData->findAnimation(toName);
+	// Mixes are set up front for many animations, so their timelines are left to be decoded when they are played.
+	Animation *from = _skeletonData->lookupAnimation(fromName.buffer());
+	Animation *to = _skeletonData->lookupAnimation(toName.buffer());
 
 	setMix(from, to, duration);
 }
@@ -83,3 +84,7 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPair::hashCode() const {
+	return _a1->_name.hashCode() * 31 + _a2->_name.hashCode();
+}
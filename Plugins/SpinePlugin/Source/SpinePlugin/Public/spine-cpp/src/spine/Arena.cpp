@@ -0,0 +1,346 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/Arena.h>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace spine;
+
+namespace {
+	thread_local Arena *currentArena = NULL;
+
+	// Blocks of an arena destroyed while it was current, released when the scope that made it current ends.
+	thread_local const Arena *retiredArena = NULL;
+	thread_local void *retiredBlocks = NULL;
+	thread_local SpineExtension *retiredAllocator = NULL;
+
+	const size_t MIN_BLOCK_SIZE = 16 * 1024;
+	const size_t MAX_BLOCK_SIZE = 1024 * 1024;
+	const size_t ALIGNMENT = 16;
+
+	// Every allocation is preceded by a header holding its size, so arena memory can be moved on realloc.
+	const size_t HEADER_SIZE = ALIGNMENT;
+
+	size_t align(size_t size) {
+		return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	}
+
+	/// Address sorted ranges of arena blocks, with a fixed capacity. Replaced by a larger copy when full.
+	struct BlockRanges {
+		size_t capacity;
+		std::atomic<size_t> count;
+		std::atomic<char *> *begins;
+		std::atomic<char *> *ends;
+		BlockRanges *previous; // Replaced ranges, kept for readers that may still be searching them.
+
+		explicit BlockRanges(size_t capacity) : capacity(capacity), count(0), previous(NULL) {
+			begins = (std::atomic<char *> *) ::malloc(capacity * sizeof(std::atomic<char *>));
+			ends = (std::atomic<char *> *) ::malloc(capacity * sizeof(std::atomic<char *>));
+			for (size_t i = 0; i < capacity; i++) {
+				new (begins + i) std::atomic<char *>(NULL);
+				new (ends + i) std::atomic<char *>(NULL);
+			}
+		}
+
+		/// Returns the index of the first block beginning at or after ptr, in the first n ranges.
+		size_t find(char *ptr, size_t n) {
+			size_t low = 0, high = n;
+			while (low < high) {
+				size_t mid = (low + high) >> 1;
+				if (begins[mid].load(std::memory_order_relaxed) < ptr) low = mid + 1;
+				else
+					high = mid;
+			}
+			return low;
+		}
+	};
+
+	/// The ranges of all live arena blocks, used to tell arena memory from memory of the wrapped extension. Every free
+	/// looks up the ranges, so lookups don't lock: changes are made under a lock and counted by a sequence number that
+	/// is odd while a change is in progress, and a lookup retries if the sequence number changed while it searched.
+	/// Replaced ranges are never freed, their total size is at most that of the current ranges.
+	struct BlockRegistry {
+		std::mutex lock;
+		std::atomic<unsigned int> sequence;
+		std::atomic<BlockRanges *> ranges;
+
+		BlockRegistry() : sequence(0), ranges(new BlockRanges(64)) {
+		}
+
+		void add(char *begin, char *end) {
+			std::lock_guard<std::mutex> guard(lock);
+			BlockRanges *current = ranges.load(std::memory_order_relaxed);
+			size_t n = current->count.load(std::memory_order_relaxed);
+			if (n == current->capacity) {
+				// Readers may still search the old ranges, which stay valid, so this needs no change of sequence.
+				BlockRanges *grown = new BlockRanges(current->capacity << 1);
+				for (size_t i = 0; i < n; i++) {
+					grown->begins[i].store(current->begins[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+					grown->ends[i].store(current->ends[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+				}
+				grown->count.store(n, std::memory_order_relaxed);
+				grown->previous = current;
+				ranges.store(grown, std::memory_order_release);
+				current = grown;
+			}
+			beginChange();
+			size_t i = current->find(begin, n);
+			for (size_t ii = n; ii > i; ii--) {
+				current->begins[ii].store(current->begins[ii - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+				current->ends[ii].store(current->ends[ii - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+			current->begins[i].store(begin, std::memory_order_relaxed);
+			current->ends[i].store(end, std::memory_order_relaxed);
+			current->count.store(n + 1, std::memory_order_relaxed);
+			endChange();
+		}
+
+		void remove(char *begin) {
+			std::lock_guard<std::mutex> guard(lock);
+			BlockRanges *current = ranges.load(std::memory_order_relaxed);
+			size_t n = current->count.load(std::memory_order_relaxed);
+			size_t i = current->find(begin, n);
+			if (i == n || current->begins[i].load(std::memory_order_relaxed) != begin) return;
+			beginChange();
+			for (; i + 1 < n; i++) {
+				current->begins[i].store(current->begins[i + 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+				current->ends[i].store(current->ends[i + 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+			current->count.store(n - 1, std::memory_order_relaxed);
+			endChange();
+		}
+
+		bool contains(char *ptr) {
+			while (true) {
+				unsigned int before = sequence.load(std::memory_order_acquire);
+				BlockRanges *current = ranges.load(std::memory_order_acquire);
+				size_t n = current->count.load(std::memory_order_relaxed);
+				if (n == 0 && !(before & 1)) return false;
+				size_t i = current->find(ptr + 1, n);
+				bool found = i > 0 && ptr < current->ends[i - 1].load(std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (!(before & 1) && sequence.load(std::memory_order_relaxed) == before) return found;
+			}
+		}
+
+		void beginChange() {
+			sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+		}
+
+		void endChange() {
+			sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+	};
+
+	BlockRegistry &getRegistry() {
+		static BlockRegistry registry;
+		return registry;
+	}
+}
+
+Arena::Arena() : _blocks(NULL), _blockAllocator(NULL), _reserve(0), _allocationCount(0), _blockCount(0), _blockBytes(0),
+				 _usedBytes(0) {
+}
+
+Arena::~Arena() {
+	if (currentArena == this) {
+		// Destroyed from within its own scope, e.g. a loader deleting the skeleton data it failed to read. Locals of
+		// that scope may still free arena memory, so the blocks stay registered until the scope ends.
+		currentArena = NULL;
+		if (retiredBlocks) releaseBlocks((Block *) retiredBlocks, retiredAllocator);
+		retiredArena = this;
+		retiredBlocks = _blocks;
+		retiredAllocator = _blockAllocator;
+		return;
+	}
+	releaseBlocks(_blocks, _blockAllocator);
+}
+
+size_t Arena::getAllocationCount() {
+	return _allocationCount;
+}
+
+size_t Arena::getBlockCount() {
+	return _blockCount;
+}
+
+size_t Arena::getBlockBytes() {
+	return _blockBytes;
+}
+
+size_t Arena::getUsedBytes() {
+	return _usedBytes;
+}
+
+void Arena::reserve(size_t bytes) {
+	_reserve = bytes;
+}
+
+void *Arena::alloc(size_t size, SpineExtension &blockAllocator) {
+	size_t needed = HEADER_SIZE + align(size);
+	if (!_blocks || _blocks->size - _blocks->used < needed) {
+		size_t blockSize = MIN_BLOCK_SIZE << (_blockCount < 6 ? _blockCount : 6);
+		if (blockSize > MAX_BLOCK_SIZE) blockSize = MAX_BLOCK_SIZE;
+		if (_reserve) {
+			blockSize = align(sizeof(Block)) + align(_reserve);
+			_reserve = 0;
+		}
+		if (blockSize < align(sizeof(Block)) + needed) blockSize = align(sizeof(Block)) + needed;
+
+		Block *block = (Block *) blockAllocator._alloc(blockSize, __FILE__, __LINE__);
+		if (!block) return NULL;
+		block->next = _blocks;
+		block->size = blockSize;
+		block->used = align(sizeof(Block));
+		getRegistry().add((char *) block, (char *) block + blockSize);
+		_blocks = block;
+		_blockAllocator = &blockAllocator;
+		_blockCount++;
+		_blockBytes += blockSize;
+	}
+
+	char *memory = (char *) _blocks + _blocks->used;
+	_blocks->used += needed;
+	_allocationCount++;
+	_usedBytes += needed;
+	*(size_t *) memory = size;
+	return memory + HEADER_SIZE;
+}
+
+bool Arena::grow(void *ptr, size_t size) {
+	if (!_blocks) return false;
+	char *top = (char *) _blocks + _blocks->used;
+	size_t oldSize = align(getSize(ptr));
+	if ((char *) ptr < (char *) _blocks || (char *) ptr + oldSize != top) return false;
+	size_t newSize = align(size);
+	if (_blocks->size - _blocks->used < newSize - oldSize) return false;
+	_blocks->used += newSize - oldSize;
+	_usedBytes += newSize - oldSize;
+	*(size_t *) ((char *) ptr - HEADER_SIZE) = size;
+	return true;
+}
+
+void Arena::releaseBlocks(Block *blocks, SpineExtension *blockAllocator) {
+	while (blocks) {
+		Block *next = blocks->next;
+		getRegistry().remove((char *) blocks);
+		blockAllocator->_free(blocks, __FILE__, __LINE__);
+		blocks = next;
+	}
+}
+
+size_t Arena::getSize(void *ptr) {
+	return *(size_t *) ((char *) ptr - HEADER_SIZE);
+}
+
+bool Arena::owns(void *ptr) {
+	for (Block *block = _blocks; block; block = block->next)
+		if ((char *) ptr > (char *) block && (char *) ptr < (char *) block + block->size) return true;
+	return false;
+}
+
+bool Arena::contains(void *ptr) {
+	// Checking the current arena first avoids searching the registry when an arena owner frees its objects.
+	if (currentArena && currentArena->owns(ptr)) return true;
+	return getRegistry().contains((char *) ptr);
+}
+
+ArenaScope::ArenaScope(Arena *arena) : _arena(arena), _previous(currentArena) {
+	currentArena = arena;
+}
+
+ArenaScope::~ArenaScope() {
+	currentArena = _previous;
+	if (retiredBlocks && retiredArena == _arena) {
+		Arena::releaseBlocks((Arena::Block *) retiredBlocks, retiredAllocator);
+		retiredArena = NULL;
+		retiredBlocks = NULL;
+		retiredAllocator = NULL;
+	}
+}
+
+ArenaExtension::ArenaExtension(SpineExtension *extension) : SpineExtension(), _extension(extension) {
+}
+
+ArenaExtension::~ArenaExtension() {
+	delete _extension;
+}
+
+void *ArenaExtension::_alloc(size_t size, const char *file, int line) {
+	if (size == 0) return 0;
+	if (currentArena) return currentArena->alloc(size, *_extension);
+	return _extension->_alloc(size, file, line);
+}
+
+void *ArenaExtension::_calloc(size_t size, const char *file, int line) {
+	if (size == 0) return 0;
+	if (currentArena) {
+		void *mem = currentArena->alloc(size, *_extension);
+		if (mem) memset(mem, 0, size);
+		return mem;
+	}
+	return _extension->_calloc(size, file, line);
+}
+
+void *ArenaExtension::_realloc(void *ptr, size_t size, const char *file, int line) {
+	if (!ptr) return _alloc(size, file, line);
+	if (!Arena::contains(ptr)) return _extension->_realloc(ptr, size, file, line);
+
+	if (size == 0) return 0;
+	size_t oldSize = Arena::getSize(ptr);
+	if (size <= oldSize) return ptr;
+	// Growing the most recent allocation, e.g. a vector being filled, extends it in place.
+	if (currentArena && currentArena->grow(ptr, size)) return ptr;
+	void *mem = currentArena ? currentArena->alloc(size, *_extension) : _extension->_alloc(size, file, line);
+	if (mem) memcpy(mem, ptr, oldSize);
+	return mem;
+}
+
+void ArenaExtension::_free(void *mem, const char *file, int line) {
+	if (!mem || Arena::contains(mem)) return;
+	_extension->_free(mem, file, line);
+}
+
+char *ArenaExtension::_readFile(const String &path, int *length) {
+	return _extension->_readFile(path, length);
+}
+
+void ArenaExtension::_beforeFree(void *ptr) {
+	_extension->_beforeFree(ptr);
+}
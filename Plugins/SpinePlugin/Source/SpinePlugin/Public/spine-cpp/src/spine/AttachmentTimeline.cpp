@@ -64,7 +64,7 @@ void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *a
 }
 
 void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							   MixBlend blend, MixDirection direction) {
+							   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(alpha);
@@ -91,7 +91,7 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 		return;
 	}
 
-	setAttachment(skeleton, *slot, &_attachmentNames[Animation::search(_frames, time)]);
+	setAttachment(skeleton, *slot, &_attachmentNames[searchFrame(time, cursor)]);
 }
 
 void AttachmentTimeline::setFrame(int frame, float time, const String &attachmentName) {
@@ -0,0 +1,490 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/AnimationState.h>
+#include <spine/AnimationStateData.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+
+#include <float.h>
+#include <limits.h>
+#include <string.h>
+
+using namespace spine;
+
+static const unsigned char BAKED_MAGIC[] = {'S', 'P', 'B', 'A'};
+static const unsigned char BAKED_VERSION = 1;
+
+static unsigned int toRGBA8888(const Color &color) {
+	return ((unsigned int) (color.r * 255) << 24) | ((unsigned int) (color.g * 255) << 16) |
+		   ((unsigned int) (color.b * 255) << 8) | (unsigned int) (color.a * 255);
+}
+
+/// Returns the number of vertices of a region or mesh attachment, 0 for other attachments.
+static int getVertexCount(Attachment *attachment) {
+	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) return 4;
+	if (attachment->getRTTI().isExactly(MeshAttachment::rtti))
+		return (int) (static_cast<MeshAttachment *>(attachment)->getWorldVerticesLength() >> 1);
+	return 0;
+}
+
+/// Finds the name the attachment is stored under in the skin for the slot.
+static bool findAttachmentName(Skin *skin, int slotIndex, Attachment *attachment, String &name) {
+	if (!skin) return false;
+	Vector<Attachment *> attachments;
+	Vector<String> names;
+	skin->findAttachmentsForSlot(slotIndex, attachments);
+	skin->findNamesForSlot(slotIndex, names);
+	for (size_t i = 0; i < attachments.size() && i < names.size(); i++) {
+		if (attachments[i] == attachment) {
+			name = names[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+namespace {
+	class BakedWriter {
+	public:
+		explicit BakedWriter(Vector<unsigned char> &output) : _output(output) {
+		}
+
+		void writeByte(unsigned char value) {
+			_output.add(value);
+		}
+
+		void writeVarint(unsigned int value) {
+			while (value > 0x7f) {
+				_output.add((unsigned char) ((value & 0x7f) | 0x80));
+				value >>= 7;
+			}
+			_output.add((unsigned char) value);
+		}
+
+		void writeInt(unsigned int value) {
+			_output.add((unsigned char) value);
+			_output.add((unsigned char) (value >> 8));
+			_output.add((unsigned char) (value >> 16));
+			_output.add((unsigned char) (value >> 24));
+		}
+
+		void writeFloat(float value) {
+			unsigned int bits;
+			memcpy(&bits, &value, sizeof(bits));
+			writeInt(bits);
+		}
+
+		void writeString(const String &value) {
+			writeVarint((unsigned int) value.length());
+			for (size_t i = 0; i < value.length(); i++)
+				_output.add((unsigned char) value.buffer()[i]);
+		}
+
+	private:
+		Vector<unsigned char> &_output;
+	};
+
+	class BakedReader {
+	public:
+		BakedReader(const unsigned char *data, size_t length) : _cursor(data), _end(data + length), _failed(false) {
+		}
+
+		bool failed() {
+			return _failed;
+		}
+
+		size_t remaining() {
+			return (size_t) (_end - _cursor);
+		}
+
+		bool has(size_t bytes) {
+			if ((size_t) (_end - _cursor) < bytes) _failed = true;
+			return !_failed;
+		}
+
+		unsigned char readByte() {
+			return has(1) ? *_cursor++ : 0;
+		}
+
+		unsigned int readVarint() {
+			unsigned int value = 0;
+			for (int shift = 0; shift < 35; shift += 7) {
+				unsigned char b = readByte();
+				value |= (unsigned int) (b & 0x7f) << shift;
+				if (!(b & 0x80)) return value;
+			}
+			_failed = true;
+			return 0;
+		}
+
+		unsigned int readInt() {
+			if (!has(4)) return 0;
+			unsigned int value = _cursor[0] | (_cursor[1] << 8) | (_cursor[2] << 16) | ((unsigned int) _cursor[3] << 24);
+			_cursor += 4;
+			return value;
+		}
+
+		float readFloat() {
+			unsigned int bits = readInt();
+			float value;
+			memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		String readString() {
+			size_t length = readVarint();
+			if (!has(length) || length == 0) return String();
+			char *chars = SpineExtension::alloc<char>(length + 1, __FILE__, __LINE__);
+			memcpy(chars, _cursor, length);
+			chars[length] = '\0';
+			_cursor += length;
+			return String(chars, true);
+		}
+
+	private:
+		const unsigned char *_cursor;
+		const unsigned char *_end;
+		bool _failed;
+	};
+}
+
+BakedAnimation::BakedAnimation() : _duration(0), _frameRate(0), _minX(0), _minY(0), _scaleX(0), _scaleY(0) {
+}
+
+BakedAnimation *BakedAnimation::bake(SkeletonData &skeletonData, Animation &animation, float frameRate, Skin *skin) {
+	if (frameRate <= 0 || !skeletonData.getAnimations().contains(&animation)) return NULL;
+	if (skin && !skeletonData.getSkins().contains(skin)) return NULL;
+
+	Skeleton skeleton(&skeletonData);
+	if (skin) skeleton.setSkin(skin);
+	skeleton.setSlotsToSetupPose();
+	AnimationStateData stateData(&skeletonData);
+	AnimationState state(&stateData);
+	TrackEntry *entry = state.setAnimation(0, &animation, false);
+
+	BakedAnimation *baked = new (__FILE__, __LINE__) BakedAnimation();
+	baked->_name = animation.getName();
+	if (skin) baked->_skinName = skin->getName();
+	baked->_duration = animation.getDuration();
+	baked->_frameRate = frameRate;
+
+	Vector<Attachment *> bakedAttachments;
+	Vector<float> worldVertices;
+	Vector<float> vertices;
+	float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+	// One frame per 1 / frameRate seconds, plus one at the end of the animation.
+	float frames = baked->_duration * frameRate;
+	int frameCount = (int) frames;
+	frameCount += frameCount < frames ? 2 : 1;
+	for (int frame = 0; frame < frameCount; frame++) {
+		baked->_frames.add((int) baked->_parts.size());
+
+		entry->setTrackTime(MathUtil::min(frame / frameRate, baked->_duration));
+		skeleton.setToSetupPose();
+		state.apply(skeleton);
+		skeleton.updateWorldTransform();
+
+		Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+		for (size_t i = 0; i < drawOrder.size(); i++) {
+			Slot *slot = drawOrder[i];
+			Attachment *attachment = slot->getAttachment();
+			if (!attachment || !slot->getBone().isActive()) continue;
+			int vertexCount = getVertexCount(attachment);
+			if (vertexCount == 0) continue;
+
+			Color color(slot->getColor());
+			if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+				RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+				color.r *= region->getColor().r, color.g *= region->getColor().g, color.b *= region->getColor().b, color.a *= region->getColor().a;
+				worldVertices.setSize(8, 0);
+				region->computeWorldVertices(slot->getBone(), worldVertices, 0, 2);
+			} else {
+				MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+				color.r *= mesh->getColor().r, color.g *= mesh->getColor().g, color.b *= mesh->getColor().b, color.a *= mesh->getColor().a;
+				worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+				mesh->computeWorldVertices(*slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+			}
+			if (color.a == 0) continue;
+
+			int attachmentIndex = bakedAttachments.indexOf(attachment);
+			if (attachmentIndex < 0) {
+				BakedAttachment bakedAttachment;
+				bakedAttachment.slotIndex = slot->getData().getIndex();
+				bakedAttachment.vertexCount = vertexCount;
+				if (!findAttachmentName(skeleton.getSkin(), bakedAttachment.slotIndex, attachment, bakedAttachment.name) &&
+					!findAttachmentName(skeletonData.getDefaultSkin(), bakedAttachment.slotIndex, attachment, bakedAttachment.name))
+					continue;
+				attachmentIndex = (int) bakedAttachments.size();
+				bakedAttachments.add(attachment);
+				baked->_attachments.add(bakedAttachment);
+			}
+
+			BakedPart part;
+			part.attachmentIndex = attachmentIndex;
+			part.color = toRGBA8888(color);
+			part.darkColor = slot->hasDarkColor() ? toRGBA8888(slot->getDarkColor()) >> 8 : 0;
+			part.firstVertex = (int) (vertices.size() >> 1);
+			baked->_parts.add(part);
+
+			for (int j = 0; j < vertexCount << 1; j += 2) {
+				float x = worldVertices[j], y = worldVertices[j + 1];
+				vertices.add(x);
+				vertices.add(y);
+				minX = MathUtil::min(minX, x), maxX = MathUtil::max(maxX, x);
+				minY = MathUtil::min(minY, y), maxY = MathUtil::max(maxY, y);
+			}
+		}
+	}
+	baked->_frames.add((int) baked->_parts.size());
+
+	// Quantizes all positions within the bounds of the whole animation.
+	if (vertices.size() > 0) {
+		baked->_minX = minX;
+		baked->_minY = minY;
+		baked->_scaleX = (maxX - minX) / 65535;
+		baked->_scaleY = (maxY - minY) / 65535;
+	}
+	float invScaleX = baked->_scaleX > 0 ? 1 / baked->_scaleX : 0;
+	float invScaleY = baked->_scaleY > 0 ? 1 / baked->_scaleY : 0;
+	baked->_vertices.setSize(vertices.size(), 0);
+	for (size_t i = 0; i < vertices.size(); i += 2) {
+		baked->_vertices[i] = (unsigned short) MathUtil::clamp((vertices[i] - minX) * invScaleX + 0.5f, 0, 65535);
+		baked->_vertices[i + 1] = (unsigned short) MathUtil::clamp((vertices[i + 1] - minY) * invScaleY + 0.5f, 0, 65535);
+	}
+	return baked;
+}
+
+BakedAnimation *BakedAnimation::read(const unsigned char *data, size_t length) {
+	BakedReader input(data, length);
+	for (size_t i = 0; i < sizeof(BAKED_MAGIC); i++)
+		if (input.readByte() != BAKED_MAGIC[i]) return NULL;
+	if (input.readByte() != BAKED_VERSION) return NULL;
+
+	BakedAnimation *baked = new (__FILE__, __LINE__) BakedAnimation();
+	baked->_name = input.readString();
+	baked->_skinName = input.readString();
+	baked->_duration = input.readFloat();
+	baked->_frameRate = input.readFloat();
+	baked->_minX = input.readFloat();
+	baked->_minY = input.readFloat();
+	baked->_scaleX = input.readFloat();
+	baked->_scaleY = input.readFloat();
+
+	// Each count is checked against the bytes left before anything is sized by it. An attachment takes at least 3 bytes,
+	// a frame 1 and a part 9, and every vertex drawn needs 4 bytes of the vertex data that follows the frames.
+	size_t attachmentCount = input.readVarint();
+	if (attachmentCount > input.remaining() / 3) {
+		delete baked;
+		return NULL;
+	}
+	for (size_t i = 0; i < attachmentCount && !input.failed(); i++) {
+		BakedAttachment attachment;
+		size_t slotIndex = input.readVarint();
+		attachment.name = input.readString();
+		size_t attachmentVertexCount = input.readVarint();
+		if (slotIndex > INT_MAX || attachmentVertexCount > input.remaining() / 4) {
+			delete baked;
+			return NULL;
+		}
+		attachment.slotIndex = (int) slotIndex;
+		attachment.vertexCount = (int) attachmentVertexCount;
+		baked->_attachments.add(attachment);
+	}
+
+	size_t frameCount = input.readVarint();
+	if (frameCount > input.remaining()) {
+		delete baked;
+		return NULL;
+	}
+	size_t vertexCount = 0;
+	for (size_t i = 0; i < frameCount && !input.failed(); i++) {
+		baked->_frames.add((int) baked->_parts.size());
+		size_t partCount = input.readVarint();
+		if (partCount > input.remaining() / 9) {
+			delete baked;
+			return NULL;
+		}
+		for (size_t j = 0; j < partCount && !input.failed(); j++) {
+			BakedPart part;
+			size_t attachmentIndex = input.readVarint();
+			part.color = input.readInt();
+			part.darkColor = input.readInt();
+			if (attachmentIndex >= baked->_attachments.size()) {
+				delete baked;
+				return NULL;
+			}
+			part.attachmentIndex = (int) attachmentIndex;
+			part.firstVertex = (int) vertexCount;
+			vertexCount += (size_t) baked->_attachments[attachmentIndex].vertexCount;
+			// Stays below the input length, so it can't overflow.
+			if (vertexCount > input.remaining() / 4) {
+				delete baked;
+				return NULL;
+			}
+			baked->_parts.add(part);
+		}
+	}
+	baked->_frames.add((int) baked->_parts.size());
+
+	if (input.failed() || frameCount == 0 || !input.has(vertexCount * 4)) {
+		delete baked;
+		return NULL;
+	}
+	baked->_vertices.setSize(vertexCount << 1, 0);
+	for (size_t i = 0; i < baked->_vertices.size(); i++) {
+		unsigned char low = input.readByte();
+		baked->_vertices[i] = (unsigned short) (low | (input.readByte() << 8));
+	}
+	return baked;
+}
+
+void BakedAnimation::write(Vector<unsigned char> &output) {
+	BakedWriter writer(output);
+	for (size_t i = 0; i < sizeof(BAKED_MAGIC); i++)
+		writer.writeByte(BAKED_MAGIC[i]);
+	writer.writeByte(BAKED_VERSION);
+	writer.writeString(_name);
+	writer.writeString(_skinName);
+	writer.writeFloat(_duration);
+	writer.writeFloat(_frameRate);
+	writer.writeFloat(_minX);
+	writer.writeFloat(_minY);
+	writer.writeFloat(_scaleX);
+	writer.writeFloat(_scaleY);
+
+	writer.writeVarint((unsigned int) _attachments.size());
+	for (size_t i = 0; i < _attachments.size(); i++) {
+		writer.writeVarint((unsigned int) _attachments[i].slotIndex);
+		writer.writeString(_attachments[i].name);
+		writer.writeVarint((unsigned int) _attachments[i].vertexCount);
+	}
+
+	writer.writeVarint((unsigned int) getFrameCount());
+	for (int frame = 0; frame < getFrameCount(); frame++) {
+		writer.writeVarint((unsigned int) getPartCount(frame));
+		for (int i = _frames[frame], n = _frames[frame + 1]; i < n; i++) {
+			writer.writeVarint((unsigned int) _parts[i].attachmentIndex);
+			writer.writeInt(_parts[i].color);
+			writer.writeInt(_parts[i].darkColor);
+		}
+	}
+
+	for (size_t i = 0; i < _vertices.size(); i++) {
+		writer.writeByte((unsigned char) _vertices[i]);
+		writer.writeByte((unsigned char) (_vertices[i] >> 8));
+	}
+}
+
+void BakedAnimation::resolveAttachments(SkeletonData &skeletonData, Vector<Attachment *> &attachments) {
+	attachments.setSize(_attachments.size(), NULL);
+	Skin *skin = _skinName.length() > 0 ? skeletonData.findSkin(_skinName) : NULL;
+	Skin *defaultSkin = skeletonData.getDefaultSkin();
+	for (size_t i = 0; i < _attachments.size(); i++) {
+		BakedAttachment &baked = _attachments[i];
+		Attachment *attachment = NULL;
+		if ((size_t) baked.slotIndex < skeletonData.getSlots().size()) {
+			if (skin) attachment = skin->getAttachment(baked.slotIndex, baked.name);
+			if (!attachment && defaultSkin) attachment = defaultSkin->getAttachment(baked.slotIndex, baked.name);
+		}
+		// The skeleton data changed since the animation was baked.
+		if (attachment && getVertexCount(attachment) != baked.vertexCount) attachment = NULL;
+		attachments[i] = attachment;
+	}
+}
+
+const String &BakedAnimation::getName() {
+	return _name;
+}
+
+const String &BakedAnimation::getSkinName() {
+	return _skinName;
+}
+
+float BakedAnimation::getDuration() {
+	return _duration;
+}
+
+float BakedAnimation::getFrameRate() {
+	return _frameRate;
+}
+
+int BakedAnimation::getFrameCount() {
+	return (int) _frames.size() - 1;
+}
+
+int BakedAnimation::getFrame(float time, bool loop) {
+	if (loop && _duration > 0) {
+		time = MathUtil::fmod(time, _duration);
+		if (time < 0) time += _duration;
+	}
+	int frame = (int) (time * _frameRate + 0.5f);
+	return frame < 0 ? 0 : MathUtil::min(frame, getFrameCount() - 1);
+}
+
+Vector<BakedAttachment> &BakedAnimation::getAttachments() {
+	return _attachments;
+}
+
+int BakedAnimation::getPartCount(int frame) {
+	return _frames[frame + 1] - _frames[frame];
+}
+
+BakedPart &BakedAnimation::getPart(int frame, int index) {
+	return _parts[_frames[frame] + index];
+}
+
+void BakedAnimation::computeWorldVertices(BakedPart &part, float *worldVertices) {
+	const unsigned short *vertices = _vertices.buffer() + (part.firstVertex << 1);
+	for (int i = 0, n = _attachments[part.attachmentIndex].vertexCount << 1; i < n; i += 2) {
+		worldVertices[i] = _minX + vertices[i] * _scaleX;
+		worldVertices[i + 1] = _minY + vertices[i + 1] * _scaleY;
+	}
+}
+
+size_t BakedAnimation::getMemorySize() {
+	size_t size = sizeof(BakedAnimation) + _name.length() + _skinName.length();
+	for (size_t i = 0; i < _attachments.size(); i++)
+		size += sizeof(BakedAttachment) + _attachments[i].name.length();
+	return size + _frames.size() * sizeof(int) + _parts.size() * sizeof(BakedPart) + _vertices.size() * sizeof(unsigned short);
+}
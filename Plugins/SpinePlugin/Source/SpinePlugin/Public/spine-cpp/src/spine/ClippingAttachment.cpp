@@ -33,7 +33,9 @@
 
 #include <spine/ClippingAttachment.h>
 
+#include <spine/SkeletonClipping.h>
 #include <spine/SlotData.h>
+#include <spine/Triangulator.h>
 
 using namespace spine;
 
@@ -58,5 +60,24 @@ Attachment *ClippingAttachment::copy() {
 	ClippingAttachment *copy = new (__FILE__, __LINE__) ClippingAttachment(getName());
 	copyTo(copy);
 	copy->_endSlot = _endSlot;
+	copy->_convexPolygons.clearAndAddAll(_convexPolygons);
+	copy->_convexPolygonEnds.clearAndAddAll(_convexPolygonEnds);
 	return copy;
 }
+
+void ClippingAttachment::updateConvexPolygons() {
+	_convexPolygons.clear();
+	_convexPolygonEnds.clear();
+	if (_bones.size() > 0 || _vertices.size() < 6) return;
+
+	Vector<float> polygon;
+	polygon.clearAndAddAll(_vertices);
+	SkeletonClipping::makeClockwise(polygon);
+	Triangulator triangulator;
+	Vector<Vector<float> *> &polygons = triangulator.decompose(polygon, triangulator.triangulate(polygon));
+	for (size_t i = 0, n = polygons.size(); i < n; ++i) {
+		SkeletonClipping::makeClockwise(*polygons[i]);
+		_convexPolygons.addAll(*polygons[i]);
+		_convexPolygonEnds.add(_convexPolygons.size());
+	}
+}
@@ -59,7 +59,7 @@ RGBATimeline::~RGBATimeline() {
 }
 
 void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						 MixBlend blend, MixDirection direction) {
+						 MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -83,7 +83,7 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, a = 0;
-	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / RGBATimeline::ENTRIES];
 	switch (curveType) {
 		case RGBATimeline::LINEAR: {
@@ -148,7 +148,7 @@ RGBTimeline::~RGBTimeline() {
 }
 
 void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						MixBlend blend, MixDirection direction) {
+						MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -172,7 +172,7 @@ void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<E
 	}
 
 	float r = 0, g = 0, b = 0;
-	int i = Animation::search(_frames, time, RGBTimeline::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / RGBTimeline::ENTRIES];
 	switch (curveType) {
 		case RGBTimeline::LINEAR: {
@@ -231,7 +231,7 @@ AlphaTimeline::~AlphaTimeline() {
 }
 
 void AlphaTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -253,7 +253,7 @@ void AlphaTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 		return;
 	}
 
-	float a = getCurveValue(time);
+	float a = getCurveValue(time, cursor);
 	if (alpha == 1)
 		slot->_color.a = a;
 	else {
@@ -278,7 +278,7 @@ RGBA2Timeline::~RGBA2Timeline() {
 }
 
 void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -307,7 +307,7 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float r = 0, g = 0, b = 0, a = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / RGBA2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGBA2Timeline::LINEAR: {
@@ -398,7 +398,7 @@ RGB2Timeline::~RGB2Timeline() {
 }
 
 void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						 MixBlend blend, MixDirection direction) {
+						 MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -426,7 +426,7 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGB2Timeline::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / RGB2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGB2Timeline::LINEAR: {
@@ -462,11 +462,11 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 			b = getBezierValue(time, i, RGB2Timeline::B,
 							   curveType + RGB2Timeline::BEZIER_SIZE * 2 - RGB2Timeline::BEZIER);
 			r2 = getBezierValue(time, i, RGB2Timeline::R2,
-								curveType + RGB2Timeline::BEZIER_SIZE * 4 - RGB2Timeline::BEZIER);
+								curveType + RGB2Timeline::BEZIER_SIZE * 3 - RGB2Timeline::BEZIER);
 			g2 = getBezierValue(time, i, RGB2Timeline::G2,
-								curveType + RGB2Timeline::BEZIER_SIZE * 5 - RGB2Timeline::BEZIER);
+								curveType + RGB2Timeline::BEZIER_SIZE * 4 - RGB2Timeline::BEZIER);
 			b2 = getBezierValue(time, i, RGB2Timeline::B2,
-								curveType + RGB2Timeline::BEZIER_SIZE * 6 - RGB2Timeline::BEZIER);
+								curveType + RGB2Timeline::BEZIER_SIZE * 5 - RGB2Timeline::BEZIER);
 		}
 	}
 	Color &light = slot->_color, &dark = slot->_darkColor;
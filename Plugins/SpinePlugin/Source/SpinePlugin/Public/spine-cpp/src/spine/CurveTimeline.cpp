@@ -37,10 +37,19 @@
 
 using namespace spine;
 
+// The weights of cx1, cx2 and the second frame at the start of a bezier, the 9 samples setBezier() stores, the end and 2
+// points past the end that pad the samples to a multiple of 4.
+static const float BEZIER_WEIGHTS1[] = {0, 0.243f, 0.384f, 0.441f, 0.432f, 0.375f, 0.288f, 0.189f, 0.096f, 0.027f, 0, 0, 0};
+static const float BEZIER_WEIGHTS2[] = {0, 0.027f, 0.096f, 0.189f, 0.288f, 0.375f, 0.432f, 0.441f, 0.384f, 0.243f, 0, 0, 0};
+static const float BEZIER_WEIGHTS3[] = {0, 0.001f, 0.008f, 0.027f, 0.064f, 0.125f, 0.216f, 0.343f, 0.512f, 0.729f, 1, 2, 2};
+
 RTTI_IMPL(CurveTimeline, Timeline)
 
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
-																									frameEntries) {
+																									frameEntries),
+																						   _quantizedMin(0),
+																						   _quantizedScale(0),
+																						   _quantized(false) {
 	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
 }
@@ -60,6 +69,7 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 							  float cx2, float cy2, float time2, float value2) {
 	size_t i = getFrameCount() + bezier * BEZIER_SIZE;
 	if (value == 0) _curves[frame] = BEZIER + i;
+	if (_quantized) return;
 	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = (value1 - cy1 * 2 + cy2) * 0.03;
 	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006;
 	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
@@ -78,6 +88,11 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
+	if (_quantized) {
+		size_t next = frameIndex + getFrameEntries();
+		return getQuantizedBezierValue(time, _frames[frameIndex], _frames[frameIndex + valueOffset], _frames[next],
+									   _frames[next + valueOffset], (i - getFrameCount()) / BEZIER_SIZE);
+	}
 	if (_curves[i] > time) {
 		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
 		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
@@ -94,10 +109,69 @@ float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueO
 	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
 }
 
+float CurveTimeline::getQuantizedBezierValue(float time, float time1, float value1, float time2, float value2,
+											 size_t bezier) {
+	const unsigned short *control = _quantizedCurves.buffer() + (bezier << 2);
+	float cx1 = control[0] * (1 / 65535.0f), cx2 = control[2] * (1 / 65535.0f);
+	float x = (time - time1) / (time2 - time1);
+	// Finds the same samples setBezier() would have stored, relative to the frames. They don't depend on each other, so
+	// all are computed and counted without branches. x is before the end, so only samples are counted.
+	int segment = 0;
+	for (int n = 1; n < 13; n++)
+		segment += cx1 * BEZIER_WEIGHTS1[n] + cx2 * BEZIER_WEIGHTS2[n] + BEZIER_WEIGHTS3[n] < x;
+	int next = segment + 1;
+	float x1 = cx1 * BEZIER_WEIGHTS1[segment] + cx2 * BEZIER_WEIGHTS2[segment] + BEZIER_WEIGHTS3[segment];
+	float x2 = cx1 * BEZIER_WEIGHTS1[next] + cx2 * BEZIER_WEIGHTS2[next] + BEZIER_WEIGHTS3[next];
+	float dy1 = _quantizedMin + control[1] * _quantizedScale - value1;
+	float dy2 = _quantizedMin + control[3] * _quantizedScale - value1, dy3 = value2 - value1;
+	float y1 = value1 + dy1 * BEZIER_WEIGHTS1[segment] + dy2 * BEZIER_WEIGHTS2[segment] + dy3 * BEZIER_WEIGHTS3[segment];
+	float y2 = value1 + dy1 * BEZIER_WEIGHTS1[next] + dy2 * BEZIER_WEIGHTS2[next] + dy3 * BEZIER_WEIGHTS3[next];
+	return y1 + (x - x1) / (x2 - x1) * (y2 - y1);
+}
+
+void CurveTimeline::setQuantized(bool quantized) {
+	_quantized = quantized;
+}
+
+bool CurveTimeline::isQuantized() {
+	return _quantized;
+}
+
+void CurveTimeline::setQuantizedBeziers(Vector<float> &controls) {
+	size_t n = controls.size();
+	float min = 0, max = 0;
+	for (size_t i = 1; i < n; i += 2) {
+		float y = controls[i];
+		if (i == 1 || y < min) min = y;
+		if (i == 1 || y > max) max = y;
+	}
+	_quantizedMin = min;
+	_quantizedScale = (max - min) / 65535;
+	_quantizedCurves.ensureCapacity(n);
+	_quantizedCurves.setSize(n, 0);
+	for (size_t i = 0; i < n; i += 2) {
+		_quantizedCurves[i] = (unsigned short) (MathUtil::clamp(controls[i], 0, 1) * 65535 + 0.5f);
+		float y = _quantizedScale > 0 ? (controls[i + 1] - min) / _quantizedScale : 0;
+		_quantizedCurves[i + 1] = (unsigned short) (MathUtil::clamp(y, 0, 65535) + 0.5f);
+	}
+}
+
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
 
+Vector<unsigned short> &CurveTimeline::getQuantizedCurves() {
+	return _quantizedCurves;
+}
+
+float CurveTimeline::getQuantizedMin() {
+	return _quantizedMin;
+}
+
+float CurveTimeline::getQuantizedScale() {
+	return _quantizedScale;
+}
+
 RTTI_IMPL(CurveTimeline1, CurveTimeline)
 
 CurveTimeline1::CurveTimeline1(size_t frameCount, size_t bezierCount) : CurveTimeline(frameCount,
@@ -114,14 +188,8 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 	_frames[frame + CurveTimeline1::VALUE] = value;
 }
 
-float CurveTimeline1::getCurveValue(float time) {
-	int i = _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+float CurveTimeline1::getCurveValue(float time, size_t *cursor) {
+	int i = searchFrame(time, cursor);
 
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
@@ -61,7 +61,7 @@ DeformTimeline::DeformTimeline(size_t frameCount, size_t bezierCount, int slotIn
 }
 
 void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -184,7 +184,7 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	}
 
 	// Interpolate between the previous frame and the current frame.
-	int frame = Animation::search(frames, time);
+	int frame = searchFrame(time, cursor);
 	float percent = getCurvePercent(time, frame);
 	Vector<float> &prevVertices = vertices[frame];
 	Vector<float> &nextVertices = vertices[frame + 1];
@@ -267,6 +267,7 @@ void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float t
 	SP_UNUSED(value2);
 	size_t i = getFrameCount() + bezier * DeformTimeline::BEZIER_SIZE;
 	if (value == 0) _curves[frame] = DeformTimeline::BEZIER + i;
+	if (_quantized) return;
 	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = cy2 * 0.03 - cy1 * 0.06;
 	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = (cy1 - cy2 + 0.33333333) * 0.018;
 	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
@@ -298,6 +299,9 @@ float DeformTimeline::getCurvePercent(float time, int frame) {
 		}
 	}
 	i -= DeformTimeline::BEZIER;
+	if (_quantized)
+		return getQuantizedBezierValue(time, _frames[frame], 0, _frames[frame + getFrameEntries()], 1,
+									   (i - getFrameCount()) / DeformTimeline::BEZIER_SIZE);
 	if (_curves[i] > time) {
 		float x = _frames[frame];
 		return _curves[i + 1] * (time - x) / (_curves[i] - x);
@@ -38,11 +38,13 @@ THE SOFTWARE.
 #define _BSD_SOURCE
 #endif
 
+#include <spine/Arena.h>
 #include <spine/Extension.h>
 #include <spine/Json.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
+#include <ctype.h>
 #include <math.h>
 
 using namespace spine;
@@ -59,7 +61,8 @@ const char *Json::_error = NULL;
 
 Json *Json::getItem(Json *object, const char *string) {
 	Json *c = object->_child;
-	while (c && json_strcasecmp(c->_name, string)) {
+	/* Comparing the first characters, case folded for letters, rejects most members without a call. */
+	while (c && (!c->_name || ((c->_name[0] | 0x20) != (string[0] | 0x20)) || json_strcasecmp(c->_name, string))) {
 		c = c->_next;
 	}
 	return c;
@@ -111,6 +114,35 @@ const char *Json::getError() {
 	return _error;
 }
 
+bool Json::peekString(const char *value, const char *object, const char *name, String &result) {
+	const char *target = object;
+	value = skip(value);
+	if (!value || *value != '{') return false;
+	value = skip(value + 1);
+	while (*value == '\"') {
+		bool found = nameEquals(value, target);
+		value = skip(skipString(value));
+		if (!value || *value != ':') return false;
+		value = skip(value + 1);
+		if (found && target == object && *value == '{') {
+			/* Search the members of the object instead. */
+			target = name;
+			value = skip(value + 1);
+			continue;
+		}
+		if (found && target == name && *value == '\"') {
+			Json item(NULL);
+			if (!skipString(value) || !parseString(&item, value)) return false;
+			result = item._valueString;
+			return true;
+		}
+		value = skip(skipValue(value));
+		if (!value) return false;
+		if (*value == ',') value = skip(value + 1);
+	}
+	return false;
+}
+
 Json::Json(const char *value) : _next(NULL),
 #if SPINE_JSON_HAVE_PREV
 								_prev(NULL),
@@ -121,8 +153,11 @@ Json::Json(const char *value) : _next(NULL),
 								_valueString(NULL),
 								_valueInt(0),
 								_valueFloat(0),
-								_name(NULL) {
+								_name(NULL),
+								_arena(NULL) {
 	if (value) {
+		_arena = new (SpineExtension::alloc<Arena>(1, __FILE__, __LINE__)) Arena();
+		ArenaScope arenaScope(_arena);
 		value = parseValue(this, skip(value));
 
 		assert(value);
@@ -130,6 +165,14 @@ Json::Json(const char *value) : _next(NULL),
 }
 
 Json::~Json() {
+	if (_arena) {
+		/* Everything below the root came from the arena, unless the extension doesn't serve arenas. */
+		bool nodesInArena = _arena->getAllocationCount() > 0;
+		_arena->~Arena();
+		SpineExtension::free(_arena, __FILE__, __LINE__);
+		if (nodesInArena) return;
+	}
+
 	spine::Json *curr = NULL;
 	spine::Json *next = _child;
 	do {
@@ -341,42 +384,48 @@ const char *Json::parseString(Json *item, const char *str) {
 	return ptr;
 }
 
+/* Exactly representable powers of ten, so a mantissa of up to 15 digits is scaled with a single correctly rounded
+ * operation. */
+static const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+									 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
 const char *Json::parseNumber(Json *item, const char *num) {
-	double result = 0.0;
+	unsigned long long mantissa = 0;
+	int exponent = 0, digits = 0;
 	int negative = 0;
-	char *ptr = (char *) num;
+	const char *ptr = num;
 
 	if (*ptr == '-') {
 		negative = -1;
 		++ptr;
 	}
 
+	/* Digits beyond what the mantissa holds only scale the result, they are below float precision anyway. */
 	while (*ptr >= '0' && *ptr <= '9') {
-		result = result * 10.0 + (*ptr - '0');
+		if (digits < 19) {
+			mantissa = mantissa * 10 + (*ptr - '0');
+			if (mantissa) digits++;
+		} else
+			exponent++;
 		++ptr;
 	}
 
 	if (*ptr == '.') {
-		double fraction = 0.0;
-		int n = 0;
 		++ptr;
 
 		while (*ptr >= '0' && *ptr <= '9') {
-			fraction = (fraction * 10.0) + (*ptr - '0');
+			if (digits < 19) {
+				mantissa = mantissa * 10 + (*ptr - '0');
+				if (mantissa) digits++;
+				exponent--;
+			}
 			++ptr;
-			++n;
 		}
-		result += fraction / pow(10.0, n);
-	}
-
-	if (negative) {
-		result = -result;
 	}
 
 	if (*ptr == 'e' || *ptr == 'E') {
-		double exponent = 0;
+		int value = 0;
 		int expNegative = 0;
-		int n = 0;
 		++ptr;
 
 		if (*ptr == '-') {
@@ -387,20 +436,24 @@ const char *Json::parseNumber(Json *item, const char *num) {
 		}
 
 		while (*ptr >= '0' && *ptr <= '9') {
-			exponent = (exponent * 10.0) + (*ptr - '0');
+			if (value < 100000) value = value * 10 + (*ptr - '0');
 			++ptr;
-			++n;
 		}
 
-		if (expNegative) {
-			result = result / pow(10, exponent);
-		} else {
-			result = result * pow(10, exponent);
-		}
+		exponent += expNegative ? -value : value;
 	}
 
 	if (ptr != num) {
 		/* Parse success, number found. */
+		double result = (double) mantissa;
+		if (exponent < 0) {
+			result = exponent >= -22 ? result / powersOfTen[-exponent] : result / pow(10.0, -exponent);
+		} else if (exponent > 0) {
+			result = exponent <= 22 ? result * powersOfTen[exponent] : result * pow(10.0, exponent);
+		}
+		if (negative) {
+			result = -result;
+		}
 		item->_valueFloat = (float) result;
 		item->_valueInt = (int) result;
 		item->_type = JSON_NUMBER;
@@ -543,6 +596,67 @@ const char *Json::parseObject(Json *item, const char *value) {
 	return NULL; /* malformed. */
 }
 
+const char *Json::skipValue(const char *value) {
+	if (*value == '\"') return skipString(value);
+	if (*value != '{' && *value != '[') {
+		/* Numbers, true, false and null. */
+		const char *start = value;
+		while (*value && *value != ',' && *value != '}' && *value != ']' && (unsigned char) *value > 32) {
+			value++;
+		}
+		if (value == start) {
+			_error = value;
+			return NULL;
+		}
+		return value;
+	}
+
+	int depth = 0;
+	while (*value) {
+		if (*value == '\"') {
+			/* Unterminated string, _error is set. */
+			value = skipString(value);
+			if (!value) return NULL;
+			continue;
+		}
+		if (*value == '{' || *value == '[') depth++;
+		else if ((*value == '}' || *value == ']') && --depth == 0)
+			return value + 1;
+		value++;
+	}
+	_error = value;
+	return NULL;
+}
+
+const char *Json::skipString(const char *str) {
+	if (*str != '\"') {
+		_error = str;
+		return NULL;
+	}
+	str++;
+	while (*str != '\"') {
+		if (!*str) {
+			_error = str;
+			return NULL;
+		}
+		if (*str++ == '\\' && *str) {
+			str++;
+		}
+	}
+	return str + 1;
+}
+
+bool Json::nameEquals(const char *str, const char *name) {
+	/* Names are compared as written, member names of skeleton exports have no escapes. */
+	str++;
+	while (*name && *str != '\"' && *str) {
+		if (*str != *name && tolower((unsigned char) *str) != tolower((unsigned char) *name)) return false;
+		str++;
+		name++;
+	}
+	return !*name && *str == '\"';
+}
+
 int Json::json_strcasecmp(const char *s1, const char *s2) {
 	/* TODO we may be able to elide these NULL checks if we can prove
 	 * the graph and input (only callsite is Json_getItem) should not have NULLs
@@ -55,7 +55,7 @@ PathConstraintMixTimeline::PathConstraintMixTimeline(size_t frameCount, size_t b
 }
 
 void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-									  MixBlend blend, MixDirection direction) {
+									  MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -82,7 +82,7 @@ void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float
 	}
 
 	float rotate, x, y;
-	int i = Animation::search(_frames, time, PathConstraintMixTimeline::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i >> 2];
 	switch (curveType) {
 		case LINEAR: {
@@ -56,7 +56,7 @@ ScaleTimeline::ScaleTimeline(size_t frameCount, size_t bezierCount, int boneInde
 ScaleTimeline::~ScaleTimeline() {}
 
 void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 
@@ -79,7 +79,7 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -169,7 +169,7 @@ ScaleXTimeline::ScaleXTimeline(size_t frameCount, size_t bezierCount, int boneIn
 ScaleXTimeline::~ScaleXTimeline() {}
 
 void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 
@@ -189,7 +189,7 @@ void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		return;
 	}
 
-	float x = getCurveValue(time) * bone->_data._scaleX;
+	float x = getCurveValue(time, cursor) * bone->_data._scaleX;
 	if (alpha == 1) {
 		if (blend == MixBlend_Add)
 			bone->_scaleX += x - bone->_data._scaleX;
@@ -242,7 +242,7 @@ ScaleYTimeline::ScaleYTimeline(size_t frameCount, size_t bezierCount, int boneIn
 ScaleYTimeline::~ScaleYTimeline() {}
 
 void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 
@@ -262,7 +262,7 @@ void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		return;
 	}
 
-	float y = getCurveValue(time) * bone->_data._scaleY;
+	float y = getCurveValue(time, cursor) * bone->_data._scaleY;
 	if (alpha == 1) {
 		if (blend == MixBlend_Add)
 			bone->_scaleY += y - bone->_data._scaleY;
@@ -57,7 +57,7 @@ ShearTimeline::~ShearTimeline() {
 }
 
 void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -81,7 +81,7 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline2::LINEAR: {
@@ -134,7 +134,7 @@ ShearXTimeline::~ShearXTimeline() {
 }
 
 void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -155,7 +155,7 @@ void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		return;
 	}
 
-	float x = getCurveValue(time);
+	float x = getCurveValue(time, cursor);
 	switch (blend) {
 		case MixBlend_Setup:
 			bone->_shearX = bone->_data._shearX + x * alpha;
@@ -182,7 +182,7 @@ ShearYTimeline::~ShearYTimeline() {
 }
 
 void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -203,7 +203,7 @@ void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		return;
 	}
 
-	float y = getCurveValue(time);
+	float y = getCurveValue(time, cursor);
 	switch (blend) {
 		case MixBlend_Setup:
 			bone->_shearY = bone->_data._shearY + y * alpha;
@@ -53,11 +53,20 @@
 
 #include <spine/ContainerUtil.h>
 
+#include <atomic>
 #include <float.h>
 
 using namespace spine;
 
+static size_t nextPoseVersion() {
+	static std::atomic<size_t> version(0);
+	return version.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
+												 _usePoseBuffer(false),
+												 _poseVersion(nextPoseVersion()),
+												 _comparePoses(false),
 												 _skin(NULL),
 												 _color(1, 1, 1, 1),
 												 _time(0),
@@ -65,6 +74,9 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 												 _scaleY(1),
 												 _x(0),
 												 _y(0) {
+	ArenaScope arenaScope(_data->getUseArena() ? &_arena : NULL);
+	_arena.reserve(_data->_skeletonArenaBytes.load(std::memory_order_relaxed));
+
 	_bones.ensureCapacity(_data->getBones().size());
 	for (size_t i = 0; i < _data->getBones().size(); ++i) {
 		BoneData *data = _data->getBones()[i];
@@ -121,9 +133,15 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 	}
 
 	updateCache();
+
+	// Skeletons may be created on several threads at once.
+	size_t usedBytes = _arena.getUsedBytes(), largest = _data->_skeletonArenaBytes.load(std::memory_order_relaxed);
+	while (usedBytes > largest && !_data->_skeletonArenaBytes.compare_exchange_weak(largest, usedBytes, std::memory_order_relaxed)) {
+	}
 }
 
 Skeleton::~Skeleton() {
+	ArenaScope arenaScope(_data->getUseArena() ? &_arena : NULL);
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
@@ -193,6 +211,8 @@ continue_outer:
 	for (i = 0; i < n; ++i) {
 		sortBone(_bones[i]);
 	}
+
+	if (_usePoseBuffer) updatePoseRuns();
 }
 
 void Skeleton::printUpdateCache() {
@@ -222,9 +242,182 @@ void Skeleton::updateWorldTransform() {
 		bone->_ashearY = bone->_shearY;
 	}
 
-	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
+	size_t i = 0, n = _updateCache.size();
+	if (_usePoseBuffer) {
+		for (size_t r = 0, rn = _poseRuns.size(); r < rn; r += 2) {
+			for (size_t start = _poseRuns[r]; i < start; ++i)
+				_updateCache[i]->update();
+			updateBoneRun(_poseRuns[r], _poseRuns[r + 1]);
+			i = _poseRuns[r + 1];
+		}
+	}
+	for (; i < n; ++i) {
 		_updateCache[i]->update();
 	}
+
+	if (_comparePoses) updatePoseVersion();
+	else _poseVersion = nextPoseVersion();
+}
+
+template<typename T>
+static inline void updateSnapshot(Vector<T> &snapshot, size_t &index, T value, bool &changed) {
+	if (index == snapshot.size()) {
+		snapshot.add(value);
+		changed = true;
+	} else if (snapshot[index] != value) {
+		snapshot[index] = value;
+		changed = true;
+	}
+	index++;
+}
+
+void Skeleton::updatePoseVersion() {
+	bool changed = false;
+	size_t f = 0, o = 0;
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
+		Bone &bone = *_bones[i];
+		updateSnapshot(_poseSnapshot, f, bone._a, changed);
+		updateSnapshot(_poseSnapshot, f, bone._b, changed);
+		updateSnapshot(_poseSnapshot, f, bone._c, changed);
+		updateSnapshot(_poseSnapshot, f, bone._d, changed);
+		updateSnapshot(_poseSnapshot, f, bone._worldX, changed);
+		updateSnapshot(_poseSnapshot, f, bone._worldY, changed);
+	}
+	for (size_t i = 0, n = _drawOrder.size(); i < n; ++i) {
+		Slot &slot = *_drawOrder[i];
+		updateSnapshot(_poseSnapshotObjects, o, (void *) &slot, changed);
+		updateSnapshot(_poseSnapshotObjects, o, (void *) slot._attachment, changed);
+		updateSnapshot(_poseSnapshot, f, slot._color.r, changed);
+		updateSnapshot(_poseSnapshot, f, slot._color.g, changed);
+		updateSnapshot(_poseSnapshot, f, slot._color.b, changed);
+		updateSnapshot(_poseSnapshot, f, slot._color.a, changed);
+		if (slot._hasDarkColor) {
+			updateSnapshot(_poseSnapshot, f, slot._darkColor.r, changed);
+			updateSnapshot(_poseSnapshot, f, slot._darkColor.g, changed);
+			updateSnapshot(_poseSnapshot, f, slot._darkColor.b, changed);
+		}
+		// The deform length is part of the snapshot, so deforms of different lengths don't compare equal by accident.
+		Vector<float> &deform = slot._deform;
+		updateSnapshot(_poseSnapshot, f, (float) deform.size(), changed);
+		for (size_t ii = 0, nn = deform.size(); ii < nn; ++ii)
+			updateSnapshot(_poseSnapshot, f, deform[ii], changed);
+	}
+	updateSnapshot(_poseSnapshot, f, _color.r, changed);
+	updateSnapshot(_poseSnapshot, f, _color.g, changed);
+	updateSnapshot(_poseSnapshot, f, _color.b, changed);
+	updateSnapshot(_poseSnapshot, f, _color.a, changed);
+
+	if (f < _poseSnapshot.size() || o < _poseSnapshotObjects.size()) {
+		_poseSnapshot.setSize(f, 0);
+		_poseSnapshotObjects.setSize(o, NULL);
+		changed = true;
+	}
+	if (changed) _poseVersion = nextPoseVersion();
+}
+
+size_t Skeleton::getPoseVersion() {
+	return _poseVersion;
+}
+
+void Skeleton::incrementPoseVersion() {
+	_poseVersion = nextPoseVersion();
+}
+
+void Skeleton::setComparePoses(bool inValue) {
+	if (_comparePoses == inValue) return;
+	_comparePoses = inValue;
+	// A stale snapshot could match the next pose, so the first comparison after enabling always changes the version.
+	_poseSnapshot.clear();
+	_poseSnapshotObjects.clear();
+}
+
+bool Skeleton::getComparePoses() {
+	return _comparePoses;
+}
+
+void Skeleton::setUsePoseBuffer(bool inValue) {
+	if (_usePoseBuffer == inValue) return;
+	_usePoseBuffer = inValue;
+	if (_usePoseBuffer) updatePoseRuns();
+	else {
+		_poseRuns.clear();
+		_poseX.clear();
+		_poseY.clear();
+		_poseA.clear();
+		_poseB.clear();
+		_poseC.clear();
+		_poseD.clear();
+	}
+}
+
+bool Skeleton::getUsePoseBuffer() {
+	return _usePoseBuffer;
+}
+
+void Skeleton::updatePoseRuns() {
+	_poseRuns.clear();
+	size_t maxRun = 0;
+	for (size_t i = 0, n = _updateCache.size(); i < n;) {
+		size_t start = i;
+		while (i < n && _updateCache[i]->getRTTI().isExactly(Bone::rtti)) {
+			Bone *bone = static_cast<Bone *>(_updateCache[i]);
+			if (!bone->_parent || bone->_data.getTransformMode() != TransformMode_Normal) break;
+			i++;
+		}
+		// Single bones gain nothing from batching.
+		if (i - start > 1) {
+			_poseRuns.add(start);
+			_poseRuns.add(i);
+			if (i - start > maxRun) maxRun = i - start;
+		}
+		if (i == start) i++;
+	}
+	_poseX.setSize(maxRun, 0);
+	_poseY.setSize(maxRun, 0);
+	_poseA.setSize(maxRun, 0);
+	_poseB.setSize(maxRun, 0);
+	_poseC.setSize(maxRun, 0);
+	_poseD.setSize(maxRun, 0);
+}
+
+void Skeleton::updateBoneRun(size_t start, size_t end) {
+	Updatable **bones = _updateCache.buffer() + start;
+	size_t count = end - start;
+	float *x = _poseX.buffer(), *y = _poseY.buffer();
+	float *la = _poseA.buffer(), *lb = _poseB.buffer(), *lc = _poseC.buffer(), *ld = _poseD.buffer();
+
+	// Local matrices don't depend on the parent chain, so this loop has no loop carried dependencies and the
+	// polynomial sine/cosine can be vectorized.
+	for (size_t i = 0; i < count; i++) {
+		Bone &bone = *static_cast<Bone *>(bones[i]);
+		float rotation = bone._arotation, scaleX = bone._ascaleX, scaleY = bone._ascaleY;
+		float sx, cx, sy, cy;
+		MathUtil::sinCosDeg(rotation + bone._ashearX, sx, cx);
+		MathUtil::sinCosDeg(rotation + 90 + bone._ashearY, sy, cy);
+		x[i] = bone._ax;
+		y[i] = bone._ay;
+		la[i] = cx * scaleX;
+		lb[i] = cy * scaleY;
+		lc[i] = sx * scaleX;
+		ld[i] = sy * scaleY;
+	}
+
+	// Parents precede their children in the update cache, so composing in order sees final parent transforms.
+	for (size_t i = 0; i < count; i++) {
+		Bone &bone = *static_cast<Bone *>(bones[i]);
+		if (bone._data.getTransformMode() != TransformMode_Normal) {
+			bone.update();
+			continue;
+		}
+		Bone &parent = *bone._parent;
+		float pa = parent._a, pb = parent._b, pc = parent._c, pd = parent._d;
+		bone._worldX = pa * x[i] + pb * y[i] + parent._worldX;
+		bone._worldY = pc * x[i] + pd * y[i] + parent._worldY;
+		bone._a = pa * la[i] + pb * lc[i];
+		bone._b = pa * lb[i] + pb * ld[i];
+		bone._c = pc * la[i] + pd * lc[i];
+		bone._d = pc * lb[i] + pd * ld[i];
+	}
 }
 
 void Skeleton::updateWorldTransform(Bone *parent) {
@@ -308,14 +501,28 @@ void Skeleton::setSlotsToSetupPose() {
 	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
 		_slots[i]->setToSetupPose();
 	}
+	incrementPoseVersion();
 }
 
 Bone *Skeleton::findBone(const String &boneName) {
-	return ContainerUtil::findWithDataName(_bones, boneName);
+	return findBone(boneName.buffer());
+}
+
+Bone *Skeleton::findBone(const char *boneName) {
+	// Bones are created in the order of the skeleton data's bones.
+	BoneData *boneData = _data->findBone(boneName);
+	if (!boneData || boneData->getIndex() >= (int) _bones.size()) return NULL;
+	return _bones[boneData->getIndex()];
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
-	return ContainerUtil::findWithDataName(_slots, slotName);
+	return findSlot(slotName.buffer());
+}
+
+Slot *Skeleton::findSlot(const char *slotName) {
+	SlotData *slotData = _data->findSlot(slotName);
+	if (!slotData || slotData->getIndex() >= (int) _slots.size()) return NULL;
+	return _slots[slotData->getIndex()];
 }
 
 void Skeleton::setSkin(const String &skinName) {
@@ -34,6 +34,7 @@
 #include <spine/SkeletonBinary.h>
 
 #include <spine/Animation.h>
+#include <spine/AnimationCache.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
@@ -58,6 +59,7 @@
 #include <spine/IkConstraintData.h>
 #include <spine/IkConstraintTimeline.h>
 #include <spine/MeshAttachment.h>
+#include <spine/ParallelRunner.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraintData.h>
 #include <spine/PathConstraintMixTimeline.h>
@@ -75,16 +77,95 @@
 
 using namespace spine;
 
+namespace {
+	// Animations decoded in parallel are split into at most this many jobs. Each job allocates from its own arena.
+	const int MAX_ANIMATION_JOBS = 32;
+
+	struct AnimationJobs {
+		SkeletonBinary *binary;
+		SkeletonData *skeletonData;
+		const unsigned char *end;
+		Vector<const unsigned char *> starts;// Where each animation starts, followed by where the last one ends.
+		Vector<int> firstAnimations;         // The first animation of each job, followed by the animation count.
+		Vector<String> errors;               // Set by the jobs that failed.
+	};
+
+	// Reads a float at the given position, as SkeletonBinary::readFloat() does.
+	float readFloatAt(const unsigned char *cursor) {
+		union {
+			int intValue;
+			float floatValue;
+		} intToFloat;
+		intToFloat.intValue = (cursor[0] << 24) | (cursor[1] << 16) | (cursor[2] << 8) | cursor[3];
+		return intToFloat.floatValue;
+	}
+}
+
+/// Keeps a copy of the encoded animations and decodes the timelines of an animation when it is first used.
+class SkeletonBinary::LazyAnimationCache : public AnimationCache {
+public:
+	LazyAnimationCache(SkeletonData *skeletonData, float scale, bool quantizeCurves, const unsigned char *data, size_t length)
+		: _skeletonData(skeletonData), _reader((Atlas *) NULL) {
+		_reader._scale = scale;
+		_reader._quantizeCurves = quantizeCurves;
+		_data.ensureCapacity(length);
+		_data.setSize(length, 0);
+		memcpy(_data.buffer(), data, length);
+	}
+
+	virtual size_t getEncodedBytes() {
+		return _data.size();
+	}
+
+	/// Creates a stub for the animation whose name starts at the given offset.
+	Animation *addAnimation(size_t offset, float duration) {
+		DataInput input;
+		input.cursor = _data.buffer() + offset;
+		input.end = _data.buffer() + _data.size();
+		String name(_reader.readString(&input), true);
+		Vector<Timeline *> timelines;
+		Animation *animation = new (__FILE__, __LINE__) Animation(name, timelines, duration);
+		animation->_offset = (size_t) (input.cursor - _data.buffer());
+		add(animation);
+		return animation;
+	}
+
+protected:
+	virtual bool decode(Animation &animation, Vector<Timeline *> &timelines) {
+		DataInput input;
+		input.cursor = _data.buffer() + animation._offset;
+		input.end = _data.buffer() + _data.size();
+		Animation *decoded = _reader.readAnimation(animation.getName(), &input, _skeletonData);
+		if (!decoded) return false;
+		timelines.addAll(decoded->_timelines);
+		decoded->_timelines.clear();
+		delete decoded;
+		return true;
+	}
+
+private:
+	SkeletonData *_skeletonData;
+	SkeletonBinary _reader; // Reads no attachments, so it needs no atlas.
+	Vector<unsigned char> _data;
+};
+
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _ownsLoader(true), _useArena(false),
+													_parallelRunner(NULL), _lazyAnimations(false), _quantizeCurves(false),
+													_bezierTimeline(NULL) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
-																					  _ownsLoader(ownsLoader) {
+																					  _ownsLoader(ownsLoader),
+																					  _useArena(false),
+																					  _parallelRunner(NULL),
+																					  _lazyAnimations(false),
+																					  _quantizeCurves(false),
+																					  _bezierTimeline(NULL) {
 	assert(_attachmentLoader != NULL);
 }
 
@@ -106,6 +187,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	_linkedMeshes.clear();
 
 	skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	skeletonData->_useArena = _useArena;
+	ArenaScope arenaScope(_useArena ? &skeletonData->_arena : NULL);
 
 	char buffer[16] = {0};
 	int lowHash = readInt(input);
@@ -327,7 +410,18 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	/* Animations. */
 	int animationsCount = readVarint(input, true);
 	skeletonData->_animations.setSize(animationsCount, 0);
-	for (int i = 0; i < animationsCount; ++i) {
+	int i = 0;
+	if (_lazyAnimations && animationsCount > 0) {
+		i = readLazyAnimations(input, animationsCount, skeletonData);
+	} else if (_parallelRunner && animationsCount > 1) {
+		i = readAnimations(input, animationsCount, skeletonData);
+	}
+	if (i == -1) {
+		delete input;
+		delete skeletonData;
+		return NULL;
+	}
+	for (; i < animationsCount; ++i) {
 		String name(readString(input), true);
 		Animation *animation = readAnimation(name, input, skeletonData);
 		if (!animation) {
@@ -337,6 +431,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 		}
 		skeletonData->_animations[i] = animation;
 	}
+	skeletonData->updateNameIndices();
 
 	delete input;
 	return skeletonData;
@@ -361,6 +456,7 @@ void SkeletonBinary::setError(const char *value1, const char *value2) {
 	strcpy(message, value1);
 	length = (int) strlen(value1);
 	if (value2) strncat(message + length, value2, 255 - length);
+	ArenaScope noArena(NULL);
 	_error = String(message);
 }
 
@@ -439,6 +535,12 @@ int SkeletonBinary::readVarint(DataInput *input, bool optimizePositive) {
 	return value;
 }
 
+int SkeletonBinary::readBezierCount(DataInput *input) {
+	int bezierCount = readVarint(input, true);
+	// Quantized curves are constructed without room for the samples, see CurveTimeline::setQuantizedBeziers().
+	return _quantizeCurves ? 0 : bezierCount;
+}
+
 Skin *SkeletonBinary::readSkin(DataInput *input, bool defaultSkin, SkeletonData *skeletonData, bool nonessential) {
 	Skin *skin;
 	int slotCount = 0;
@@ -569,6 +671,8 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 				mesh->_height = readFloat(input) * _scale;
 			}
 
+			// Linked meshes are owned by the loader, which may outlive the skeleton data's arena.
+			ArenaScope noArena(NULL);
 			LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh, String(skinName), slotIndex,
 																		 String(parent), inheritDeform);
 			_linkedMeshes.add(linkedMesh);
@@ -620,6 +724,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 				return nullptr;
 			}
 			readVertices(input, static_cast<VertexAttachment *>(clip), vertexCount);
+			clip->updateConvexPolygons();
 			clip->_endSlot = skeletonData->_slots[endSlotIndex];
 			if (nonessential) {
 				readColor(input, clip->getColor());
@@ -656,6 +761,7 @@ void SkeletonBinary::readVertices(DataInput *input, VertexAttachment *attachment
 			vertices.add(readFloat(input));
 		}
 	}
+	attachment->updateSkinning();
 }
 
 void SkeletonBinary::readFloatArray(DataInput *input, int n, float scale, Vector<float> &array) {
@@ -691,7 +797,29 @@ void SkeletonBinary::setBezier(DataInput *input, CurveTimeline *timeline, int be
 	float cy1 = readFloat(input);
 	float cx2 = readFloat(input);
 	float cy2 = readFloat(input);
+	// The timeline was constructed without room for the samples, its control values are kept until all are read.
+	if (_quantizeCurves && timeline != _bezierTimeline) quantizeBeziers(timeline);
 	timeline->setBezier(bezier, frame, value, time1, value1, cx1, cy1 * scale, cx2, cy2 * scale, time2, value2);
+	if (_quantizeCurves) {
+		size_t i = bezier << 2;
+		if (_bezierControls.size() < i + 4) {
+			// Reused by the following loads, so not allocated from the skeleton data's arena.
+			ArenaScope noArena(NULL);
+			_bezierControls.setSize(i + 4, 0);
+		}
+		float width = time2 - time1;
+		_bezierControls[i] = width > 0 ? (cx1 - time1) / width : 0;
+		_bezierControls[i + 1] = cy1 * scale;
+		_bezierControls[i + 2] = width > 0 ? (cx2 - time1) / width : 0;
+		_bezierControls[i + 3] = cy2 * scale;
+	}
+}
+
+void SkeletonBinary::quantizeBeziers(CurveTimeline *next) {
+	if (_bezierTimeline) _bezierTimeline->setQuantizedBeziers(_bezierControls);
+	if (next) next->setQuantized(true);
+	_bezierTimeline = next;
+	_bezierControls.clear();
 }
 
 Timeline *SkeletonBinary::readTimeline(DataInput *input, CurveTimeline1 *timeline, float scale) {
@@ -743,6 +871,7 @@ Timeline *SkeletonBinary::readTimeline2(DataInput *input, CurveTimeline2 *timeli
 Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) {
 	Vector<Timeline *> timelines;
 	float scale = _scale;
+	_bezierTimeline = NULL; // A previous animation may have failed before its beziers were quantized.
 	int numTimelines = readVarint(input, true);
 	SP_UNUSED(numTimelines);
 	// Slot timelines.
@@ -764,7 +893,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					break;
 				}
 				case SLOT_RGBA: {
-					int bezierCount = readVarint(input, true);
+					int bezierCount = readBezierCount(input);
 					RGBATimeline *timeline = new (__FILE__, __LINE__) RGBATimeline(frameCount, bezierCount, slotIndex);
 
 					float time = readFloat(input);
@@ -803,7 +932,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					break;
 				}
 				case SLOT_RGB: {
-					int bezierCount = readVarint(input, true);
+					int bezierCount = readBezierCount(input);
 					RGBTimeline *timeline = new (__FILE__, __LINE__) RGBTimeline(frameCount, bezierCount, slotIndex);
 
 					float time = readFloat(input);
@@ -838,7 +967,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					break;
 				}
 				case SLOT_RGBA2: {
-					int bezierCount = readVarint(input, true);
+					int bezierCount = readBezierCount(input);
 					RGBA2Timeline *timeline = new (__FILE__, __LINE__) RGBA2Timeline(frameCount, bezierCount, slotIndex);
 
 					float time = readFloat(input);
@@ -888,7 +1017,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					break;
 				}
 				case SLOT_RGB2: {
-					int bezierCount = readVarint(input, true);
+					int bezierCount = readBezierCount(input);
 					RGB2Timeline *timeline = new (__FILE__, __LINE__) RGB2Timeline(frameCount, bezierCount, slotIndex);
 
 					float time = readFloat(input);
@@ -934,7 +1063,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					break;
 				}
 				case SLOT_ALPHA: {
-					int bezierCount = readVarint(input, true);
+					int bezierCount = readBezierCount(input);
 					AlphaTimeline *timeline = new (__FILE__, __LINE__) AlphaTimeline(frameCount, bezierCount, slotIndex);
 					float time = readFloat(input);
 					float a = readByte(input) / 255.0;
@@ -971,7 +1100,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
 			unsigned char timelineType = readByte(input);
 			int frameCount = readVarint(input, true);
-			int bezierCount = readVarint(input, true);
+			int bezierCount = readBezierCount(input);
 			Timeline *timeline = NULL;
 			switch (timelineType) {
 				case BONE_ROTATE:
@@ -1033,7 +1162,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		int index = readVarint(input, true);
 		int frameCount = readVarint(input, true);
 		int frameLast = frameCount - 1;
-		int bezierCount = readVarint(input, true);
+		int bezierCount = readBezierCount(input);
 		IkConstraintTimeline *timeline = new (__FILE__, __LINE__) IkConstraintTimeline(frameCount, bezierCount, index);
 		float time = readFloat(input);
 		float mix = readFloat(input);
@@ -1067,7 +1196,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		int index = readVarint(input, true);
 		int frameCount = readVarint(input, true);
 		int frameLast = frameCount - 1;
-		int bezierCount = readVarint(input, true);
+		int bezierCount = readBezierCount(input);
 		TransformConstraintTimeline *timeline = new TransformConstraintTimeline(frameCount, bezierCount, index);
 		float time = readFloat(input);
 		float mixRotate = readFloat(input);
@@ -1116,7 +1245,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
 			int type = readSByte(input);
 			int frameCount = readVarint(input, true);
-			int bezierCount = readVarint(input, true);
+			int bezierCount = readBezierCount(input);
 			switch (type) {
 				case PATH_POSITION: {
 					timelines
@@ -1191,7 +1320,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 
 				int frameCount = readVarint(input, true);
 				int frameLast = frameCount - 1;
-				int bezierCount = readVarint(input, true);
+				int bezierCount = readBezierCount(input);
 				DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, slotIndex,
 																				   attachment);
 
@@ -1310,9 +1439,343 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		timelines.add(timeline);
 	}
 
+	if (_quantizeCurves) quantizeBeziers(NULL);
+
 	float duration = 0;
 	for (int i = 0, n = timelines.size(); i < n; i++) {
 		duration = MathUtil::max(duration, (timelines[i])->getDuration());
 	}
 	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
 }
+
+/// Decodes the animations on the parallel runner. Returns the number of animations read, or -1 if the first pass found the
+/// animations truncated or corrupt, or if decoding failed.
+int SkeletonBinary::readAnimations(DataInput *input, int animationsCount, SkeletonData *skeletonData) {
+	AnimationJobs jobs;
+	jobs.binary = this;
+	jobs.skeletonData = skeletonData;
+	jobs.end = input->end;
+	jobs.starts.setSize(animationsCount + 1, NULL);
+	const unsigned char *start = input->cursor;
+	for (int i = 0; i < animationsCount; ++i) {
+		jobs.starts[i] = input->cursor;
+		float duration = 0;
+		if (!skipString(input) || !skipAnimation(input, skeletonData, duration)) {
+			setError("Animation data is truncated or corrupt.", NULL);
+			return -1;
+		}
+	}
+	jobs.starts[animationsCount] = input->cursor;
+
+	// Split the animations into jobs of about equal size.
+	size_t jobSize = (size_t) (input->cursor - start) / MAX_ANIMATION_JOBS + 1;
+	const unsigned char *jobStart = start;
+	jobs.firstAnimations.add(0);
+	for (int i = 1; i < animationsCount; ++i) {
+		if ((size_t) (jobs.starts[i] - jobStart) < jobSize) continue;
+		jobs.firstAnimations.add(i);
+		jobStart = jobs.starts[i];
+	}
+	jobs.firstAnimations.add(animationsCount);
+	int jobCount = (int) jobs.firstAnimations.size() - 1;
+
+	if (skeletonData->_useArena) {
+		for (int i = 0; i < jobCount; ++i)
+			skeletonData->_animationArenas.add(new (SpineExtension::alloc<Arena>(1, __FILE__, __LINE__)) Arena());
+	}
+	jobs.errors.setSize(jobCount, String());
+	_parallelRunner->run(jobCount, readAnimationsJob, &jobs);
+
+	// Report the error of the first failed animation, as the sequential reader would.
+	for (int i = 0; i < jobCount; ++i) {
+		if (jobs.errors[i].isEmpty()) continue;
+		ArenaScope noArena(NULL);
+		_error = jobs.errors[i];
+		return -1;
+	}
+	return animationsCount;
+}
+
+void SkeletonBinary::readAnimationsJob(void *context, int job) {
+	AnimationJobs *jobs = (AnimationJobs *) context;
+	SkeletonData *skeletonData = jobs->skeletonData;
+	// A reader per job, so errors are not set concurrently.
+	SkeletonBinary reader(jobs->binary->_attachmentLoader);
+	reader._scale = jobs->binary->_scale;
+	reader._quantizeCurves = jobs->binary->_quantizeCurves;
+	ArenaScope arenaScope(skeletonData->_useArena ? skeletonData->_animationArenas[job] : NULL);
+
+	DataInput input;
+	input.end = jobs->end;
+	for (int i = jobs->firstAnimations[job], n = jobs->firstAnimations[job + 1]; i < n; ++i) {
+		input.cursor = jobs->starts[i];
+		String name(reader.readString(&input), true);
+		Animation *animation = reader.readAnimation(name, &input, skeletonData);
+		if (!animation) {
+			ArenaScope noArena(NULL);
+			jobs->errors[job] = reader._error;
+			return;
+		}
+		skeletonData->_animations[i] = animation;
+	}
+}
+
+/// Reads the animations as stubs, leaving their timelines to be decoded on demand by a cache holding a copy of the encoded
+/// animations. Returns the number of animations read, or -1 if the first pass found the animations truncated or corrupt.
+/// The sequential reader does not check bounds, so such data is rejected here rather than handed to it.
+int SkeletonBinary::readLazyAnimations(DataInput *input, int animationsCount, SkeletonData *skeletonData) {
+	const unsigned char *start = input->cursor;
+	Vector<size_t> offsets;
+	Vector<float> durations;
+	for (int i = 0; i < animationsCount; ++i) {
+		offsets.add((size_t) (input->cursor - start));
+		float duration = 0;
+		if (!skipString(input) || !skipAnimation(input, skeletonData, duration)) {
+			setError("Animation data is truncated or corrupt.", NULL);
+			return -1;
+		}
+		durations.add(duration);
+	}
+
+	LazyAnimationCache *cache = new (__FILE__, __LINE__) LazyAnimationCache(skeletonData, _scale, _quantizeCurves, start,
+																			 (size_t) (input->cursor - start));
+	skeletonData->_animationCache = cache;
+	for (int i = 0; i < animationsCount; ++i)
+		skeletonData->_animations[i] = cache->addAnimation(offsets[i], durations[i]);
+	return animationsCount;
+}
+
+/// Moves the input count bytes forward, or returns false if fewer remain.
+bool SkeletonBinary::skipBytes(DataInput *input, size_t count) {
+	if ((size_t) (input->end - input->cursor) < count) return false;
+	input->cursor += count;
+	return true;
+}
+
+bool SkeletonBinary::readCheckedByte(DataInput *input, unsigned char &value) {
+	if (input->cursor >= input->end) return false;
+	value = *input->cursor++;
+	return true;
+}
+
+/// Reads a varint as readVarint() does, or returns false if it runs past the end of the input.
+bool SkeletonBinary::readCheckedVarint(DataInput *input, bool optimizePositive, int &value) {
+	value = 0;
+	for (int shift = 0; shift <= 28; shift += 7) {
+		unsigned char b;
+		if (!readCheckedByte(input, b)) return false;
+		value |= (b & 0x7F) << shift;
+		if (!(b & 0x80)) break;
+	}
+	if (!optimizePositive) value = (((unsigned int) value >> 1) ^ -(value & 1));
+	return true;
+}
+
+/// Reads a count as a positive varint, failing for negative values.
+bool SkeletonBinary::readCheckedCount(DataInput *input, int &count) {
+	return readCheckedVarint(input, true, count) && count >= 0;
+}
+
+bool SkeletonBinary::skipString(DataInput *input) {
+	int length;
+	if (!readCheckedVarint(input, true, length)) return false;
+	return length <= 0 || skipBytes(input, (size_t) length - 1);
+}
+
+/// Skips the frames of a curve timeline whose frames take frameSize bytes, each frame after the first followed by its
+/// curve type and, for bezier curves, 4 floats per value. Raises duration to the time of the last frame.
+bool SkeletonBinary::skipFrames(DataInput *input, int frameCount, int frameSize, int valueCount, float &duration) {
+	if (frameCount <= 0) return false;
+	const unsigned char *last = input->cursor;
+	if (!skipBytes(input, frameSize)) return false;
+	for (int frame = 1; frame < frameCount; ++frame) {
+		last = input->cursor;
+		unsigned char curveType;
+		if (!skipBytes(input, frameSize) || !readCheckedByte(input, curveType)) return false;
+		if ((signed char) curveType == CURVE_BEZIER && !skipBytes(input, (size_t) valueCount << 4)) return false;
+	}
+	duration = MathUtil::max(duration, readFloatAt(last));
+	return true;
+}
+
+/// Moves the input past an animation without decoding it, mirroring readAnimation(). Sets duration to the time of the
+/// last frame of any timeline, as readAnimation() computes it. Every count is checked against the remaining input before
+/// it is skipped by, so corrupt data fails here instead of reading past the end.
+bool SkeletonBinary::skipAnimation(DataInput *input, SkeletonData *skeletonData, float &duration) {
+	duration = 0;
+	int n, nn, index, frameCount;
+	unsigned char timelineType;
+	if (!readCheckedCount(input, n)) return false;
+
+	// Slot timelines.
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		if (!readCheckedCount(input, index) || !readCheckedCount(input, nn)) return false;
+		for (int ii = 0; ii < nn; ++ii) {
+			if (!readCheckedByte(input, timelineType) || !readCheckedCount(input, frameCount)) return false;
+			if (timelineType == SLOT_ATTACHMENT) {
+				const unsigned char *last = NULL;
+				for (int frame = 0; frame < frameCount; ++frame) {
+					last = input->cursor;
+					if (!skipBytes(input, 4) || !readCheckedCount(input, index)) return false;
+				}
+				if (last) duration = MathUtil::max(duration, readFloatAt(last));
+				continue;
+			}
+			if (!readCheckedCount(input, index)) return false;
+			bool skipped = false;
+			switch (timelineType) {
+				case SLOT_RGBA:
+					skipped = skipFrames(input, frameCount, 8, 4, duration);
+					break;
+				case SLOT_RGB:
+					skipped = skipFrames(input, frameCount, 7, 3, duration);
+					break;
+				case SLOT_RGBA2:
+					skipped = skipFrames(input, frameCount, 11, 7, duration);
+					break;
+				case SLOT_RGB2:
+					skipped = skipFrames(input, frameCount, 10, 6, duration);
+					break;
+				case SLOT_ALPHA:
+					skipped = skipFrames(input, frameCount, 5, 1, duration);
+			}
+			if (!skipped) return false;
+		}
+	}
+
+	// Bone timelines.
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		if (!readCheckedCount(input, index) || !readCheckedCount(input, nn)) return false;
+		for (int ii = 0; ii < nn; ++ii) {
+			if (!readCheckedByte(input, timelineType) || !readCheckedCount(input, frameCount) ||
+				!readCheckedCount(input, index))
+				return false;
+			bool skipped = false;
+			switch (timelineType) {
+				case BONE_ROTATE:
+				case BONE_TRANSLATEX:
+				case BONE_TRANSLATEY:
+				case BONE_SCALEX:
+				case BONE_SCALEY:
+				case BONE_SHEARX:
+				case BONE_SHEARY:
+					skipped = skipFrames(input, frameCount, 8, 1, duration);
+					break;
+				case BONE_TRANSLATE:
+				case BONE_SCALE:
+				case BONE_SHEAR:
+					skipped = skipFrames(input, frameCount, 12, 2, duration);
+			}
+			if (!skipped) return false;
+		}
+	}
+
+	// IK timelines, whose frames end with a bend direction and 2 booleans that come after the curve.
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		if (!readCheckedCount(input, index) || !readCheckedCount(input, frameCount) || !readCheckedCount(input, index))
+			return false;
+		if (frameCount <= 0) return false;
+		const unsigned char *last = input->cursor;
+		if (!skipBytes(input, 12)) return false;
+		for (int frame = 0, frameLast = frameCount - 1;; frame++) {
+			if (!skipBytes(input, 3)) return false;
+			if (frame == frameLast) break;
+			last = input->cursor;
+			unsigned char curveType;
+			if (!skipBytes(input, 12) || !readCheckedByte(input, curveType)) return false;
+			if ((signed char) curveType == CURVE_BEZIER && !skipBytes(input, 2 << 4)) return false;
+		}
+		duration = MathUtil::max(duration, readFloatAt(last));
+	}
+
+	// Transform constraint timelines.
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		if (!readCheckedCount(input, index) || !readCheckedCount(input, frameCount) || !readCheckedCount(input, index))
+			return false;
+		if (!skipFrames(input, frameCount, 28, 6, duration)) return false;
+	}
+
+	// Path constraint timelines.
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		if (!readCheckedCount(input, index) || !readCheckedCount(input, nn)) return false;
+		for (int ii = 0; ii < nn; ii++) {
+			if (!readCheckedByte(input, timelineType) || !readCheckedCount(input, frameCount) ||
+				!readCheckedCount(input, index))
+				return false;
+			bool skipped = false;
+			switch ((signed char) timelineType) {
+				case PATH_POSITION:
+				case PATH_SPACING:
+					skipped = skipFrames(input, frameCount, 8, 1, duration);
+					break;
+				case PATH_MIX:
+					skipped = skipFrames(input, frameCount, 16, 3, duration);
+			}
+			if (!skipped) return false;
+		}
+	}
+
+	// Deform timelines.
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		if (!readCheckedCount(input, index) || !readCheckedCount(input, nn)) return false;
+		for (int ii = 0; ii < nn; ++ii) {
+			int nnn;
+			if (!readCheckedCount(input, index) || !readCheckedCount(input, nnn)) return false;
+			for (int iii = 0; iii < nnn; iii++) {
+				if (!readCheckedCount(input, index) || !readCheckedCount(input, frameCount) ||
+					!readCheckedCount(input, index))
+					return false;
+				if (frameCount <= 0) return false;
+				const unsigned char *last = input->cursor;
+				if (!skipBytes(input, 4)) return false;
+				for (int frame = 0, frameLast = frameCount - 1;; ++frame) {
+					int end;
+					if (!readCheckedCount(input, end)) return false;
+					if (end != 0 && (!readCheckedCount(input, index) || !skipBytes(input, (size_t) end << 2))) return false;
+					if (frame == frameLast) break;
+					last = input->cursor;
+					unsigned char curveType;
+					if (!skipBytes(input, 4) || !readCheckedByte(input, curveType)) return false;
+					if ((signed char) curveType == CURVE_BEZIER && !skipBytes(input, 1 << 4)) return false;
+				}
+				duration = MathUtil::max(duration, readFloatAt(last));
+			}
+		}
+	}
+
+	// Draw order timeline.
+	const unsigned char *last = NULL;
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		last = input->cursor;
+		if (!skipBytes(input, 4) || !readCheckedCount(input, nn)) return false;
+		// A slot index and its offset in the draw order, which may be negative.
+		for (int ii = 0; ii < nn; ++ii) {
+			if (!readCheckedCount(input, index) || !readCheckedVarint(input, true, index)) return false;
+		}
+	}
+	if (last) duration = MathUtil::max(duration, readFloatAt(last));
+
+	// Event timeline.
+	last = NULL;
+	if (!readCheckedCount(input, n)) return false;
+	for (int i = 0; i < n; ++i) {
+		last = input->cursor;
+		if (!skipBytes(input, 4) || !readCheckedCount(input, index)) return false;
+		if (index >= (int) skeletonData->_events.size()) return false;
+		int intValue;
+		unsigned char hasString;
+		if (!readCheckedVarint(input, false, intValue) || !skipBytes(input, 4) || !readCheckedByte(input, hasString))
+			return false;
+		if (hasString && !skipString(input)) return false;
+		if (!skeletonData->_events[index]->_audioPath.isEmpty() && !skipBytes(input, 8)) return false;
+	}
+	if (last) duration = MathUtil::max(duration, readFloatAt(last));
+	return true;
+}
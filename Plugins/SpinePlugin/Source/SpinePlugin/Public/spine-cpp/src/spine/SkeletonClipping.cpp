@@ -33,18 +33,27 @@
 
 #include <spine/SkeletonClipping.h>
 
+#include <spine/Bone.h>
 #include <spine/ClippingAttachment.h>
+#include <spine/ContainerUtil.h>
 #include <spine/Slot.h>
 
+#include <float.h>
+
 using namespace spine;
 
-SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
+SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL), _clippingPolygons(NULL), _minX(0), _minY(0), _maxX(0),
+									   _maxY(0) {
 	_clipOutput.ensureCapacity(128);
 	_clippedVertices.ensureCapacity(128);
 	_clippedTriangles.ensureCapacity(128);
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	ContainerUtil::cleanUpVectorOfPointers(_polygonPool);
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -52,23 +61,84 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 
 	_clipAttachment = clip;
 
-	int n = clip->getWorldVerticesLength();
-	_clippingPolygon.setSize(n, 0);
-	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
-	makeClockwise(_clippingPolygon);
-	_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
-
-	for (size_t i = 0; i < _clippingPolygons->size(); ++i) {
-		Vector<float> *polygonP = (*_clippingPolygons)[i];
-		Vector<float> &polygon = *polygonP;
-		makeClockwise(polygon);
-		polygon.add(polygon[0]);
-		polygon.add(polygon[1]);
+	if (clip->_convexPolygonEnds.size() > 0 && slot.getDeform().size() == 0) {
+		// Unweighted and undeformed, the cached decomposition only has to be transformed by the bone.
+		transformConvexPolygons(slot, clip);
+	} else {
+		int n = clip->getWorldVerticesLength();
+		_clippingPolygon.setSize(n, 0);
+		clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
+		makeClockwise(_clippingPolygon);
+		_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
+
+		for (size_t i = 0; i < _clippingPolygons->size(); ++i) {
+			Vector<float> *polygonP = (*_clippingPolygons)[i];
+			Vector<float> &polygon = *polygonP;
+			makeClockwise(polygon);
+			polygon.add(polygon[0]);
+			polygon.add(polygon[1]);
+		}
 	}
 
+	updateBounds();
 	return (*_clippingPolygons).size();
 }
 
+void SkeletonClipping::transformConvexPolygons(Slot &slot, ClippingAttachment *clip) {
+	Bone &bone = slot.getBone();
+	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
+	float x = bone.getWorldX(), y = bone.getWorldY();
+	Vector<float> &vertices = clip->_convexPolygons;
+	Vector<size_t> &ends = clip->_convexPolygonEnds;
+
+	_transformedPolygons.clear();
+	for (size_t i = 0, start = 0, n = ends.size(); i < n; start = ends[i], ++i) {
+		if (i == _polygonPool.size()) _polygonPool.add(new (__FILE__, __LINE__) Vector<float>());
+		Vector<float> &polygon = *_polygonPool[i];
+		size_t length = ends[i] - start;
+		polygon.setSize(length + 2, 0);
+		for (size_t ii = 0; ii < length; ii += 2) {
+			float vx = vertices[start + ii], vy = vertices[start + ii + 1];
+			polygon[ii] = vx * a + vy * b + x;
+			polygon[ii + 1] = vx * c + vy * d + y;
+		}
+		polygon[length] = polygon[0];
+		polygon[length + 1] = polygon[1];
+		// A reflecting bone reverses the winding.
+		if (a * d - b * c < 0) makeClockwise(polygon);
+		_transformedPolygons.add(&polygon);
+	}
+	_clippingPolygons = &_transformedPolygons;
+}
+
+void SkeletonClipping::updateBounds() {
+	Vector<Vector<float> *> &polygons = *_clippingPolygons;
+	size_t polygonsCount = polygons.size();
+	_clippingBounds.setSize(polygonsCount << 2, 0);
+	_minX = _minY = FLT_MAX;
+	_maxX = _maxY = -FLT_MAX;
+	for (size_t p = 0; p < polygonsCount; p++) {
+		Vector<float> &polygon = *polygons[p];
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		for (size_t i = 0, n = polygon.size(); i < n; i += 2) {
+			float x = polygon[i], y = polygon[i + 1];
+			if (x < minX) minX = x;
+			if (x > maxX) maxX = x;
+			if (y < minY) minY = y;
+			if (y > maxY) maxY = y;
+		}
+		float *bounds = _clippingBounds.buffer() + (p << 2);
+		bounds[0] = minX;
+		bounds[1] = minY;
+		bounds[2] = maxX;
+		bounds[3] = maxY;
+		if (minX < _minX) _minX = minX;
+		if (minY < _minY) _minY = minY;
+		if (maxX > _maxX) _maxX = maxX;
+		if (maxY > _maxY) _maxY = maxY;
+	}
+}
+
 void SkeletonClipping::clipEnd(Slot &slot) {
 	if (_clipAttachment != NULL && _clipAttachment->_endSlot == &slot._data) {
 		clipEnd();
@@ -98,6 +168,7 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	Vector<unsigned short> &clippedTriangles = _clippedTriangles;
 	Vector<Vector<float> *> &polygons = *_clippingPolygons;
 	size_t polygonsCount = (*_clippingPolygons).size();
+	const float *clippingBounds = _clippingBounds.buffer();
 
 	size_t index = 0;
 	clippedVertices.clear();
@@ -119,9 +190,18 @@ continue_outer:
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
 		float u3 = uvs[vertexOffset], v3 = uvs[vertexOffset + 1];
 
+		float minX = MathUtil::min(x1, MathUtil::min(x2, x3)), maxX = MathUtil::max(x1, MathUtil::max(x2, x3));
+		float minY = MathUtil::min(y1, MathUtil::min(y2, y3)), maxY = MathUtil::max(y1, MathUtil::max(y2, y3));
+		// Triangles outside the clipping bounds are dropped without clipping.
+		if (maxX < _minX || minX > _maxX || maxY < _minY || minY > _maxY) continue;
+
 		for (size_t p = 0; p < polygonsCount; p++) {
+			const float *bounds = clippingBounds + (p << 2);
+			if (maxX < bounds[0] || minX > bounds[2] || maxY < bounds[1] || minY > bounds[3]) continue;
+
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (!containsTriangle(x1, y1, x2, y2, x3, y3, *polygons[p]) &&
+				clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 				float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
@@ -199,6 +279,20 @@ Vector<float> &SkeletonClipping::getClippedUVs() {
 	return _clippedUVs;
 }
 
+bool SkeletonClipping::containsTriangle(float x1, float y1, float x2, float y2, float x3, float y3,
+										Vector<float> &clippingArea) {
+	float *clippingVertices = clippingArea.buffer();
+	for (size_t i = 0, n = clippingArea.size() - 2; i < n; i += 2) {
+		float edgeX = clippingVertices[i], edgeY = clippingVertices[i + 1];
+		float edgeX2 = clippingVertices[i + 2], edgeY2 = clippingVertices[i + 3];
+		float deltaX = edgeX - edgeX2, deltaY = edgeY - edgeY2;
+		if (!(deltaX * (y1 - edgeY2) - deltaY * (x1 - edgeX2) > 0)) return false;
+		if (!(deltaX * (y2 - edgeY2) - deltaY * (x2 - edgeX2) > 0)) return false;
+		if (!(deltaX * (y3 - edgeY2) - deltaY * (x3 - edgeX2) > 0)) return false;
+	}
+	return true;
+}
+
 bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 							Vector<float> *output) {
 	Vector<float> *originalOutput = output;
@@ -0,0 +1,1349 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SkeletonCooked.h>
+
+#include <spine/Animation.h>
+#include <spine/Arena.h>
+#include <spine/AtlasAttachmentLoader.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/AttachmentType.h>
+#include <spine/BoneData.h>
+#include <spine/BoundingBoxAttachment.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/ColorTimeline.h>
+#include <spine/ContainerUtil.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/Event.h>
+#include <spine/EventData.h>
+#include <spine/EventTimeline.h>
+#include <spine/IkConstraintData.h>
+#include <spine/IkConstraintTimeline.h>
+#include <spine/MathUtil.h>
+#include <spine/MeshAttachment.h>
+#include <spine/PathAttachment.h>
+#include <spine/PathConstraintData.h>
+#include <spine/PathConstraintMixTimeline.h>
+#include <spine/PathConstraintPositionTimeline.h>
+#include <spine/PathConstraintSpacingTimeline.h>
+#include <spine/PointAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraintData.h>
+#include <spine/TransformConstraintTimeline.h>
+#include <spine/TranslateTimeline.h>
+
+#include <string.h>
+
+using namespace spine;
+
+static const unsigned char COOKED_MAGIC[] = {'S', 'P', 'C', 'K'};
+static const unsigned int COOKED_BYTE_ORDER = 0x01020304;
+static const int COOKED_HEADER_SIZE = 16;
+
+/// The arena bytes recorded by the writer are a hint, bounded by this many times the length of the cooked data. Loaded
+/// data takes about 4 times the length of its cooked form, the bound is well above that but keeps corrupt data from
+/// reserving an arbitrarily large block.
+static const size_t MAX_ARENA_BYTES_PER_BYTE = 16;
+
+static const int CONSTRAINT_IK = 0;
+static const int CONSTRAINT_TRANSFORM = 1;
+static const int CONSTRAINT_PATH = 2;
+
+/// Compares as ConstraintData, skins hold constraints of every type so they can't be cast to the type of the list.
+template<typename T>
+static int indexOfConstraint(Vector<T *> &constraints, ConstraintData *constraint) {
+	for (size_t i = 0, n = constraints.size(); i < n; i++)
+		if (constraints[i] == constraint) return (int) i;
+	return -1;
+}
+
+/// Writes values in native byte order, arrays as a count followed by their raw elements.
+class SkeletonCooked::DataOutput {
+public:
+	explicit DataOutput(Vector<unsigned char> &output) : _output(output) {
+	}
+
+	void writeBytes(const void *bytes, size_t length) {
+		size_t offset = _output.size();
+		_output.setSize(offset + length, 0);
+		if (length) memcpy(_output.buffer() + offset, bytes, length);
+	}
+
+	void writeByte(unsigned char value) {
+		_output.add(value);
+	}
+
+	void writeBoolean(bool value) {
+		_output.add(value ? 1 : 0);
+	}
+
+	void writeInt(int value) {
+		writeBytes(&value, sizeof(value));
+	}
+
+	void writeFloat(float value) {
+		writeBytes(&value, sizeof(value));
+	}
+
+	void writeColor(const Color &color) {
+		writeBytes(&color.r, sizeof(float));
+		writeBytes(&color.g, sizeof(float));
+		writeBytes(&color.b, sizeof(float));
+		writeBytes(&color.a, sizeof(float));
+	}
+
+	void writeString(const String &value) {
+		writeInt((int) value.length());
+		writeBytes(value.buffer(), value.length());
+	}
+
+	template<typename T>
+	void writeArray(Vector<T> &array) {
+		writeInt((int) array.size());
+		writeBytes(array.buffer(), array.size() * sizeof(T));
+	}
+
+	/// size_t differs between platforms, so size_t arrays are written as ints.
+	void writeSizeArray(Vector<size_t> &array) {
+		writeInt((int) array.size());
+		for (size_t i = 0, n = array.size(); i < n; i++)
+			writeInt((int) array[i]);
+	}
+
+	template<typename T>
+	void writeIndices(Vector<T *> &items, Vector<T *> &all) {
+		writeInt((int) items.size());
+		for (size_t i = 0, n = items.size(); i < n; i++)
+			writeInt(all.indexOf(items[i]));
+	}
+
+	template<typename T>
+	void writeIndex(T *item, Vector<T *> &all) {
+		writeInt(item ? all.indexOf(item) : -1);
+	}
+
+private:
+	Vector<unsigned char> &_output;
+};
+
+/// Reads what DataOutput wrote. Reading past the end or an index out of range marks the input as failed, after which
+/// reads return zero or NULL and callers stop at their next check.
+class SkeletonCooked::DataInput {
+public:
+	DataInput(const unsigned char *data, int length) : _cursor(data), _end(data + length), _failed(false) {
+	}
+
+	bool failed() {
+		return _failed;
+	}
+
+	void fail() {
+		_failed = true;
+	}
+
+	bool has(size_t bytes) {
+		if ((size_t) (_end - _cursor) < bytes) _failed = true;
+		return !_failed;
+	}
+
+	void readBytes(void *bytes, size_t length) {
+		if (!has(length)) return;
+		if (length) memcpy(bytes, _cursor, length);
+		_cursor += length;
+	}
+
+	unsigned char readByte() {
+		return has(1) ? *_cursor++ : 0;
+	}
+
+	bool readBoolean() {
+		return readByte() != 0;
+	}
+
+	int readInt() {
+		int value = 0;
+		readBytes(&value, sizeof(value));
+		return value;
+	}
+
+	float readFloat() {
+		float value = 0;
+		readBytes(&value, sizeof(value));
+		return value;
+	}
+
+	void readColor(Color &color) {
+		color.r = readFloat();
+		color.g = readFloat();
+		color.b = readFloat();
+		color.a = readFloat();
+	}
+
+	String readString() {
+		int length = readInt();
+		if (length <= 0 || !has(length)) return String();
+		char *chars = SpineExtension::alloc<char>(length + 1, __FILE__, __LINE__);
+		readBytes(chars, length);
+		chars[length] = '\0';
+		return String(chars, true);
+	}
+
+	/// Reads a string that must not be empty, as for the names of data objects.
+	String readName() {
+		String name = readString();
+		if (name.isEmpty()) _failed = true;
+		return name;
+	}
+
+	/// Returns a count of elements of the given size, 0 if the input doesn't hold that many.
+	size_t readCount(size_t elementSize) {
+		int count = readInt();
+		if (count < 0 || !has((size_t) count * elementSize)) return 0;
+		return (size_t) count;
+	}
+
+	template<typename T>
+	void readArray(Vector<T> &array) {
+		size_t count = readCount(sizeof(T));
+		array.setSize(count, T());
+		readBytes(array.buffer(), count * sizeof(T));
+	}
+
+	void readSizeArray(Vector<size_t> &array) {
+		size_t count = readCount(sizeof(int));
+		array.setSize(count, 0);
+		for (size_t i = 0; i < count; i++)
+			array[i] = (size_t) readInt();
+	}
+
+	/// Reads an index into a collection of the given size, -1 is allowed if optional.
+	int readIndex(size_t size, bool optional = false) {
+		int index = readInt();
+		if (index >= 0 ? (size_t) index >= size : !optional || index != -1) _failed = true;
+		return _failed ? -1 : index;
+	}
+
+	template<typename T>
+	T *readRef(Vector<T *> &all, bool optional = false) {
+		int index = readIndex(all.size(), optional);
+		return index >= 0 ? all[index] : NULL;
+	}
+
+	template<typename T>
+	void readRefs(Vector<T *> &items, Vector<T *> &all) {
+		size_t count = readCount(sizeof(int));
+		items.setSize(count, NULL);
+		for (size_t i = 0; i < count; i++)
+			items[i] = readRef(all);
+	}
+
+private:
+	const unsigned char *_cursor;
+	const unsigned char *_end;
+	bool _failed;
+};
+
+SkeletonCooked::SkeletonCooked(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
+											   _error(), _ownsLoader(true), _useArena(false) {
+}
+
+SkeletonCooked::SkeletonCooked(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
+																					  _error(),
+																					  _ownsLoader(ownsLoader),
+																					  _useArena(false) {
+	assert(_attachmentLoader != NULL);
+}
+
+SkeletonCooked::~SkeletonCooked() {
+	if (_ownsLoader) delete _attachmentLoader;
+}
+
+unsigned int SkeletonCooked::getLayout() {
+	// Arrays are stored as raw elements and sampled curves as BEZIER_SIZE floats per bezier, so data written where any of
+	// these differ is rejected like data of another version.
+	return (unsigned int) (sizeof(int) | sizeof(float) << 4 | sizeof(unsigned short) << 8 |
+						   CurveTimeline::BEZIER_SIZE << 12);
+}
+
+bool SkeletonCooked::isCooked(const unsigned char *data, int length) {
+	if (!data || length < COOKED_HEADER_SIZE || memcmp(data, COOKED_MAGIC, 4) != 0) return false;
+	int version;
+	unsigned int byteOrder, layout;
+	memcpy(&version, data + 4, 4);
+	memcpy(&byteOrder, data + 8, 4);
+	memcpy(&layout, data + 12, 4);
+	return version == VERSION && byteOrder == COOKED_BYTE_ORDER && layout == getLayout();
+}
+
+void SkeletonCooked::setError(const char *value1, const char *value2) {
+	ArenaScope noArena(NULL);
+	_error = String(value1);
+	if (value2) _error.append(value2);
+}
+
+SkeletonData *SkeletonCooked::readSkeletonData(const unsigned char *data, int length) {
+	if (!isCooked(data, length)) {
+		setError("Not cooked skeleton data of this runtime version.", NULL);
+		return NULL;
+	}
+	DataInput input(data + COOKED_HEADER_SIZE, length - COOKED_HEADER_SIZE);
+	unsigned int arenaBytes = (unsigned int) input.readInt();
+
+	SkeletonData *skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	skeletonData->_useArena = _useArena;
+	ArenaScope arenaScope(_useArena ? &skeletonData->_arena : NULL);
+	if (_useArena)
+		skeletonData->_arena.reserve(MathUtil::min((size_t) arenaBytes, (size_t) length * MAX_ARENA_BYTES_PER_BYTE));
+
+	skeletonData->_name = input.readString();
+	skeletonData->_hash = input.readString();
+	skeletonData->_version = input.readString();
+	skeletonData->_imagesPath = input.readString();
+	skeletonData->_audioPath = input.readString();
+	skeletonData->_x = input.readFloat();
+	skeletonData->_y = input.readFloat();
+	skeletonData->_width = input.readFloat();
+	skeletonData->_height = input.readFloat();
+	skeletonData->_fps = input.readFloat();
+
+	/* Bones. */
+	size_t count = input.readCount(1);
+	skeletonData->_bones.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		int parent = input.readIndex(i, true);
+		if (input.failed()) break;
+		BoneData *data = new (__FILE__, __LINE__) BoneData((int) i, name, parent >= 0 ? skeletonData->_bones[parent] : NULL);
+		skeletonData->_bones[i] = data;
+		data->_length = input.readFloat();
+		data->_x = input.readFloat();
+		data->_y = input.readFloat();
+		data->_rotation = input.readFloat();
+		data->_scaleX = input.readFloat();
+		data->_scaleY = input.readFloat();
+		data->_shearX = input.readFloat();
+		data->_shearY = input.readFloat();
+		data->_transformMode = (TransformMode) input.readInt();
+		data->_skinRequired = input.readBoolean();
+		input.readColor(data->_color);
+	}
+
+	/* Slots. */
+	count = input.readCount(1);
+	skeletonData->_slots.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		BoneData *boneData = input.readRef(skeletonData->_bones);
+		if (input.failed()) break;
+		SlotData *data = new (__FILE__, __LINE__) SlotData((int) i, name, *boneData);
+		skeletonData->_slots[i] = data;
+		input.readColor(data->_color);
+		input.readColor(data->_darkColor);
+		data->_hasDarkColor = input.readBoolean();
+		data->_attachmentName = input.readString();
+		data->_blendMode = (BlendMode) input.readInt();
+	}
+
+	/* IK constraints. */
+	count = input.failed() ? 0 : input.readCount(1);
+	skeletonData->_ikConstraints.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		if (input.failed()) break;
+		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(name);
+		skeletonData->_ikConstraints[i] = data;
+		data->setOrder((size_t) input.readInt());
+		data->setSkinRequired(input.readBoolean());
+		input.readRefs(data->_bones, skeletonData->_bones);
+		data->_target = input.readRef(skeletonData->_bones);
+		data->_bendDirection = input.readInt();
+		data->_compress = input.readBoolean();
+		data->_stretch = input.readBoolean();
+		data->_uniform = input.readBoolean();
+		data->_mix = input.readFloat();
+		data->_softness = input.readFloat();
+	}
+
+	/* Transform constraints. */
+	count = input.failed() ? 0 : input.readCount(1);
+	skeletonData->_transformConstraints.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		if (input.failed()) break;
+		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(name);
+		skeletonData->_transformConstraints[i] = data;
+		data->setOrder((size_t) input.readInt());
+		data->setSkinRequired(input.readBoolean());
+		input.readRefs(data->_bones, skeletonData->_bones);
+		data->_target = input.readRef(skeletonData->_bones);
+		data->_mixRotate = input.readFloat();
+		data->_mixX = input.readFloat();
+		data->_mixY = input.readFloat();
+		data->_mixScaleX = input.readFloat();
+		data->_mixScaleY = input.readFloat();
+		data->_mixShearY = input.readFloat();
+		data->_offsetRotation = input.readFloat();
+		data->_offsetX = input.readFloat();
+		data->_offsetY = input.readFloat();
+		data->_offsetScaleX = input.readFloat();
+		data->_offsetScaleY = input.readFloat();
+		data->_offsetShearY = input.readFloat();
+		data->_relative = input.readBoolean();
+		data->_local = input.readBoolean();
+	}
+
+	/* Path constraints. */
+	count = input.failed() ? 0 : input.readCount(1);
+	skeletonData->_pathConstraints.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		if (input.failed()) break;
+		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(name);
+		skeletonData->_pathConstraints[i] = data;
+		data->setOrder((size_t) input.readInt());
+		data->setSkinRequired(input.readBoolean());
+		input.readRefs(data->_bones, skeletonData->_bones);
+		data->_target = input.readRef(skeletonData->_slots);
+		data->_positionMode = (PositionMode) input.readInt();
+		data->_spacingMode = (SpacingMode) input.readInt();
+		data->_rotateMode = (RotateMode) input.readInt();
+		data->_offsetRotation = input.readFloat();
+		data->_position = input.readFloat();
+		data->_spacing = input.readFloat();
+		data->_mixRotate = input.readFloat();
+		data->_mixX = input.readFloat();
+		data->_mixY = input.readFloat();
+	}
+
+	/* Skins and attachments. */
+	Vector<Attachment *> attachments;
+	if (input.failed() || !readSkins(input, skeletonData, attachments)) {
+		if (_error.isEmpty()) setError("Cooked skeleton data is truncated or corrupt.", NULL);
+		delete skeletonData;
+		return NULL;
+	}
+
+	/* Events. */
+	count = input.readCount(1);
+	skeletonData->_events.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		if (input.failed()) break;
+		EventData *data = new (__FILE__, __LINE__) EventData(name);
+		skeletonData->_events[i] = data;
+		data->_intValue = input.readInt();
+		data->_floatValue = input.readFloat();
+		data->_stringValue = input.readString();
+		data->_audioPath = input.readString();
+		data->_volume = input.readFloat();
+		data->_balance = input.readFloat();
+	}
+
+	/* Animations. */
+	count = input.failed() ? 0 : input.readCount(1);
+	skeletonData->_animations.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		Animation *animation = readAnimation(input, skeletonData, attachments);
+		if (!animation) break;
+		skeletonData->_animations[i] = animation;
+	}
+
+	if (input.failed()) {
+		setError("Cooked skeleton data is truncated or corrupt.", NULL);
+		delete skeletonData;
+		return NULL;
+	}
+	skeletonData->updateNameIndices();
+	return skeletonData;
+}
+
+bool SkeletonCooked::readSkins(DataInput &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments) {
+	size_t count = input.readCount(1);
+	skeletonData->_skins.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++) {
+		String name = input.readName();
+		if (input.failed()) return false;
+		Skin *skin = new (__FILE__, __LINE__) Skin(name);
+		skeletonData->_skins[i] = skin;
+		input.readRefs(skin->getBones(), skeletonData->_bones);
+		size_t constraintCount = input.readCount(8);
+		for (size_t ii = 0; ii < constraintCount; ii++) {
+			ConstraintData *constraint = NULL;
+			switch (input.readInt()) {
+				case CONSTRAINT_IK:
+					constraint = input.readRef(skeletonData->_ikConstraints);
+					break;
+				case CONSTRAINT_TRANSFORM:
+					constraint = input.readRef(skeletonData->_transformConstraints);
+					break;
+				case CONSTRAINT_PATH:
+					constraint = input.readRef(skeletonData->_pathConstraints);
+					break;
+				default:
+					input.fail();
+			}
+			if (!constraint) return false;
+			skin->getConstraints().add(constraint);
+		}
+	}
+	skeletonData->_defaultSkin = input.readRef(skeletonData->_skins, true);
+
+	// Attachments follow the first entry referencing them, the owning skin is the one they were read in.
+	Vector<int> deformAttachments, parentMeshes;
+	for (size_t i = 0; i < count && !input.failed(); i++) {
+		Skin *skin = skeletonData->_skins[i];
+		size_t entryCount = input.readCount(12);
+		for (size_t ii = 0; ii < entryCount; ii++) {
+			int slotIndex = input.readIndex(skeletonData->_slots.size());
+			String name = input.readString();
+			int attachmentIndex = input.readIndex(attachments.size() + 1);
+			if (input.failed()) return false;
+
+			if (attachmentIndex == (int) attachments.size()) {
+				Attachment *attachment = readAttachment(input, *skin, skeletonData);
+				if (!attachment) return false;
+				attachments.add(attachment);
+				if (attachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
+					deformAttachments.add(input.readInt());
+					parentMeshes.add(input.readInt());
+				} else {
+					deformAttachments.add(-1);
+					parentMeshes.add(-1);
+				}
+			}
+			skin->setAttachment(slotIndex, name, attachments[attachmentIndex]);
+		}
+	}
+	if (input.failed()) return false;
+
+	for (size_t i = 0, n = attachments.size(); i < n; i++) {
+		if (!attachments[i]->getRTTI().instanceOf(VertexAttachment::rtti)) continue;
+		VertexAttachment *attachment = static_cast<VertexAttachment *>(attachments[i]);
+		int deform = deformAttachments[i], parent = parentMeshes[i];
+		if (deform < -1 || deform >= (int) n || parent < -1 || parent >= (int) n) return false;
+		if (deform >= 0) {
+			if (!attachments[deform]->getRTTI().instanceOf(VertexAttachment::rtti)) return false;
+			attachment->_deformAttachment = static_cast<VertexAttachment *>(attachments[deform]);
+		}
+		if (parent >= 0) {
+			if (!attachment->getRTTI().isExactly(MeshAttachment::rtti) ||
+				!attachments[parent]->getRTTI().isExactly(MeshAttachment::rtti))
+				return false;
+			// The linked mesh's own arrays were cooked, so only the reference is set, see MeshAttachment::setParentMesh.
+			static_cast<MeshAttachment *>(attachment)->_parentMesh = static_cast<MeshAttachment *>(attachments[parent]);
+		}
+	}
+	return true;
+}
+
+Attachment *SkeletonCooked::readAttachment(DataInput &input, Skin &skin, SkeletonData *skeletonData) {
+	AttachmentType type = (AttachmentType) input.readByte();
+	String name = input.readName();
+	if (input.failed()) return NULL;
+	switch (type) {
+		case AttachmentType_Region: {
+			String path = input.readString();
+			RegionAttachment *region = _attachmentLoader->newRegionAttachment(skin, name, path);
+			if (!region) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			region->_path = path;
+			region->_x = input.readFloat();
+			region->_y = input.readFloat();
+			region->_rotation = input.readFloat();
+			region->_scaleX = input.readFloat();
+			region->_scaleY = input.readFloat();
+			region->_width = input.readFloat();
+			region->_height = input.readFloat();
+			input.readColor(region->_color);
+			region->updateOffset();
+			_attachmentLoader->configureAttachment(region);
+			return region;
+		}
+		case AttachmentType_Mesh: {
+			String path = input.readString();
+			MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(skin, name, path);
+			if (!mesh) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			mesh->_path = path;
+			input.readColor(mesh->_color);
+			readVertices(input, mesh, skeletonData);
+			input.readArray(mesh->_regionUVs);
+			input.readArray(mesh->_triangles);
+			mesh->_hullLength = input.readInt();
+			input.readArray(mesh->_edges);
+			mesh->_width = input.readFloat();
+			mesh->_height = input.readFloat();
+			mesh->updateUVs();
+			_attachmentLoader->configureAttachment(mesh);
+			return mesh;
+		}
+		case AttachmentType_Boundingbox: {
+			BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(skin, name);
+			if (!box) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			readVertices(input, box, skeletonData);
+			input.readColor(box->getColor());
+			_attachmentLoader->configureAttachment(box);
+			return box;
+		}
+		case AttachmentType_Path: {
+			PathAttachment *path = _attachmentLoader->newPathAttachment(skin, name);
+			if (!path) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			readVertices(input, path, skeletonData);
+			input.readArray(path->_lengths);
+			path->_closed = input.readBoolean();
+			path->_constantSpeed = input.readBoolean();
+			input.readColor(path->_color);
+			_attachmentLoader->configureAttachment(path);
+			return path;
+		}
+		case AttachmentType_Point: {
+			PointAttachment *point = _attachmentLoader->newPointAttachment(skin, name);
+			if (!point) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			point->_x = input.readFloat();
+			point->_y = input.readFloat();
+			point->_rotation = input.readFloat();
+			input.readColor(point->_color);
+			_attachmentLoader->configureAttachment(point);
+			return point;
+		}
+		case AttachmentType_Clipping: {
+			ClippingAttachment *clip = _attachmentLoader->newClippingAttachment(skin, name);
+			if (!clip) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			clip->_endSlot = input.readRef(skeletonData->_slots, true);
+			readVertices(input, clip, skeletonData);
+			input.readArray(clip->_convexPolygons);
+			input.readSizeArray(clip->_convexPolygonEnds);
+			input.readColor(clip->_color);
+			_attachmentLoader->configureAttachment(clip);
+			return clip;
+		}
+		default:
+			input.fail();
+			return NULL;
+	}
+}
+
+void SkeletonCooked::readVertices(DataInput &input, VertexAttachment *attachment, SkeletonData *skeletonData) {
+	input.readSizeArray(attachment->_bones);
+	input.readArray(attachment->_vertices);
+	attachment->_worldVerticesLength = (size_t) input.readInt();
+	input.readSizeArray(attachment->_skinBones);
+	input.readArray(attachment->_skinBuckets);
+	input.readArray(attachment->_skinIndices);
+	input.readArray(attachment->_skinVertices);
+	input.readArray(attachment->_skinOutputs);
+	if (input.failed()) return;
+
+	// computeWorldVertices indexes with all of these unchecked.
+	size_t boneCount = skeletonData->_bones.size(), vertexCount = attachment->_worldVerticesLength >> 1;
+	Vector<size_t> &bones = attachment->_bones;
+	size_t weights = 0;
+	for (size_t i = 0, n = bones.size(); i < n; i += bones[i] + 1, vertexCount--) {
+		if (vertexCount == 0 || bones[i] >= n - i) {
+			input.fail();
+			return;
+		}
+		for (size_t ii = 1; ii <= bones[i]; ii++)
+			if (bones[i + ii] >= boneCount) input.fail();
+		weights += bones[i];
+	}
+	if (bones.size() > 0 ? vertexCount != 0 || attachment->_vertices.size() != weights * 3
+						 : attachment->_vertices.size() < attachment->_worldVerticesLength) input.fail();
+
+	Vector<size_t> &skinBones = attachment->_skinBones;
+	for (size_t i = 0, n = skinBones.size(); i < n; i++)
+		if (skinBones[i] >= boneCount) input.fail();
+
+	// The buckets give the number of blocks of 4 vertices and their weights, which the other arrays must match.
+	Vector<int> &buckets = attachment->_skinBuckets;
+	size_t blocks = 0, blockWeights = 0;
+	if (buckets.size() % 2 != 0) input.fail();
+	for (size_t i = 0; i + 1 < buckets.size(); i += 2) {
+		if (buckets[i] <= 0 || buckets[i + 1] < 0) input.fail();
+		blocks += (size_t) buckets[i + 1];
+		blockWeights += (size_t) buckets[i + 1] * (size_t) buckets[i];
+	}
+	if (input.failed() || attachment->_skinOutputs.size() != blocks * 4 ||
+		attachment->_skinIndices.size() != blockWeights * 8 || attachment->_skinVertices.size() != blockWeights * 12) {
+		input.fail();
+		return;
+	}
+
+	// Per weight, 4 offsets into the gathered bone matrices of 6 floats each, then 4 offsets into the deform.
+	Vector<int> &indices = attachment->_skinIndices;
+	int matrixEnd = (int) skinBones.size() * 6, deformEnd = (int) weights * 2;
+	for (size_t i = 0, n = indices.size(); i < n; i += 8) {
+		for (size_t lane = 0; lane < 4; lane++) {
+			int matrix = indices[i + lane], deform = indices[i + 4 + lane];
+			if (matrix < 0 || matrix >= matrixEnd || matrix % 6 != 0) input.fail();
+			if (deform < 0 || deform + 1 >= deformEnd) input.fail();
+		}
+	}
+	Vector<int> &outputs = attachment->_skinOutputs;
+	for (size_t i = 0, n = outputs.size(); i < n; i++)
+		if (outputs[i] < 0 || (size_t) outputs[i] >= attachment->_worldVerticesLength >> 1) input.fail();
+}
+
+Animation *SkeletonCooked::readAnimation(DataInput &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments) {
+	String name = input.readName();
+	float duration = input.readFloat();
+	size_t count = input.readCount(1);
+	if (input.failed()) return NULL;
+	Vector<Timeline *> timelines;
+	timelines.ensureCapacity(count);
+	for (size_t i = 0; i < count; i++) {
+		Timeline *timeline = readTimeline(input, skeletonData, attachments);
+		if (!timeline) {
+			ContainerUtil::cleanUpVectorOfPointers(timelines);
+			input.fail();
+			return NULL;
+		}
+		timelines.add(timeline);
+	}
+	return new (__FILE__, __LINE__) Animation(name, timelines, duration);
+}
+
+Timeline *SkeletonCooked::readTimeline(DataInput &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments) {
+	int type = input.readByte();
+	size_t bones = skeletonData->_bones.size(), slots = skeletonData->_slots.size();
+	if (type <= TIMELINE_ALPHA || type == TIMELINE_IK || type == TIMELINE_TRANSFORM || type >= TIMELINE_PATH_POSITION) {
+		size_t targets = type <= TIMELINE_SHEARY ? bones : type <= TIMELINE_ALPHA ? slots : type == TIMELINE_IK ? skeletonData->_ikConstraints.size() : type == TIMELINE_TRANSFORM ? skeletonData->_transformConstraints.size() : skeletonData->_pathConstraints.size();
+		int index = input.readIndex(targets);
+		size_t frameCount = input.readCount(1), bezierCount = input.readCount(1);
+		if (input.failed() || frameCount == 0) return NULL;
+
+		CurveTimeline *timeline = NULL;
+		switch (type) {
+			case TIMELINE_ROTATE:
+				timeline = new (__FILE__, __LINE__) RotateTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_TRANSLATE:
+				timeline = new (__FILE__, __LINE__) TranslateTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_TRANSLATEX:
+				timeline = new (__FILE__, __LINE__) TranslateXTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_TRANSLATEY:
+				timeline = new (__FILE__, __LINE__) TranslateYTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_SCALE:
+				timeline = new (__FILE__, __LINE__) ScaleTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_SCALEX:
+				timeline = new (__FILE__, __LINE__) ScaleXTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_SCALEY:
+				timeline = new (__FILE__, __LINE__) ScaleYTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_SHEAR:
+				timeline = new (__FILE__, __LINE__) ShearTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_SHEARX:
+				timeline = new (__FILE__, __LINE__) ShearXTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_SHEARY:
+				timeline = new (__FILE__, __LINE__) ShearYTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_RGBA:
+				timeline = new (__FILE__, __LINE__) RGBATimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_RGB:
+				timeline = new (__FILE__, __LINE__) RGBTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_RGBA2:
+				timeline = new (__FILE__, __LINE__) RGBA2Timeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_RGB2:
+				timeline = new (__FILE__, __LINE__) RGB2Timeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_ALPHA:
+				timeline = new (__FILE__, __LINE__) AlphaTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_IK:
+				timeline = new (__FILE__, __LINE__) IkConstraintTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_TRANSFORM:
+				timeline = new (__FILE__, __LINE__) TransformConstraintTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_PATH_POSITION:
+				timeline = new (__FILE__, __LINE__) PathConstraintPositionTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_PATH_SPACING:
+				timeline = new (__FILE__, __LINE__) PathConstraintSpacingTimeline(frameCount, bezierCount, index);
+				break;
+			case TIMELINE_PATH_MIX:
+				timeline = new (__FILE__, __LINE__) PathConstraintMixTimeline(frameCount, bezierCount, index);
+				break;
+			default:
+				return NULL;
+		}
+		readCurves(input, timeline);
+		if (input.failed()) {
+			delete timeline;
+			return NULL;
+		}
+		return timeline;
+	}
+
+	switch (type) {
+		case TIMELINE_DEFORM: {
+			int slotIndex = input.readIndex(slots);
+			Attachment *attachment = input.readRef(attachments);
+			size_t frameCount = input.readCount(1), bezierCount = input.readCount(1);
+			if (input.failed() || frameCount == 0 || !attachment->getRTTI().instanceOf(VertexAttachment::rtti)) return NULL;
+			DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, slotIndex,
+																			   static_cast<VertexAttachment *>(attachment));
+			readCurves(input, timeline);
+			for (size_t i = 0; i < frameCount; i++)
+				input.readArray(timeline->getVertices()[i]);
+			if (input.failed()) {
+				delete timeline;
+				return NULL;
+			}
+			return timeline;
+		}
+		case TIMELINE_ATTACHMENT: {
+			int slotIndex = input.readIndex(slots);
+			size_t frameCount = input.readCount(1);
+			if (input.failed() || frameCount == 0) return NULL;
+			AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frameCount, slotIndex);
+			input.readBytes(timeline->getFrames().buffer(), frameCount * sizeof(float));
+			for (size_t i = 0; i < frameCount; i++)
+				timeline->getAttachmentNames()[i] = input.readString();
+			if (input.failed()) {
+				delete timeline;
+				return NULL;
+			}
+			return timeline;
+		}
+		case TIMELINE_DRAW_ORDER: {
+			size_t frameCount = input.readCount(1);
+			if (input.failed() || frameCount == 0) return NULL;
+			DrawOrderTimeline *timeline = new (__FILE__, __LINE__) DrawOrderTimeline(frameCount);
+			input.readBytes(timeline->getFrames().buffer(), frameCount * sizeof(float));
+			for (size_t i = 0; i < frameCount; i++) {
+				Vector<int> &drawOrder = timeline->getDrawOrders()[i];
+				input.readArray(drawOrder);
+				if (drawOrder.size() != 0 && drawOrder.size() != slots) input.fail();
+				for (size_t ii = 0, n = drawOrder.size(); ii < n; ii++)
+					if (drawOrder[ii] < 0 || (size_t) drawOrder[ii] >= slots) input.fail();
+			}
+			if (input.failed()) {
+				delete timeline;
+				return NULL;
+			}
+			return timeline;
+		}
+		case TIMELINE_EVENT: {
+			size_t frameCount = input.readCount(1);
+			if (input.failed() || frameCount == 0) return NULL;
+			EventTimeline *timeline = new (__FILE__, __LINE__) EventTimeline(frameCount);
+			for (size_t i = 0; i < frameCount; i++) {
+				float time = input.readFloat();
+				EventData *eventData = input.readRef(skeletonData->_events);
+				if (!eventData) break;
+				Event *event = new (__FILE__, __LINE__) Event(time, *eventData);
+				event->_intValue = input.readInt();
+				event->_floatValue = input.readFloat();
+				event->_stringValue = input.readString();
+				event->_volume = input.readFloat();
+				event->_balance = input.readFloat();
+				timeline->setFrame(i, event);
+			}
+			if (input.failed()) {
+				delete timeline;
+				return NULL;
+			}
+			return timeline;
+		}
+		default:
+			return NULL;
+	}
+}
+
+void SkeletonCooked::readCurves(DataInput &input, CurveTimeline *timeline) {
+	// The arrays were sized by the constructor from the frame and bezier counts, they must match.
+	Vector<float> &frames = timeline->getFrames(), &curves = timeline->getCurves();
+	if ((size_t) input.readInt() != frames.size()) input.fail();
+	input.readBytes(frames.buffer(), frames.size() * sizeof(float));
+	if ((size_t) input.readInt() != curves.size()) input.fail();
+	input.readBytes(curves.buffer(), curves.size() * sizeof(float));
+	// Quantized curves were constructed with a bezier count of 0, so the curves hold only the frame types.
+	Vector<unsigned short> &quantized = timeline->getQuantizedCurves();
+	size_t count = input.readCount(sizeof(unsigned short));
+	quantized.ensureCapacity(count);
+	quantized.setSize(count, 0);
+	input.readBytes(quantized.buffer(), count * sizeof(unsigned short));
+	timeline->_quantizedMin = input.readFloat();
+	timeline->_quantizedScale = input.readFloat();
+	timeline->_quantized = count > 0;
+	if (input.failed()) return;
+
+	// A frame's curve type is linear, stepped or BEZIER plus the offset of its first bezier, which the beziers of the
+	// frame's other values follow. The last frame has no next frame to interpolate to, so it must be stepped.
+	size_t frameCount = timeline->getFrameCount(), entries = timeline->getFrameEntries();
+	size_t values = timeline->getRTTI().isExactly(IkConstraintTimeline::rtti) ? 2 : entries > 1 ? entries - 1 : 1;
+	size_t bezierCount = timeline->_quantized ? quantized.size() / 4 : (curves.size() - frameCount) / CurveTimeline::BEZIER_SIZE;
+	for (size_t frame = 0; frame + 1 < frameCount; frame++) {
+		float type = curves[frame];
+		if (type == CurveTimeline::LINEAR || type == CurveTimeline::STEPPED) continue;
+		float offset = type - CurveTimeline::BEZIER - frameCount;
+		if (!(offset >= 0 && offset < bezierCount * CurveTimeline::BEZIER_SIZE) || offset != (float) (size_t) offset) {
+			input.fail();
+			return;
+		}
+		size_t bezier = (size_t) offset;
+		if (bezier % CurveTimeline::BEZIER_SIZE != 0 || bezier / CurveTimeline::BEZIER_SIZE + values > bezierCount) {
+			input.fail();
+			return;
+		}
+	}
+	if (curves[frameCount - 1] != CurveTimeline::STEPPED) input.fail();
+}
+
+void SkeletonCooked::writeSkeletonData(SkeletonData &skeletonData, Vector<unsigned char> &output) {
+	DataOutput out(output);
+	out.writeBytes(COOKED_MAGIC, 4);
+	out.writeInt(VERSION);
+	out.writeInt((int) COOKED_BYTE_ORDER);
+	out.writeInt((int) getLayout());
+	out.writeInt(skeletonData._useArena ? (int) skeletonData._arena.getUsedBytes() : 0);
+
+	out.writeString(skeletonData._name);
+	out.writeString(skeletonData._hash);
+	out.writeString(skeletonData._version);
+	out.writeString(skeletonData._imagesPath);
+	out.writeString(skeletonData._audioPath);
+	out.writeFloat(skeletonData._x);
+	out.writeFloat(skeletonData._y);
+	out.writeFloat(skeletonData._width);
+	out.writeFloat(skeletonData._height);
+	out.writeFloat(skeletonData._fps);
+
+	Vector<BoneData *> &bones = skeletonData._bones;
+	out.writeInt((int) bones.size());
+	for (size_t i = 0, n = bones.size(); i < n; i++) {
+		BoneData *data = bones[i];
+		out.writeString(data->_name);
+		out.writeIndex(data->_parent, bones);
+		out.writeFloat(data->_length);
+		out.writeFloat(data->_x);
+		out.writeFloat(data->_y);
+		out.writeFloat(data->_rotation);
+		out.writeFloat(data->_scaleX);
+		out.writeFloat(data->_scaleY);
+		out.writeFloat(data->_shearX);
+		out.writeFloat(data->_shearY);
+		out.writeInt((int) data->_transformMode);
+		out.writeBoolean(data->_skinRequired);
+		out.writeColor(data->_color);
+	}
+
+	Vector<SlotData *> &slots = skeletonData._slots;
+	out.writeInt((int) slots.size());
+	for (size_t i = 0, n = slots.size(); i < n; i++) {
+		SlotData *data = slots[i];
+		out.writeString(data->_name);
+		out.writeIndex(&data->_boneData, bones);
+		out.writeColor(data->_color);
+		out.writeColor(data->_darkColor);
+		out.writeBoolean(data->_hasDarkColor);
+		out.writeString(data->_attachmentName);
+		out.writeInt((int) data->_blendMode);
+	}
+
+	out.writeInt((int) skeletonData._ikConstraints.size());
+	for (size_t i = 0, n = skeletonData._ikConstraints.size(); i < n; i++) {
+		IkConstraintData *data = skeletonData._ikConstraints[i];
+		out.writeString(data->getName());
+		out.writeInt((int) data->getOrder());
+		out.writeBoolean(data->isSkinRequired());
+		out.writeIndices(data->_bones, bones);
+		out.writeIndex(data->_target, bones);
+		out.writeInt(data->_bendDirection);
+		out.writeBoolean(data->_compress);
+		out.writeBoolean(data->_stretch);
+		out.writeBoolean(data->_uniform);
+		out.writeFloat(data->_mix);
+		out.writeFloat(data->_softness);
+	}
+
+	out.writeInt((int) skeletonData._transformConstraints.size());
+	for (size_t i = 0, n = skeletonData._transformConstraints.size(); i < n; i++) {
+		TransformConstraintData *data = skeletonData._transformConstraints[i];
+		out.writeString(data->getName());
+		out.writeInt((int) data->getOrder());
+		out.writeBoolean(data->isSkinRequired());
+		out.writeIndices(data->_bones, bones);
+		out.writeIndex(data->_target, bones);
+		out.writeFloat(data->_mixRotate);
+		out.writeFloat(data->_mixX);
+		out.writeFloat(data->_mixY);
+		out.writeFloat(data->_mixScaleX);
+		out.writeFloat(data->_mixScaleY);
+		out.writeFloat(data->_mixShearY);
+		out.writeFloat(data->_offsetRotation);
+		out.writeFloat(data->_offsetX);
+		out.writeFloat(data->_offsetY);
+		out.writeFloat(data->_offsetScaleX);
+		out.writeFloat(data->_offsetScaleY);
+		out.writeFloat(data->_offsetShearY);
+		out.writeBoolean(data->_relative);
+		out.writeBoolean(data->_local);
+	}
+
+	out.writeInt((int) skeletonData._pathConstraints.size());
+	for (size_t i = 0, n = skeletonData._pathConstraints.size(); i < n; i++) {
+		PathConstraintData *data = skeletonData._pathConstraints[i];
+		out.writeString(data->getName());
+		out.writeInt((int) data->getOrder());
+		out.writeBoolean(data->isSkinRequired());
+		out.writeIndices(data->_bones, bones);
+		out.writeIndex(data->_target, slots);
+		out.writeInt((int) data->_positionMode);
+		out.writeInt((int) data->_spacingMode);
+		out.writeInt((int) data->_rotateMode);
+		out.writeFloat(data->_offsetRotation);
+		out.writeFloat(data->_position);
+		out.writeFloat(data->_spacing);
+		out.writeFloat(data->_mixRotate);
+		out.writeFloat(data->_mixX);
+		out.writeFloat(data->_mixY);
+	}
+
+	Vector<Attachment *> attachments;
+	writeSkins(out, skeletonData, attachments);
+
+	Vector<EventData *> &events = skeletonData._events;
+	out.writeInt((int) events.size());
+	for (size_t i = 0, n = events.size(); i < n; i++) {
+		EventData *data = events[i];
+		out.writeString(data->_name);
+		out.writeInt(data->_intValue);
+		out.writeFloat(data->_floatValue);
+		out.writeString(data->_stringValue);
+		out.writeString(data->_audioPath);
+		out.writeFloat(data->_volume);
+		out.writeFloat(data->_balance);
+	}
+
+	Vector<Animation *> &animations = skeletonData._animations;
+	out.writeInt((int) animations.size());
+	for (size_t i = 0, n = animations.size(); i < n; i++)
+		writeAnimation(out, animations[i], skeletonData, attachments);
+}
+
+void SkeletonCooked::writeSkins(DataOutput &output, SkeletonData &skeletonData, Vector<Attachment *> &attachments) {
+	Vector<Skin *> &skins = skeletonData._skins;
+	output.writeInt((int) skins.size());
+	for (size_t i = 0, n = skins.size(); i < n; i++) {
+		Skin *skin = skins[i];
+		output.writeString(skin->getName());
+		output.writeIndices(skin->getBones(), skeletonData._bones);
+		Vector<ConstraintData *> &constraints = skin->getConstraints();
+		output.writeInt((int) constraints.size());
+		for (size_t ii = 0, nn = constraints.size(); ii < nn; ii++) {
+			ConstraintData *constraint = constraints[ii];
+			int index;
+			if ((index = indexOfConstraint(skeletonData._ikConstraints, constraint)) >= 0)
+				output.writeInt(CONSTRAINT_IK);
+			else if ((index = indexOfConstraint(skeletonData._transformConstraints, constraint)) >= 0)
+				output.writeInt(CONSTRAINT_TRANSFORM);
+			else {
+				index = indexOfConstraint(skeletonData._pathConstraints, constraint);
+				output.writeInt(CONSTRAINT_PATH);
+			}
+			output.writeInt(index);
+		}
+	}
+	output.writeIndex(skeletonData._defaultSkin, skins);
+
+	// Attachments are numbered in the order they are first referenced, so vertex attachments can reference attachments
+	// of later skins.
+	for (size_t i = 0, n = skins.size(); i < n; i++) {
+		Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Attachment *attachment = entries.next()._attachment;
+			if (!attachments.contains(attachment)) attachments.add(attachment);
+		}
+	}
+
+	size_t written = 0;
+	for (size_t i = 0, n = skins.size(); i < n; i++) {
+		Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+		int count = 0;
+		while (entries.hasNext()) {
+			entries.next();
+			count++;
+		}
+		output.writeInt(count);
+
+		Skin::AttachmentMap::Entries entryList = skins[i]->getAttachments();
+		while (entryList.hasNext()) {
+			Skin::AttachmentMap::Entry &entry = entryList.next();
+			output.writeInt((int) entry._slotIndex);
+			output.writeString(entry._name);
+			int index = attachments.indexOf(entry._attachment);
+			output.writeInt(index);
+			if ((size_t) index < written) continue;
+			written++;
+			writeAttachment(output, entry._attachment, skeletonData, attachments);
+		}
+	}
+}
+
+void SkeletonCooked::writeAttachment(DataOutput &output, Attachment *attachment, SkeletonData &skeletonData,
+									 Vector<Attachment *> &attachments) {
+	const RTTI &rtti = attachment->getRTTI();
+	if (rtti.isExactly(RegionAttachment::rtti)) {
+		RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+		output.writeByte(AttachmentType_Region);
+		output.writeString(region->getName());
+		output.writeString(region->_path);
+		output.writeFloat(region->_x);
+		output.writeFloat(region->_y);
+		output.writeFloat(region->_rotation);
+		output.writeFloat(region->_scaleX);
+		output.writeFloat(region->_scaleY);
+		output.writeFloat(region->_width);
+		output.writeFloat(region->_height);
+		output.writeColor(region->_color);
+		return;
+	}
+	if (rtti.isExactly(PointAttachment::rtti)) {
+		PointAttachment *point = static_cast<PointAttachment *>(attachment);
+		output.writeByte(AttachmentType_Point);
+		output.writeString(point->getName());
+		output.writeFloat(point->_x);
+		output.writeFloat(point->_y);
+		output.writeFloat(point->_rotation);
+		output.writeColor(point->_color);
+		return;
+	}
+
+	if (rtti.isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+		output.writeByte(AttachmentType_Mesh);
+		output.writeString(mesh->getName());
+		output.writeString(mesh->_path);
+		output.writeColor(mesh->_color);
+		writeVertices(output, mesh);
+		output.writeArray(mesh->_regionUVs);
+		output.writeArray(mesh->_triangles);
+		output.writeInt(mesh->_hullLength);
+		output.writeArray(mesh->_edges);
+		output.writeFloat(mesh->_width);
+		output.writeFloat(mesh->_height);
+	} else if (rtti.isExactly(BoundingBoxAttachment::rtti)) {
+		BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
+		output.writeByte(AttachmentType_Boundingbox);
+		output.writeString(box->getName());
+		writeVertices(output, box);
+		output.writeColor(box->getColor());
+	} else if (rtti.isExactly(PathAttachment::rtti)) {
+		PathAttachment *path = static_cast<PathAttachment *>(attachment);
+		output.writeByte(AttachmentType_Path);
+		output.writeString(path->getName());
+		writeVertices(output, path);
+		output.writeArray(path->_lengths);
+		output.writeBoolean(path->_closed);
+		output.writeBoolean(path->_constantSpeed);
+		output.writeColor(path->_color);
+	} else if (rtti.isExactly(ClippingAttachment::rtti)) {
+		ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
+		output.writeByte(AttachmentType_Clipping);
+		output.writeString(clip->getName());
+		output.writeIndex(clip->_endSlot, skeletonData._slots);
+		writeVertices(output, clip);
+		output.writeArray(clip->_convexPolygons);
+		output.writeSizeArray(clip->_convexPolygonEnds);
+		output.writeColor(clip->_color);
+	}
+	VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+	output.writeIndex<Attachment>(vertexAttachment->_deformAttachment, attachments);
+	MeshAttachment *parentMesh = rtti.isExactly(MeshAttachment::rtti) ? static_cast<MeshAttachment *>(attachment)->_parentMesh : NULL;
+	output.writeIndex<Attachment>(parentMesh, attachments);
+}
+
+void SkeletonCooked::writeVertices(DataOutput &output, VertexAttachment *attachment) {
+	output.writeSizeArray(attachment->_bones);
+	output.writeArray(attachment->_vertices);
+	output.writeInt((int) attachment->_worldVerticesLength);
+	output.writeSizeArray(attachment->_skinBones);
+	output.writeArray(attachment->_skinBuckets);
+	output.writeArray(attachment->_skinIndices);
+	output.writeArray(attachment->_skinVertices);
+	output.writeArray(attachment->_skinOutputs);
+}
+
+void SkeletonCooked::writeAnimation(DataOutput &output, Animation *animation, SkeletonData &skeletonData,
+									Vector<Attachment *> &attachments) {
+	// Animations read lazily are decoded and kept from being released while they are written.
+	animation->retain();
+	output.writeString(animation->getName());
+	output.writeFloat(animation->getDuration());
+	Vector<Timeline *> &timelines = animation->getTimelines();
+	output.writeInt((int) timelines.size());
+	for (size_t i = 0, n = timelines.size(); i < n; i++)
+		writeTimeline(output, timelines[i], skeletonData, attachments);
+	animation->release();
+}
+
+void SkeletonCooked::writeTimeline(DataOutput &output, Timeline *timeline, SkeletonData &skeletonData,
+								   Vector<Attachment *> &attachments) {
+	const RTTI &rtti = timeline->getRTTI();
+	if (rtti.isExactly(RotateTimeline::rtti))
+		writeCurves(output, TIMELINE_ROTATE, static_cast<RotateTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(TranslateTimeline::rtti))
+		writeCurves(output, TIMELINE_TRANSLATE, static_cast<TranslateTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(TranslateXTimeline::rtti))
+		writeCurves(output, TIMELINE_TRANSLATEX, static_cast<TranslateXTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(TranslateYTimeline::rtti))
+		writeCurves(output, TIMELINE_TRANSLATEY, static_cast<TranslateYTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(ScaleTimeline::rtti))
+		writeCurves(output, TIMELINE_SCALE, static_cast<ScaleTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(ScaleXTimeline::rtti))
+		writeCurves(output, TIMELINE_SCALEX, static_cast<ScaleXTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(ScaleYTimeline::rtti))
+		writeCurves(output, TIMELINE_SCALEY, static_cast<ScaleYTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(ShearTimeline::rtti))
+		writeCurves(output, TIMELINE_SHEAR, static_cast<ShearTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(ShearXTimeline::rtti))
+		writeCurves(output, TIMELINE_SHEARX, static_cast<ShearXTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(ShearYTimeline::rtti))
+		writeCurves(output, TIMELINE_SHEARY, static_cast<ShearYTimeline *>(timeline)->getBoneIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(RGBATimeline::rtti))
+		writeCurves(output, TIMELINE_RGBA, static_cast<RGBATimeline *>(timeline)->getSlotIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(RGBTimeline::rtti))
+		writeCurves(output, TIMELINE_RGB, static_cast<RGBTimeline *>(timeline)->getSlotIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(RGBA2Timeline::rtti))
+		writeCurves(output, TIMELINE_RGBA2, static_cast<RGBA2Timeline *>(timeline)->getSlotIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(RGB2Timeline::rtti))
+		writeCurves(output, TIMELINE_RGB2, static_cast<RGB2Timeline *>(timeline)->getSlotIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(AlphaTimeline::rtti))
+		writeCurves(output, TIMELINE_ALPHA, static_cast<AlphaTimeline *>(timeline)->getSlotIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(IkConstraintTimeline::rtti))
+		writeCurves(output, TIMELINE_IK, static_cast<IkConstraintTimeline *>(timeline)->getIkConstraintIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(TransformConstraintTimeline::rtti))
+		writeCurves(output, TIMELINE_TRANSFORM, static_cast<TransformConstraintTimeline *>(timeline)->getTransformConstraintIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(PathConstraintPositionTimeline::rtti))
+		writeCurves(output, TIMELINE_PATH_POSITION, static_cast<PathConstraintPositionTimeline *>(timeline)->getPathConstraintIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(PathConstraintSpacingTimeline::rtti))
+		writeCurves(output, TIMELINE_PATH_SPACING, static_cast<PathConstraintSpacingTimeline *>(timeline)->getPathConstraintIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(PathConstraintMixTimeline::rtti))
+		writeCurves(output, TIMELINE_PATH_MIX, static_cast<PathConstraintMixTimeline *>(timeline)->getPathConstraintIndex(), static_cast<CurveTimeline *>(timeline));
+	else if (rtti.isExactly(DeformTimeline::rtti)) {
+		DeformTimeline *deform = static_cast<DeformTimeline *>(timeline);
+		output.writeByte(TIMELINE_DEFORM);
+		output.writeInt(deform->getSlotIndex());
+		output.writeIndex<Attachment>(deform->getAttachment(), attachments);
+		output.writeInt((int) deform->getFrameCount());
+		output.writeInt((int) ((deform->getCurves().size() - deform->getFrameCount()) / CurveTimeline::BEZIER_SIZE));
+		writeCurveArrays(output, deform);
+		Vector<Vector<float> > &vertices = deform->getVertices();
+		for (size_t i = 0, n = vertices.size(); i < n; i++)
+			output.writeArray(vertices[i]);
+	} else if (rtti.isExactly(AttachmentTimeline::rtti)) {
+		AttachmentTimeline *attachmentTimeline = static_cast<AttachmentTimeline *>(timeline);
+		output.writeByte(TIMELINE_ATTACHMENT);
+		output.writeInt(attachmentTimeline->getSlotIndex());
+		output.writeInt((int) attachmentTimeline->getFrameCount());
+		output.writeBytes(attachmentTimeline->getFrames().buffer(), attachmentTimeline->getFrames().size() * sizeof(float));
+		Vector<String> &names = attachmentTimeline->getAttachmentNames();
+		for (size_t i = 0, n = names.size(); i < n; i++)
+			output.writeString(names[i]);
+	} else if (rtti.isExactly(DrawOrderTimeline::rtti)) {
+		DrawOrderTimeline *drawOrderTimeline = static_cast<DrawOrderTimeline *>(timeline);
+		output.writeByte(TIMELINE_DRAW_ORDER);
+		output.writeInt((int) drawOrderTimeline->getFrameCount());
+		output.writeBytes(drawOrderTimeline->getFrames().buffer(), drawOrderTimeline->getFrames().size() * sizeof(float));
+		Vector<Vector<int> > &drawOrders = drawOrderTimeline->getDrawOrders();
+		for (size_t i = 0, n = drawOrders.size(); i < n; i++)
+			output.writeArray(drawOrders[i]);
+	} else if (rtti.isExactly(EventTimeline::rtti)) {
+		EventTimeline *eventTimeline = static_cast<EventTimeline *>(timeline);
+		output.writeByte(TIMELINE_EVENT);
+		Vector<Event *> &events = eventTimeline->getEvents();
+		output.writeInt((int) events.size());
+		for (size_t i = 0, n = events.size(); i < n; i++) {
+			Event *event = events[i];
+			output.writeFloat(event->getTime());
+			output.writeIndex(const_cast<EventData *>(&event->getData()), skeletonData._events);
+			output.writeInt(event->_intValue);
+			output.writeFloat(event->_floatValue);
+			output.writeString(event->_stringValue);
+			output.writeFloat(event->_volume);
+			output.writeFloat(event->_balance);
+		}
+	}
+}
+
+void SkeletonCooked::writeCurves(DataOutput &output, int type, int index, CurveTimeline *timeline) {
+	output.writeByte((unsigned char) type);
+	output.writeInt(index);
+	output.writeInt((int) timeline->getFrameCount());
+	output.writeInt((int) ((timeline->getCurves().size() - timeline->getFrameCount()) / CurveTimeline::BEZIER_SIZE));
+	writeCurveArrays(output, timeline);
+}
+
+void SkeletonCooked::writeCurveArrays(DataOutput &output, CurveTimeline *timeline) {
+	output.writeArray(timeline->getFrames());
+	output.writeArray(timeline->getCurves());
+	output.writeArray(timeline->getQuantizedCurves());
+	output.writeFloat(timeline->getQuantizedMin());
+	output.writeFloat(timeline->getQuantizedScale());
+}
@@ -34,6 +34,7 @@
 #include <spine/SkeletonData.h>
 
 #include <spine/Animation.h>
+#include <spine/AnimationCache.h>
 #include <spine/BoneData.h>
 #include <spine/EventData.h>
 #include <spine/IkConstraintData.h>
@@ -46,8 +47,11 @@
 
 using namespace spine;
 
-SkeletonData::SkeletonData() : _name(),
+SkeletonData::SkeletonData() : _useArena(false),
+							   _skeletonArenaBytes(0),
+							   _name(),
 							   _defaultSkin(NULL),
+							   _animationCache(NULL),
 							   _x(0),
 							   _y(0),
 							   _width(0),
@@ -59,6 +63,7 @@ SkeletonData::SkeletonData() : _name(),
 }
 
 SkeletonData::~SkeletonData() {
+	ArenaScope arenaScope(_useArena ? &_arena : NULL);
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_skins);
@@ -67,6 +72,11 @@ SkeletonData::~SkeletonData() {
 
 	ContainerUtil::cleanUpVectorOfPointers(_events);
 	ContainerUtil::cleanUpVectorOfPointers(_animations);
+	delete _animationCache;
+	for (size_t i = 0; i < _animationArenas.size(); i++) {
+		_animationArenas[i]->~Arena();
+		SpineExtension::free(_animationArenas[i], __FILE__, __LINE__);
+	}
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
@@ -76,35 +86,105 @@ SkeletonData::~SkeletonData() {
 }
 
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	return findBone(boneName.buffer());
+}
+
+BoneData *SkeletonData::findBone(const char *boneName) {
+	int index = _boneIndex.find(_bones, boneName);
+	return index == -1 ? NULL : _bones[index];
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	return findSlot(slotName.buffer());
+}
+
+SlotData *SkeletonData::findSlot(const char *slotName) {
+	int index = _slotIndex.find(_slots, slotName);
+	return index == -1 ? NULL : _slots[index];
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	return findSkin(skinName.buffer());
+}
+
+Skin *SkeletonData::findSkin(const char *skinName) {
+	int index = _skinIndex.find(_skins, skinName);
+	return index == -1 ? NULL : _skins[index];
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
-	return ContainerUtil::findWithName(_events, eventDataName);
+	return findEvent(eventDataName.buffer());
+}
+
+spine::EventData *SkeletonData::findEvent(const char *eventDataName) {
+	int index = _eventIndex.find(_events, eventDataName);
+	return index == -1 ? NULL : _events[index];
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	return findAnimation(animationName.buffer());
+}
+
+Animation *SkeletonData::findAnimation(const char *animationName) {
+	Animation *animation = lookupAnimation(animationName);
+	if (animation) animation->load();
+	return animation;
+}
+
+Animation *SkeletonData::retainAnimation(const String &animationName) {
+	return retainAnimation(animationName.buffer());
+}
+
+Animation *SkeletonData::retainAnimation(const char *animationName) {
+	Animation *animation = lookupAnimation(animationName);
+	if (animation && !animation->retain()) {
+		animation->release();
+		return NULL;
+	}
+	return animation;
+}
+
+Animation *SkeletonData::lookupAnimation(const char *animationName) {
+	int index = _animationIndex.find(_animations, animationName);
+	return index == -1 ? NULL : _animations[index];
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_ikConstraints, constraintName);
+	return findIkConstraint(constraintName.buffer());
+}
+
+IkConstraintData *SkeletonData::findIkConstraint(const char *constraintName) {
+	int index = _ikConstraintIndex.find(_ikConstraints, constraintName);
+	return index == -1 ? NULL : _ikConstraints[index];
 }
 
 TransformConstraintData *SkeletonData::findTransformConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_transformConstraints, constraintName);
+	return findTransformConstraint(constraintName.buffer());
+}
+
+TransformConstraintData *SkeletonData::findTransformConstraint(const char *constraintName) {
+	int index = _transformConstraintIndex.find(_transformConstraints, constraintName);
+	return index == -1 ? NULL : _transformConstraints[index];
 }
 
 PathConstraintData *SkeletonData::findPathConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_pathConstraints, constraintName);
+	return findPathConstraint(constraintName.buffer());
+}
+
+PathConstraintData *SkeletonData::findPathConstraint(const char *constraintName) {
+	int index = _pathConstraintIndex.find(_pathConstraints, constraintName);
+	return index == -1 ? NULL : _pathConstraints[index];
+}
+
+void SkeletonData::updateNameIndices() {
+	_boneIndex.update(_bones);
+	_slotIndex.update(_slots);
+	_skinIndex.update(_skins);
+	_eventIndex.update(_events);
+	_animationIndex.update(_animations);
+	_ikConstraintIndex.update(_ikConstraints);
+	_transformConstraintIndex.update(_transformConstraints);
+	_pathConstraintIndex.update(_pathConstraints);
 }
 
 const String &SkeletonData::getName() {
@@ -143,6 +223,10 @@ Vector<Animation *> &SkeletonData::getAnimations() {
 	return _animations;
 }
 
+AnimationCache *SkeletonData::getAnimationCache() {
+	return _animationCache;
+}
+
 Vector<IkConstraintData *> &SkeletonData::getIkConstraints() {
 	return _ikConstraints;
 }
@@ -227,3 +311,11 @@ float SkeletonData::getFps() {
 void SkeletonData::setFps(float inValue) {
 	_fps = inValue;
 }
+
+bool SkeletonData::getUseArena() {
+	return _useArena;
+}
+
+Arena &SkeletonData::getArena() {
+	return _arena;
+}
@@ -56,6 +56,7 @@
 #include <spine/IkConstraintData.h>
 #include <spine/IkConstraintTimeline.h>
 #include <spine/MeshAttachment.h>
+#include <spine/ParallelRunner.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraintData.h>
 #include <spine/PathConstraintMixTimeline.h>
@@ -79,6 +80,19 @@
 
 using namespace spine;
 
+namespace {
+	// Animations decoded in parallel are split into at most this many jobs. Each job allocates from its own arena.
+	const int MAX_ANIMATION_JOBS = 32;
+
+	struct AnimationJobs {
+		SkeletonJson *json;
+		SkeletonData *skeletonData;
+		Vector<Json *> animations;
+		Vector<int> firstAnimations;// The first animation of each job, followed by the animation count.
+		Vector<String> errors;      // Set by the jobs that failed.
+	};
+}
+
 static float toColor(const char *value, size_t index) {
 	char digits[3];
 	char *error;
@@ -105,11 +119,13 @@ static void toColor(Color &color, const char *value, bool hasAlpha) {
 }
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _ownsLoader(true), _useArena(false), _parallelRunner(NULL) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
-																				  _ownsLoader(ownsLoader) {
+																				  _ownsLoader(ownsLoader),
+																				  _useArena(false),
+																				  _parallelRunner(NULL) {
 	assert(_attachmentLoader != NULL);
 }
 
@@ -151,6 +167,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	}
 
 	skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	skeletonData->_useArena = _useArena;
+	ArenaScope arenaScope(_useArena ? &skeletonData->_arena : NULL);
 
 	skeleton = Json::getItem(root, "skeleton");
 	if (skeleton) {
@@ -624,6 +642,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 								_attachmentLoader->configureAttachment(mesh);
 							} else {
 								bool inheritDeform = Json::getInt(attachmentMap, "deform", 1) ? true : false;
+								// Linked meshes are owned by the loader, which may outlive the skeleton data's arena.
+								ArenaScope noArena(NULL);
 								LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
 																							 String(Json::getString(
 																									 attachmentMap,
@@ -693,6 +713,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 							if (end) clip->_endSlot = skeletonData->findSlot(end);
 							vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
 							readVertices(attachmentMap, clip, vertexCount);
+							clip->updateConvexPolygons();
 							color = Json::getString(attachmentMap, "color", NULL);
 							if (color) toColor(clip->getColor(), color, true);
 							_attachmentLoader->configureAttachment(attachment);
@@ -754,23 +775,34 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		}
 	}
 
+	skeletonData->updateNameIndices();
+
 	/* Animations. */
 	animations = Json::getItem(root, "animations");
 	if (animations) {
 		Json *animationMap;
 		skeletonData->_animations.ensureCapacity(animations->_size);
 		skeletonData->_animations.setSize(animations->_size, 0);
-		int animationsIndex = 0;
-		for (animationMap = animations->_child; animationMap; animationMap = animationMap->_next) {
-			Animation *animation = readAnimation(animationMap, skeletonData);
-			if (!animation) {
+		if (_parallelRunner && animations->_size > 1) {
+			if (!readAnimations(animations, skeletonData)) {
 				delete skeletonData;
 				delete root;
 				return NULL;
 			}
-			skeletonData->_animations[animationsIndex++] = animation;
+		} else {
+			int animationsIndex = 0;
+			for (animationMap = animations->_child; animationMap; animationMap = animationMap->_next) {
+				Animation *animation = readAnimation(animationMap, skeletonData);
+				if (!animation) {
+					delete skeletonData;
+					delete root;
+					return NULL;
+				}
+				skeletonData->_animations[animationsIndex++] = animation;
+			}
 		}
 	}
+	skeletonData->updateNameIndices();
 
 	delete root;
 
@@ -1430,9 +1462,84 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 
 	attachment->getVertices().clearAndAddAll(bonesAndWeights._vertices);
 	attachment->getBones().clearAndAddAll(bonesAndWeights._bones);
+	attachment->updateSkinning();
 }
 
 void SkeletonJson::setError(Json *root, const String &value1, const String &value2) {
+	ArenaScope noArena(NULL);
 	_error = String(value1).append(value2);
 	delete root;
 }
+
+/// Decodes the animations on the parallel runner. Returns false if an animation could not be read.
+bool SkeletonJson::readAnimations(Json *animations, SkeletonData *skeletonData) {
+	AnimationJobs jobs;
+	jobs.json = this;
+	jobs.skeletonData = skeletonData;
+
+	// Split the animations into jobs with about the same number of timeline keys.
+	Vector<size_t> sizes;
+	size_t totalSize = 0;
+	for (Json *animationMap = animations->_child; animationMap; animationMap = animationMap->_next) {
+		size_t size = countNodes(animationMap, 4);
+		jobs.animations.add(animationMap);
+		sizes.add(size);
+		totalSize += size;
+	}
+	int animationsCount = (int) jobs.animations.size();
+	size_t jobSize = totalSize / MAX_ANIMATION_JOBS + 1, size = 0;
+	jobs.firstAnimations.add(0);
+	for (int i = 1; i < animationsCount; ++i) {
+		size += sizes[i - 1];
+		if (size < jobSize) continue;
+		jobs.firstAnimations.add(i);
+		size = 0;
+	}
+	jobs.firstAnimations.add(animationsCount);
+	int jobCount = (int) jobs.firstAnimations.size() - 1;
+
+	if (skeletonData->_useArena) {
+		for (int i = 0; i < jobCount; ++i)
+			skeletonData->_animationArenas.add(new (SpineExtension::alloc<Arena>(1, __FILE__, __LINE__)) Arena());
+	}
+	jobs.errors.setSize(jobCount, String());
+	_parallelRunner->run(jobCount, readAnimationsJob, &jobs);
+
+	// Report the error of the first failed animation, as the sequential reader would.
+	for (int i = 0; i < jobCount; ++i) {
+		if (jobs.errors[i].isEmpty()) continue;
+		ArenaScope noArena(NULL);
+		_error = jobs.errors[i];
+		return false;
+	}
+	return true;
+}
+
+void SkeletonJson::readAnimationsJob(void *context, int job) {
+	AnimationJobs *jobs = (AnimationJobs *) context;
+	SkeletonData *skeletonData = jobs->skeletonData;
+	// A reader per job, so errors are not set concurrently.
+	SkeletonJson reader(jobs->json->_attachmentLoader);
+	reader._scale = jobs->json->_scale;
+	ArenaScope arenaScope(skeletonData->_useArena ? skeletonData->_animationArenas[job] : NULL);
+
+	for (int i = jobs->firstAnimations[job], n = jobs->firstAnimations[job + 1]; i < n; ++i) {
+		Animation *animation = reader.readAnimation(jobs->animations[i], skeletonData);
+		if (!animation) {
+			ArenaScope noArena(NULL);
+			jobs->errors[job] = reader._error;
+			return;
+		}
+		skeletonData->_animations[i] = animation;
+	}
+}
+
+/// The number of nodes below the given one, down to the given depth.
+size_t SkeletonJson::countNodes(Json *json, int depth) {
+	size_t count = json->_size;
+	if (depth > 1) {
+		for (Json *child = json->_child; child; child = child->_next)
+			count += countNodes(child, depth - 1);
+	}
+	return count;
+}
@@ -109,6 +109,7 @@ void Slot::setAttachment(Attachment *inValue) {
 
 	_attachment = inValue;
 	_attachmentTime = _skeleton.getTime();
+	_skeleton.incrementPoseVersion();
 }
 
 int Slot::getAttachmentState() {
@@ -33,6 +33,7 @@
 
 #include <spine/Timeline.h>
 
+#include <spine/Animation.h>
 #include <spine/Event.h>
 #include <spine/Skeleton.h>
 
@@ -47,6 +48,17 @@ namespace spine {
 	Timeline::~Timeline() {
 	}
 
+	void Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
+						 MixBlend blend, MixDirection direction, size_t *cursor) {
+		SP_UNUSED(cursor);
+		apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+	}
+
+	void Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
+						 MixBlend blend, MixDirection direction) {
+		apply(skeleton, lastTime, time, pEvents, alpha, blend, direction, NULL);
+	}
+
 	Vector<PropertyId> &Timeline::getPropertyIds() {
 		return _propertyIds;
 	}
@@ -75,4 +87,24 @@ namespace spine {
 		return _frames[_frames.size() - getFrameEntries()];
 	}
 
+	int Timeline::searchFrame(float time, size_t *cursor) {
+		size_t step = _frameEntries;
+		if (!cursor) return Animation::search(_frames, time, (int) step);
+		size_t frameCount = _frames.size() / step;
+		float *frames = _frames.buffer();
+		size_t frame = *cursor;
+		if (frame < frameCount && (frame == 0 || frames[frame * step] <= time)) {
+			// Scan a few frames forward before falling back to a binary search.
+			for (size_t n = frame + 4; frame < n; frame++) {
+				if (frame + 1 >= frameCount || frames[(frame + 1) * step] > time) {
+					*cursor = frame;
+					return (int) (frame * step);
+				}
+			}
+		}
+		int result = Animation::search(_frames, time, (int) step);
+		*cursor = result / step;
+		return result;
+	}
+
 }// namespace spine
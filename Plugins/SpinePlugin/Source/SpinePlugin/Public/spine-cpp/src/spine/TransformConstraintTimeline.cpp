@@ -58,7 +58,7 @@ TransformConstraintTimeline::TransformConstraintTimeline(size_t frameCount, size
 }
 
 void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents,
-										float alpha, MixBlend blend, MixDirection direction) {
+										float alpha, MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -92,7 +92,7 @@ void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, floa
 	}
 
 	float rotate, x, y, scaleX, scaleY, shearY;
-	int i = Animation::search(_frames, time, TransformConstraintTimeline::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / TransformConstraintTimeline::ENTRIES];
 	switch (curveType) {
 		case TransformConstraintTimeline::LINEAR: {
@@ -57,7 +57,7 @@ TranslateTimeline::~TranslateTimeline() {
 }
 
 void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							  MixBlend blend, MixDirection direction) {
+							  MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -81,7 +81,7 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	}
 
 	float x = 0, y = 0;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = searchFrame(time, cursor);
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -134,7 +134,7 @@ TranslateXTimeline::~TranslateXTimeline() {
 }
 
 void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							   MixBlend blend, MixDirection direction) {
+							   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -155,7 +155,7 @@ void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 		return;
 	}
 
-	float x = getCurveValue(time);
+	float x = getCurveValue(time, cursor);
 	switch (blend) {
 		case MixBlend_Setup:
 			bone->_x = bone->_data._x + x * alpha;
@@ -182,7 +182,7 @@ TranslateYTimeline::~TranslateYTimeline() {
 }
 
 void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							   MixBlend blend, MixDirection direction) {
+							   MixBlend blend, MixDirection direction, size_t *cursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -203,7 +203,7 @@ void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 		return;
 	}
 
-	float y = getCurveValue(time);
+	float y = getCurveValue(time, cursor);
 	switch (blend) {
 		case MixBlend_Setup:
 			bone->_y = bone->_data._y + y * alpha;
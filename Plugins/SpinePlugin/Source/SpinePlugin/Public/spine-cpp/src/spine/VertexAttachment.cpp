@@ -38,6 +38,16 @@
 #include <spine/Bone.h>
 #include <spine/Skeleton.h>
 
+#include <atomic>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define SPINE_SKIN_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SPINE_SKIN_NEON
+#endif
+
 using namespace spine;
 
 RTTI_IMPL(VertexAttachment, Attachment)
@@ -64,21 +74,26 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 
 void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t count, float *worldVertices, size_t offset,
 											size_t stride) {
+	if (start == 0 && count == _worldVerticesLength && _skinBuckets.size() > 0) {
+		computeSkinnedVertices(slot, worldVertices, offset, stride);
+		return;
+	}
+
 	count = offset + (count >> 1) * stride;
 	Skeleton &skeleton = slot._bone._skeleton;
-	Vector<float> *deformArray = &slot.getDeform();
-	Vector<float> *vertices = &_vertices;
-	Vector<size_t> &bones = _bones;
-	if (bones.size() == 0) {
-		if (deformArray->size() > 0) vertices = deformArray;
+	Vector<float> &deformArray = slot.getDeform();
+	const float *vertices = _vertices.buffer();
+	const size_t *bones = _bones.buffer();
+	if (_bones.size() == 0) {
+		if (deformArray.size() > 0) vertices = deformArray.buffer();
 
 		Bone &bone = slot._bone;
 		float x = bone._worldX;
 		float y = bone._worldY;
 		float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
 		for (size_t vv = start, w = offset; w < count; vv += 2, w += stride) {
-			float vx = (*vertices)[vv];
-			float vy = (*vertices)[vv + 1];
+			float vx = vertices[vv];
+			float vy = vertices[vv + 1];
 			worldVertices[w] = vx * a + vy * b + x;
 			worldVertices[w + 1] = vx * c + vy * d + y;
 		}
@@ -87,23 +102,22 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 
 	int v = 0, skip = 0;
 	for (size_t i = 0; i < start; i += 2) {
-		int n = bones[v];
+		int n = (int) bones[v];
 		v += n + 1;
 		skip += n;
 	}
 
-	Vector<Bone *> &skeletonBones = skeleton.getBones();
-	if (deformArray->size() == 0) {
+	Bone **skeletonBones = skeleton.getBones().buffer();
+	if (deformArray.size() == 0) {
 		for (size_t w = offset, b = skip * 3; w < count; w += stride) {
 			float wx = 0, wy = 0;
-			int n = bones[v++];
+			int n = (int) bones[v++];
 			n += v;
 			for (; v < n; v++, b += 3) {
-				Bone *boneP = skeletonBones[bones[v]];
-				Bone &bone = *boneP;
-				float vx = (*vertices)[b];
-				float vy = (*vertices)[b + 1];
-				float weight = (*vertices)[b + 2];
+				Bone &bone = *skeletonBones[bones[v]];
+				float vx = vertices[b];
+				float vy = vertices[b + 1];
+				float weight = vertices[b + 2];
 				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
 				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
 			}
@@ -111,16 +125,16 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 			worldVertices[w + 1] = wy;
 		}
 	} else {
+		const float *deform = deformArray.buffer();
 		for (size_t w = offset, b = skip * 3, f = skip << 1; w < count; w += stride) {
 			float wx = 0, wy = 0;
-			int n = bones[v++];
+			int n = (int) bones[v++];
 			n += v;
 			for (; v < n; v++, b += 3, f += 2) {
-				Bone *boneP = skeletonBones[bones[v]];
-				Bone &bone = *boneP;
-				float vx = (*vertices)[b] + (*deformArray)[f];
-				float vy = (*vertices)[b + 1] + (*deformArray)[f + 1];
-				float weight = (*vertices)[b + 2];
+				Bone &bone = *skeletonBones[bones[v]];
+				float vx = vertices[b] + deform[f];
+				float vy = vertices[b + 1] + deform[f + 1];
+				float weight = vertices[b + 2];
 				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
 				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
 			}
@@ -130,6 +144,199 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 	}
 }
 
+namespace {
+#if defined(SPINE_SKIN_SSE)
+	typedef __m128 Float4;
+
+	inline Float4 load4(const float *p) { return _mm_loadu_ps(p); }
+
+	inline Float4 set4(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+
+	inline Float4 zero4() { return _mm_setzero_ps(); }
+
+	inline Float4 add4(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+
+	inline Float4 mul4(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+
+	inline void store4(float *p, Float4 a) { _mm_storeu_ps(p, a); }
+#elif defined(SPINE_SKIN_NEON)
+	typedef float32x4_t Float4;
+
+	inline Float4 load4(const float *p) { return vld1q_f32(p); }
+
+	inline Float4 set4(float a, float b, float c, float d) {
+		float values[4] = {a, b, c, d};
+		return vld1q_f32(values);
+	}
+
+	inline Float4 zero4() { return vdupq_n_f32(0); }
+
+	inline Float4 add4(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+
+	inline Float4 mul4(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+
+	inline void store4(float *p, Float4 a) { vst1q_f32(p, a); }
+#else
+	struct Float4 {
+		float v[4];
+	};
+
+	inline Float4 set4(float a, float b, float c, float d) {
+		Float4 r = {{a, b, c, d}};
+		return r;
+	}
+
+	inline Float4 load4(const float *p) { return set4(p[0], p[1], p[2], p[3]); }
+
+	inline Float4 zero4() { return set4(0, 0, 0, 0); }
+
+	inline Float4 add4(Float4 a, Float4 b) {
+		return set4(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]);
+	}
+
+	inline Float4 mul4(Float4 a, Float4 b) {
+		return set4(a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]);
+	}
+
+	inline void store4(float *p, Float4 a) {
+		p[0] = a.v[0];
+		p[1] = a.v[1];
+		p[2] = a.v[2];
+		p[3] = a.v[3];
+	}
+#endif
+
+	/// Bone matrices gathered per call: a, b, c, d, worldX, worldY for each bone referenced by the attachment.
+	const int SKIN_MATRIX_SIZE = 6;
+	const size_t SKIN_STACK_BONES = 64;
+}
+
+void VertexAttachment::computeSkinnedVertices(Slot &slot, float *worldVertices, size_t offset, size_t stride) {
+	Bone **skeletonBones = slot._bone._skeleton.getBones().buffer();
+	size_t boneCount = _skinBones.size();
+	float stackMatrices[SKIN_STACK_BONES * SKIN_MATRIX_SIZE];
+	float *matrices = stackMatrices;
+	if (boneCount > SKIN_STACK_BONES)
+		matrices = SpineExtension::alloc<float>(boneCount * SKIN_MATRIX_SIZE, __FILE__, __LINE__);
+	for (size_t i = 0; i < boneCount; i++) {
+		Bone &bone = *skeletonBones[_skinBones[i]];
+		float *m = matrices + i * SKIN_MATRIX_SIZE;
+		m[0] = bone._a;
+		m[1] = bone._b;
+		m[2] = bone._c;
+		m[3] = bone._d;
+		m[4] = bone._worldX;
+		m[5] = bone._worldY;
+	}
+
+	Vector<float> &deformArray = slot.getDeform();
+	const float *deform = deformArray.size() > 0 ? deformArray.buffer() : NULL;
+	const float *vertices = _skinVertices.buffer();
+	const int *indices = _skinIndices.buffer();
+	const int *outputs = _skinOutputs.buffer();
+	for (size_t i = 0, n = _skinBuckets.size(); i < n; i += 2) {
+		int weights = _skinBuckets[i];
+		for (int block = 0, blocks = _skinBuckets[i + 1]; block < blocks; block++, outputs += 4) {
+			Float4 wx = zero4(), wy = zero4();
+			for (int ii = 0; ii < weights; ii++, vertices += 12, indices += 8) {
+				Float4 vx = load4(vertices);
+				Float4 vy = load4(vertices + 4);
+				Float4 weight = load4(vertices + 8);
+				if (deform) {
+					const int *f = indices + 4;
+					vx = add4(vx, set4(deform[f[0]], deform[f[1]], deform[f[2]], deform[f[3]]));
+					vy = add4(vy, set4(deform[f[0] + 1], deform[f[1] + 1], deform[f[2] + 1], deform[f[3] + 1]));
+				}
+				const float *m0 = matrices + indices[0], *m1 = matrices + indices[1];
+				const float *m2 = matrices + indices[2], *m3 = matrices + indices[3];
+				Float4 a = set4(m0[0], m1[0], m2[0], m3[0]);
+				Float4 b = set4(m0[1], m1[1], m2[1], m3[1]);
+				Float4 c = set4(m0[2], m1[2], m2[2], m3[2]);
+				Float4 d = set4(m0[3], m1[3], m2[3], m3[3]);
+				Float4 x = set4(m0[4], m1[4], m2[4], m3[4]);
+				Float4 y = set4(m0[5], m1[5], m2[5], m3[5]);
+				// Same operation order as the scalar path, so results match it exactly.
+				wx = add4(wx, mul4(add4(add4(mul4(vx, a), mul4(vy, b)), x), weight));
+				wy = add4(wy, mul4(add4(add4(mul4(vx, c), mul4(vy, d)), y), weight));
+			}
+			float lanesX[4], lanesY[4];
+			store4(lanesX, wx);
+			store4(lanesY, wy);
+			for (int lane = 0; lane < 4; lane++) {
+				size_t w = offset + outputs[lane] * stride;
+				worldVertices[w] = lanesX[lane];
+				worldVertices[w + 1] = lanesY[lane];
+			}
+		}
+	}
+
+	if (matrices != stackMatrices) SpineExtension::free(matrices, __FILE__, __LINE__);
+}
+
+void VertexAttachment::updateSkinning() {
+	_skinBones.clear();
+	_skinBuckets.clear();
+	_skinIndices.clear();
+	_skinVertices.clear();
+	_skinOutputs.clear();
+	if (_bones.size() == 0) return;
+
+	// Index of the first bone entry and of the first weight of each vertex, and the largest weight count.
+	size_t vertexCount = _worldVerticesLength >> 1;
+	Vector<int> vertexBones, vertexWeights;
+	vertexBones.setSize(vertexCount, 0);
+	vertexWeights.setSize(vertexCount, 0);
+	int maxWeights = 0;
+	size_t maxBone = 0;
+	for (size_t i = 0, v = 0, weight = 0; i < vertexCount; i++) {
+		int n = (int) _bones[v];
+		vertexBones[i] = (int) v + 1;
+		vertexWeights[i] = (int) weight;
+		if (n > maxWeights) maxWeights = n;
+		for (int ii = 1; ii <= n; ii++)
+			if (_bones[v + ii] > maxBone) maxBone = _bones[v + ii];
+		v += n + 1;
+		weight += n;
+	}
+
+	Vector<int> boneOffsets;
+	boneOffsets.setSize(maxBone + 1, -1);
+	Vector<int> bucket;
+	for (int weights = 1; weights <= maxWeights; weights++) {
+		bucket.clear();
+		for (size_t i = 0; i < vertexCount; i++)
+			if ((int) _bones[vertexBones[i] - 1] == weights) bucket.add((int) i);
+		if (bucket.size() == 0) continue;
+
+		int blocks = (int) (bucket.size() + 3) >> 2;
+		_skinBuckets.add(weights);
+		_skinBuckets.add(blocks);
+		for (int block = 0; block < blocks; block++) {
+			int lanes[4];
+			for (int lane = 0; lane < 4; lane++) {
+				size_t index = block * 4 + lane;
+				lanes[lane] = bucket[index < bucket.size() ? index : bucket.size() - 1];
+				_skinOutputs.add(lanes[lane]);
+			}
+			for (int ii = 0; ii < weights; ii++) {
+				for (int lane = 0; lane < 4; lane++) {
+					size_t bone = _bones[vertexBones[lanes[lane]] + ii];
+					if (boneOffsets[bone] == -1) {
+						boneOffsets[bone] = (int) _skinBones.size() * SKIN_MATRIX_SIZE;
+						_skinBones.add(bone);
+					}
+					_skinIndices.add(boneOffsets[bone]);
+				}
+				for (int lane = 0; lane < 4; lane++)
+					_skinIndices.add((vertexWeights[lanes[lane]] + ii) << 1);
+				for (int component = 0; component < 3; component++)
+					for (int lane = 0; lane < 4; lane++)
+						_skinVertices.add(_vertices[(vertexWeights[lanes[lane]] + ii) * 3 + component]);
+			}
+		}
+	}
+}
+
 int VertexAttachment::getId() {
 	return _id;
 }
@@ -159,7 +366,7 @@ void VertexAttachment::setDeformAttachment(VertexAttachment *attachment) {
 }
 
 int VertexAttachment::getNextID() {
-	static int nextID = 0;
+	static std::atomic<int> nextID(0);
 	return nextID++;
 }
 
@@ -168,4 +375,9 @@ void VertexAttachment::copyTo(VertexAttachment *other) {
 	other->_vertices.clearAndAddAll(this->_vertices);
 	other->_worldVerticesLength = this->_worldVerticesLength;
 	other->_deformAttachment = this->_deformAttachment;
+	other->_skinBones.clearAndAddAll(this->_skinBones);
+	other->_skinBuckets.clearAndAddAll(this->_skinBuckets);
+	other->_skinIndices.clearAndAddAll(this->_skinIndices);
+	other->_skinVertices.clearAndAddAll(this->_skinVertices);
+	other->_skinOutputs.clearAndAddAll(this->_skinOutputs);
 }
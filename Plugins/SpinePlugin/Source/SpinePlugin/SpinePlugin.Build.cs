@@ -20,6 +20,7 @@ namespace UnrealBuildTool.Rules
 			PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/spine-cpp/include"));
 
             PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "ProceduralMeshComponent", "UMG", "Slate", "SlateCore" });
+			PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore", "RHI" });
 			PublicDefinitions.Add("SPINE_UE4");
 		}
 	}
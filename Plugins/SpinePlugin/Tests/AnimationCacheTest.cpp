@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace spine;
+using namespace spine::test;
+
+// timelines.skel has several animations with every timeline type.
+static SkeletonData *readLazy() {
+	std::string binary = readDataFile("timelines.skel");
+	TestAttachmentLoader loader;
+	SkeletonBinary reader(&loader);
+	reader.setLazyAnimations(true);
+	SkeletonData *skeletonData = reader.readSkeletonData((const unsigned char *) binary.data(), (int) binary.size());
+	if (!skeletonData) fail(__FILE__, __LINE__, reader.getError().buffer());
+	else if (!skeletonData->getAnimationCache())
+		fail(__FILE__, __LINE__, "No animation cache.");
+	if (skeletonData && skeletonData->getAnimations().size() < 3) fail(__FILE__, __LINE__, "Too few animations.");
+	return skeletonData && skeletonData->getAnimationCache() && skeletonData->getAnimations().size() >= 3 ? skeletonData : NULL;
+}
+
+// The counters are those ReportAnimationMemory() logs.
+SPINE_TEST(animationsLoadOnFirstUse) {
+	SkeletonData *skeletonData = readLazy();
+	if (!skeletonData) return;
+	AnimationCache &cache = *skeletonData->getAnimationCache();
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	SPINE_CHECK(cache.getAnimationCount() == animations.size());
+	SPINE_CHECK(cache.getLoadedCount() == 0 && cache.getLoadedBytes() == 0 && cache.getLoads() == 0);
+	SPINE_CHECK(cache.getEncodedBytes() > 0 && cache.getEncodedBytes() < readDataFile("timelines.skel").size());
+	SPINE_CHECK(!animations[0]->isLoaded() && animations[0]->getTimelines().size() == 0);
+
+	Animation *animation = skeletonData->findAnimation(animations[0]->getName());
+	SPINE_CHECK(animation == animations[0] && animation->isLoaded() && animation->getTimelines().size() > 0);
+	SPINE_CHECK(cache.getLoadedCount() == 1 && cache.getLoads() == 1);
+	size_t bytes = cache.getLoadedBytes();
+	SPINE_CHECK(bytes > 0);
+
+	// Found again without decoding again.
+	skeletonData->findAnimation(animations[0]->getName());
+	SPINE_CHECK(cache.getLoads() == 1 && cache.getLoadedBytes() == bytes);
+
+	for (size_t i = 0; i < animations.size(); i++)
+		SPINE_CHECK(animations[i]->load());
+	SPINE_CHECK(cache.getLoadedCount() == animations.size() && cache.getLoads() == animations.size());
+	SPINE_CHECK(cache.getLoadedBytes() > bytes && cache.getReleases() == 0);
+	SPINE_CHECK(!skeletonData->findAnimation("missing") && !skeletonData->retainAnimation("missing"));
+	delete skeletonData;
+}
+
+SPINE_TEST(trimReleasesLeastRecentlyUsed) {
+	SkeletonData *skeletonData = readLazy();
+	if (!skeletonData) return;
+	AnimationCache &cache = *skeletonData->getAnimationCache();
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < 3; i++)
+		animations[i]->load();
+	size_t bytes = cache.getLoadedBytes();
+
+	// One byte over the budget releases only the animation used longest ago.
+	cache.setBudget(bytes - 1);
+	SPINE_CHECK(!animations[0]->isLoaded() && animations[0]->getTimelines().size() == 0);
+	SPINE_CHECK(animations[1]->isLoaded() && animations[2]->isLoaded());
+	SPINE_CHECK(cache.getLoadedCount() == 2 && cache.getReleases() == 1 && cache.getLoadedBytes() < bytes);
+
+	// Loading it again releases the next oldest to stay within the budget.
+	SPINE_CHECK(animations[0]->load());
+	SPINE_CHECK(animations[0]->isLoaded() && !animations[1]->isLoaded() && animations[2]->isLoaded());
+	SPINE_CHECK(cache.getLoads() == 4 && cache.getReleases() == 2);
+
+	// Retained animations are kept over budget, and released once they are no longer retained.
+	Animation *retained = skeletonData->retainAnimation(animations[1]->getName());
+	SPINE_CHECK(retained == animations[1] && retained->isLoaded());
+	cache.setBudget(1);
+	SPINE_CHECK(retained->isLoaded() && !animations[0]->isLoaded() && !animations[2]->isLoaded());
+	SPINE_CHECK(cache.getLoadedCount() == 1 && cache.getLoadedBytes() > 0);
+	retained->release();
+	SPINE_CHECK(!retained->isLoaded() && cache.getLoadedCount() == 0 && cache.getLoadedBytes() == 0);
+
+	// A budget of 0 keeps everything again.
+	cache.setBudget(0);
+	for (size_t i = 0; i < animations.size(); i++)
+		SPINE_CHECK(animations[i]->load());
+	SPINE_CHECK(cache.getLoadedCount() == animations.size());
+	delete skeletonData;
+}
+
+SPINE_TEST(animationStateRetainsItsAnimations) {
+	SkeletonData *skeletonData = readLazy();
+	if (!skeletonData) return;
+	AnimationCache &cache = *skeletonData->getAnimationCache();
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	cache.setBudget(1);
+	{
+		AnimationStateData stateData(skeletonData);
+		AnimationState *state = new AnimationState(&stateData);
+		state->setAnimation(0, animations[0]->getName(), true);
+		state->addAnimation(0, animations[1], true, 0);
+		SPINE_CHECK(animations[0]->isLoaded() && animations[1]->isLoaded());
+		SPINE_CHECK(cache.getLoadedCount() == 2);
+
+		// Replacing an animation that was never applied ends its entry. With the queue disabled the entry is still
+		// queued when the state is destroyed, which releases its animation too.
+		state->disableQueue();
+		state->setAnimation(0, animations[2], true);
+		SPINE_CHECK(animations[2]->isLoaded());
+		delete state;
+	}
+	SPINE_CHECK(cache.getLoadedCount() == 0 && cache.getLoadedBytes() == 0);
+	for (size_t i = 0; i < 3; i++)
+		SPINE_CHECK(!animations[i]->isLoaded());
+	delete skeletonData;
+}
+
+SPINE_TEST(retainedAnimationsSurviveConcurrentTrims) {
+	SkeletonData *skeletonData = readLazy();
+	if (!skeletonData) return;
+	AnimationCache &cache = *skeletonData->getAnimationCache();
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	const String &name = animations[0]->getName();
+	cache.setBudget(1);
+
+	// One thread applies a retained animation while another loads the other animations and trims, which releases every
+	// animation that is not retained. Use after release is caught by the address sanitizer.
+	std::atomic<bool> done(false);
+	std::atomic<int> missing(0);
+	std::thread trimmer([&]() {
+		for (size_t i = 0; !done; i++) {
+			Animation *animation = animations[1 + i % (animations.size() - 1)];
+			animation->load();
+			cache.setBudget(i % 2 ? 1 : 2);
+		}
+	});
+	{
+		Skeleton skeleton(skeletonData);
+		for (int i = 0; i < 2000; i++) {
+			Animation *animation = skeletonData->retainAnimation(name);
+			if (!animation || !animation->isLoaded() || animation->getTimelines().size() == 0) missing++;
+			if (!animation) continue;
+			animation->apply(skeleton, 0, animation->getDuration() * (i % 10) / 10, false, NULL, 1, MixBlend_Setup,
+							 MixDirection_In);
+			animation->release();
+		}
+	}
+	done = true;
+	trimmer.join();
+	SPINE_CHECK(missing == 0);
+	SPINE_CHECK(cache.getReleases() > 0);
+	delete skeletonData;
+}
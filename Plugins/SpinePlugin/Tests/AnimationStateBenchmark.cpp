@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+
+using namespace spine;
+using namespace spine::test;
+
+// Measures AnimationState::setAnimation followed by the first apply, which runs computeHold over every timeline of
+// every track entry in the mix.
+int main(int argc, char **argv) {
+	const int boneCount = 250;
+	const int animationCount = 4;
+	const int changes = isQuick(argc, argv) ? 10 : 2000;
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(boneCount, animationCount));
+	if (!skeletonData) return 1;
+	Skeleton *skeleton = new Skeleton(skeletonData);
+	AnimationStateData *stateData = new AnimationStateData(skeletonData);
+	stateData->setDefaultMix(0.2f);
+	AnimationState *state = new AnimationState(stateData);
+
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	size_t timelineCount = animations[0]->getTimelines().size();
+
+	Timer timer;
+	for (int i = 0; i < changes; i++) {
+		state->setAnimation(0, animations[i % animationCount], true);
+		state->setAnimation(1, animations[(i + 1) % animationCount], true);
+		state->update(0.05f);
+		state->apply(*skeleton);
+	}
+	double milliseconds = timer.getMilliseconds();
+
+	printf("AnimationState::setAnimation, %d bones, %d timelines per animation, 2 tracks with mixing\n", boneCount,
+		   (int) timelineCount);
+	printf("  %.2f us per change (setAnimation on both tracks, update and apply)\n", milliseconds * 1000 / changes);
+	delete state;
+	delete stateData;
+	delete skeleton;
+	delete skeletonData;
+	return 0;
+}
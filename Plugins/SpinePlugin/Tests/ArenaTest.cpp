@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace spine;
+using namespace spine::test;
+
+// Frees tell arena memory from heap memory by looking up the registered arena blocks without locking, while other
+// threads register and release blocks. Heap memory taken for arena memory leaks and arena memory taken for heap memory
+// is freed twice, both are caught by the address sanitizer.
+SPINE_TEST(freesFindArenaBlocksWhileArenasChange) {
+	// The extension is created on first use, which is not thread safe.
+	SpineExtension::getInstance();
+	std::atomic<bool> done(false);
+	std::atomic<int> rounds(0);
+	std::thread arenas([&]() {
+		for (; !done; rounds++) {
+			// Enough blocks to grow the registry, and large allocations to place blocks among heap memory.
+			Arena *arena[8];
+			for (int i = 0; i < 8; i++) {
+				arena[i] = new Arena();
+				ArenaScope scope(arena[i]);
+				for (int ii = 0; ii < 20; ii++)
+					SpineExtension::alloc<char>(4096 + ii * 1024, __FILE__, __LINE__);
+			}
+			for (int i = 0; i < 8; i++)
+				delete arena[i];
+		}
+	});
+
+	Arena longLived;
+	int misplaced = 0;
+	for (int i = 0; i < 20000 || rounds < 100; i++) {
+		char *heap = SpineExtension::alloc<char>(16 + i % 4096, __FILE__, __LINE__);
+		char *arenaMemory;
+		{
+			ArenaScope scope(&longLived);
+			arenaMemory = SpineExtension::alloc<char>(16, __FILE__, __LINE__);
+		}
+		// Arena memory is moved to the heap when reallocated with no arena current, heap memory stays where it is.
+		char *moved = SpineExtension::realloc(arenaMemory, 32, __FILE__, __LINE__);
+		if (moved == arenaMemory) misplaced++;
+		SpineExtension::free(moved, __FILE__, __LINE__);
+		SpineExtension::free(arenaMemory, __FILE__, __LINE__);
+		SpineExtension::free(heap, __FILE__, __LINE__);
+	}
+	done = true;
+	arenas.join();
+	SPINE_CHECK(misplaced == 0);
+}
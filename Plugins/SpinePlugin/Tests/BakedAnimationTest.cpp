@@ -0,0 +1,173 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace spine;
+using namespace spine::test;
+
+static const float FRAME_RATE = 30;
+
+// Regions loaded without an atlas have no region size, which their offsets are divided by.
+static void setRegionSizes(SkeletonData &skeletonData) {
+	Skin::AttachmentMap::Entries entries = skeletonData.getDefaultSkin()->getAttachments();
+	while (entries.hasNext()) {
+		Attachment *attachment = entries.next()._attachment;
+		if (!attachment->getRTTI().isExactly(RegionAttachment::rtti)) continue;
+		RegionAttachment *region = (RegionAttachment *) attachment;
+		region->setRegionWidth(region->getWidth());
+		region->setRegionHeight(region->getHeight());
+		region->setRegionOriginalWidth(region->getWidth());
+		region->setRegionOriginalHeight(region->getHeight());
+		region->updateOffset();
+	}
+}
+
+static void write(BakedAnimation &baked, std::string &bytes) {
+	Vector<unsigned char> output;
+	baked.write(output);
+	bytes.assign((const char *) output.buffer(), output.size());
+}
+
+SPINE_TEST(playbackMatchesTheAnimation) {
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(31, 1));
+	if (!skeletonData) return;
+	setRegionSizes(*skeletonData);
+	Animation *animation = skeletonData->getAnimations()[0];
+	BakedAnimation *baked = BakedAnimation::bake(*skeletonData, *animation, FRAME_RATE);
+	SPINE_CHECK(baked != NULL);
+
+	std::string bytes;
+	if (baked) write(*baked, bytes);
+	BakedAnimation *read = BakedAnimation::read((const unsigned char *) bytes.data(), bytes.size());
+	SPINE_CHECK(read != NULL);
+	if (read) {
+		std::string again;
+		write(*read, again);
+		SPINE_CHECK(again == bytes);
+		SPINE_CHECK(read->getFrameCount() == (int) (animation->getDuration() * FRAME_RATE) + 1);
+
+		Vector<Attachment *> attachments;
+		read->resolveAttachments(*skeletonData, attachments);
+		for (size_t i = 0; i < attachments.size(); i++) SPINE_CHECK(attachments[i] != NULL);
+
+		// The live world vertices of every part, in the order the parts are baked.
+		Skeleton skeleton(skeletonData);
+		std::vector<float> expected;
+		std::vector<int> partVertices;
+		Vector<float> worldVertices;
+		worldVertices.setSize(8, 0);
+		float min = 0, max = 0;
+		for (int frame = 0; frame < read->getFrameCount(); frame++) {
+			skeleton.setToSetupPose();
+			animation->apply(skeleton, 0, frame / FRAME_RATE, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			skeleton.updateWorldTransform();
+
+			int part = 0;
+			for (size_t i = 0; i < skeleton.getDrawOrder().size(); i++) {
+				Slot &slot = *skeleton.getDrawOrder()[i];
+				Attachment *attachment = slot.getAttachment();
+				if (!attachment) continue;
+				SPINE_CHECK(part < read->getPartCount(frame));
+				if (part >= read->getPartCount(frame)) break;
+				SPINE_CHECK(attachments[read->getPart(frame, part++).attachmentIndex] == attachment);
+
+				int vertexCount = 4;
+				if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+					((RegionAttachment *) attachment)->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+				} else {
+					MeshAttachment *mesh = (MeshAttachment *) attachment;
+					mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+					vertexCount = (int) mesh->getWorldVerticesLength() >> 1;
+				}
+				partVertices.push_back(vertexCount);
+				for (int ii = 0; ii < vertexCount << 1; ii++) {
+					expected.push_back(worldVertices[ii]);
+					min = std::min(min, worldVertices[ii]);
+					max = std::max(max, worldVertices[ii]);
+				}
+			}
+			SPINE_CHECK(part == read->getPartCount(frame));
+		}
+
+		// Positions are quantized to 16 bits within the animation's bounds, so they are off by half a step at most.
+		const float tolerance = (max - min) / 65535;
+		float actual[8];
+		size_t part = 0, vertex = 0;
+		for (int frame = 0; frame < read->getFrameCount(); frame++) {
+			for (int i = 0; i < read->getPartCount(frame) && part < partVertices.size(); i++, part++) {
+				read->computeWorldVertices(read->getPart(frame, i), actual);
+				for (int ii = 0; ii < partVertices[part] << 1; ii++, vertex++)
+					SPINE_CHECK_NEAR(actual[ii], expected[vertex], tolerance);
+			}
+		}
+	}
+	delete read;
+	delete baked;
+	delete skeletonData;
+}
+
+SPINE_TEST(readRejectsTruncatedAndCorruptData) {
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(7, 1));
+	if (!skeletonData) return;
+	setRegionSizes(*skeletonData);
+	BakedAnimation *baked = BakedAnimation::bake(*skeletonData, *skeletonData->getAnimations()[0], FRAME_RATE);
+	std::string bytes;
+	if (baked) write(*baked, bytes);
+	delete baked;
+	delete skeletonData;
+
+	for (size_t length = 0; length < bytes.size(); length++) {
+		// A copy of its own, so reading past the end of the prefix is caught by the address sanitizer.
+		std::string prefix = bytes.substr(0, length);
+		BakedAnimation *read = BakedAnimation::read((const unsigned char *) prefix.data(), prefix.size());
+		SPINE_CHECK(read == NULL);
+		delete read;
+	}
+
+	// Maximal varints in place of each byte, which make counts that would overflow an int if they were summed.
+	for (size_t i = 0; i < bytes.size(); i++) {
+		std::string corrupt = bytes.substr(0, i) + "\xff\xff\xff\xff\x0f" + bytes.substr(i + 1);
+		BakedAnimation *read = BakedAnimation::read((const unsigned char *) corrupt.data(), corrupt.size());
+		if (read) {
+			// Corrupt colors or positions still read, but every part must lie within the vertex data.
+			for (int frame = 0; frame < read->getFrameCount(); frame++) {
+				for (int part = 0; part < read->getPartCount(frame); part++) {
+					BakedPart &bakedPart = read->getPart(frame, part);
+					SPINE_CHECK(bakedPart.firstVertex >= 0);
+					SPINE_CHECK((size_t) bakedPart.attachmentIndex < read->getAttachments().size());
+				}
+			}
+		}
+		delete read;
+	}
+}
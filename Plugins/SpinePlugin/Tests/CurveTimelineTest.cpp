@@ -0,0 +1,208 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+using namespace spine;
+using namespace spine::test;
+
+static const char *DARK_SLOT_JSON = "{\"skeleton\":{\"spine\":\"4.0.64\"},\"bones\":[{\"name\":\"root\"}],"
+									"\"slots\":[{\"name\":\"slot\",\"bone\":\"root\",\"dark\":\"000000\"}]}";
+
+// Sets a bezier for one value of frame 0, with a shape that differs for each curve so a color channel evaluated with
+// another channel's curve is noticed.
+static void setCurve(CurveTimeline &timeline, int bezier, int value, int shape, float value1, float value2) {
+	float cy1 = value1 + (value2 - value1) * (shape % 3) * 0.45f;
+	float cy2 = value1 + (value2 - value1) * (1 - (shape % 2) * 0.9f);
+	timeline.setBezier(bezier, 0, (float) value, 0, value1, 0.1f + shape * 0.12f, cy1, 0.9f - shape * 0.1f, cy2, 1, value2);
+}
+
+SPINE_TEST(rgb2DarkColorUsesItsOwnCurves) {
+	SkeletonData *skeletonData = readSkeletonJson(DARK_SLOT_JSON);
+	if (!skeletonData) return;
+	{
+		const float from[] = {0.1f, 0.2f, 0.3f, 0.9f, 0.1f, 0.5f}, to[] = {0.8f, 0.6f, 0.4f, 0.2f, 0.7f, 0};
+		RGB2Timeline rgb2(2, 6, 0);
+		rgb2.setFrame(0, 0, from[0], from[1], from[2], from[3], from[4], from[5]);
+		rgb2.setFrame(1, 1, to[0], to[1], to[2], to[3], to[4], to[5]);
+		for (int value = 0; value < 6; value++)
+			setCurve(rgb2, value, value, value, from[value], to[value]);
+
+		// RGBA2Timeline has the same curves with an opaque alpha between the light and dark colors, and is the reference.
+		RGBA2Timeline rgba2(2, 7, 0);
+		rgba2.setFrame(0, 0, from[0], from[1], from[2], 1, from[3], from[4], from[5]);
+		rgba2.setFrame(1, 1, to[0], to[1], to[2], 1, to[3], to[4], to[5]);
+		for (int value = 0; value < 3; value++)
+			setCurve(rgba2, value, value, value, from[value], to[value]);
+		setCurve(rgba2, 3, 3, 0, 1, 1);
+		for (int value = 3; value < 6; value++)
+			setCurve(rgba2, value + 1, value + 1, value, from[value], to[value]);
+
+		Skeleton rgb2Skeleton(skeletonData), rgba2Skeleton(skeletonData);
+		for (float time = 0; time <= 1; time += 0.0625f) {
+			rgb2.apply(rgb2Skeleton, 0, time, NULL, 1, MixBlend_Setup, MixDirection_In, NULL);
+			rgba2.apply(rgba2Skeleton, 0, time, NULL, 1, MixBlend_Setup, MixDirection_In, NULL);
+			Slot &actual = *rgb2Skeleton.getSlots()[0], &expected = *rgba2Skeleton.getSlots()[0];
+			SPINE_CHECK_NEAR(actual.getColor().r, expected.getColor().r, 1e-6f);
+			SPINE_CHECK_NEAR(actual.getColor().g, expected.getColor().g, 1e-6f);
+			SPINE_CHECK_NEAR(actual.getColor().b, expected.getColor().b, 1e-6f);
+			SPINE_CHECK_NEAR(actual.getDarkColor().r, expected.getDarkColor().r, 1e-6f);
+			SPINE_CHECK_NEAR(actual.getDarkColor().g, expected.getDarkColor().g, 1e-6f);
+			SPINE_CHECK_NEAR(actual.getDarkColor().b, expected.getDarkColor().b, 1e-6f);
+		}
+	}
+	delete skeletonData;
+}
+
+struct Bezier {
+	float time1, value1, cx1, cy1, cx2, cy2, time2, value2;
+};
+
+// Sets the beziers on a timeline with BEZIER_SIZE samples per curve and on a quantized one, the way SkeletonBinary does
+// with setQuantizeCurves(), then returns the largest difference between the two found by sampling every curve.
+static float compareQuantized(const Bezier *beziers, int count, float &quantizedScale) {
+	RotateTimeline sampled(count + 1, count, 0), quantized(count + 1, 0, 0);
+	quantized.setQuantized(true);
+	Vector<float> controls;
+	for (int i = 0; i < count; i++) {
+		const Bezier &b = beziers[i];
+		sampled.setFrame(i, b.time1, b.value1);
+		quantized.setFrame(i, b.time1, b.value1);
+		sampled.setBezier(i, i, 0, b.time1, b.value1, b.cx1, b.cy1, b.cx2, b.cy2, b.time2, b.value2);
+		quantized.setBezier(i, i, 0, b.time1, b.value1, b.cx1, b.cy1, b.cx2, b.cy2, b.time2, b.value2);
+		float width = b.time2 - b.time1;
+		controls.add((b.cx1 - b.time1) / width);
+		controls.add(b.cy1);
+		controls.add((b.cx2 - b.time1) / width);
+		controls.add(b.cy2);
+	}
+	sampled.setFrame(count, beziers[count - 1].time2, beziers[count - 1].value2);
+	quantized.setFrame(count, beziers[count - 1].time2, beziers[count - 1].value2);
+	quantized.setQuantizedBeziers(controls);
+	SPINE_CHECK(!sampled.isQuantized() && quantized.isQuantized());
+	SPINE_CHECK(quantized.getCurves().size() == quantized.getFrameCount());
+	quantizedScale = quantized.getQuantizedScale();
+
+	float maxError = 0;
+	for (int i = 0; i < count; i++) {
+		const Bezier &b = beziers[i];
+		for (int n = 0; n <= 1000; n++) {
+			float time = b.time1 + (b.time2 - b.time1) * n / 1000;
+			float error = MathUtil::abs(sampled.getCurveValue(time, NULL) - quantized.getCurveValue(time, NULL));
+			if (error > maxError) maxError = error;
+		}
+	}
+	return maxError;
+}
+
+SPINE_TEST(quantizedBeziersMatchSampledBeziers) {
+	static const Bezier cases[][3] = {
+			// Ease in and out over a few degrees.
+			{{0, 0, 0.25f, 0, 0.75f, 10, 1, 10}, {1, 10, 1.1f, 12, 1.4f, -3, 1.5f, 0}, {1.5f, 0, 1.6f, 0, 1.9f, 5, 2, 5}},
+			// Steep: the control points are close to the frames in time, and overshoot far beyond the values.
+			{{0, 0, 0.001f, 500, 0.002f, -500, 0.05f, 1}, {0.05f, 1, 0.0501f, 0, 0.0999f, 360, 0.1f, 360},
+			 {0.1f, 360, 0.3f, 360, 0.3f, -720, 2, 0}},
+			// A large range of values, with a curve spanning a small part of it.
+			{{0, -100000, 0.4f, 0, 0.6f, 100000, 1, 100000}, {1, 100000, 1.5f, 100000, 1.6f, 100001, 2, 100001},
+			 {2, 100001, 2.1f, 100000.5f, 2.9f, 100001.5f, 3, 100001}}};
+	// The samples are computed from the same controls, so they differ only by the rounding of the controls to 16 bits,
+	// which stays within one step of the quantized range.
+	for (int c = 0; c < 3; c++) {
+		float quantizedScale;
+		float maxError = compareQuantized(cases[c], 3, quantizedScale);
+		SPINE_CHECK(quantizedScale > 0);
+		SPINE_CHECK(maxError <= quantizedScale);
+	}
+}
+
+static SkeletonData *readQuantized(const std::string &binary) {
+	TestAttachmentLoader loader;
+	SkeletonBinary reader(&loader);
+	reader.setQuantizeCurves(true);
+	SkeletonData *skeletonData = reader.readSkeletonData((const unsigned char *) binary.data(), (int) binary.size());
+	if (!skeletonData) fail(__FILE__, __LINE__, reader.getError().buffer());
+	return skeletonData;
+}
+
+SPINE_TEST(quantizedCurvesFromBinaryMatchSampledCurves) {
+	// timelines.skel has every timeline type, with linear, stepped and bezier curves.
+	std::string binary = readDataFile("timelines.skel");
+	SkeletonData *sampledData = readSkeletonBinary(binary);
+	SkeletonData *quantizedData = readQuantized(binary);
+	if (sampledData && quantizedData) {
+		int beziers = 0;
+		for (size_t i = 0; i < sampledData->getAnimations().size(); i++) {
+			Vector<Timeline *> &sampled = sampledData->getAnimations()[i]->getTimelines();
+			Vector<Timeline *> &quantized = quantizedData->getAnimations()[i]->getTimelines();
+			SPINE_CHECK(sampled.size() == quantized.size());
+			for (size_t ii = 0; ii < sampled.size() && ii < quantized.size(); ii++) {
+				if (!sampled[ii]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+				CurveTimeline *expected = static_cast<CurveTimeline *>(sampled[ii]);
+				CurveTimeline *actual = static_cast<CurveTimeline *>(quantized[ii]);
+				SPINE_CHECK(!expected->isQuantized());
+				if (expected->getCurves().size() == expected->getFrameCount()) continue;
+				beziers++;
+				SPINE_CHECK(actual->isQuantized());
+				Vector<float> &frames = expected->getFrames();
+				size_t entries = expected->getFrameEntries();
+				// setQuantizeCurves() documents an error within 1/40000 of the range of the values, including the controls.
+				float min = actual->getQuantizedMin(), max = min + actual->getQuantizedScale() * 65535;
+				if (expected->getRTTI().isExactly(DeformTimeline::rtti)) {
+					min = MathUtil::min(min, 0.0f);
+					max = MathUtil::max(max, 1.0f);
+				} else {
+					for (size_t frame = 0; frame < frames.size(); frame += entries) {
+						for (size_t value = 1; value < entries; value++) {
+							min = MathUtil::min(min, frames[frame + value]);
+							max = MathUtil::max(max, frames[frame + value]);
+						}
+					}
+				}
+				float tolerance = (max - min) / 40000;
+				for (size_t frame = 0; frame + entries < frames.size(); frame += entries) {
+					for (int n = 0; n < 100; n++) {
+						float time = frames[frame] + (frames[frame + entries] - frames[frame]) * n / 100;
+						if (expected->getRTTI().isExactly(DeformTimeline::rtti)) {
+							float percent = static_cast<DeformTimeline *>(expected)->getCurvePercent(time, (int) frame);
+							SPINE_CHECK_NEAR(static_cast<DeformTimeline *>(actual)->getCurvePercent(time, (int) frame),
+											 percent, tolerance);
+						} else if (expected->getRTTI().instanceOf(CurveTimeline1::rtti)) {
+							float value = static_cast<CurveTimeline1 *>(expected)->getCurveValue(time, NULL);
+							SPINE_CHECK_NEAR(static_cast<CurveTimeline1 *>(actual)->getCurveValue(time, NULL), value,
+											 tolerance);
+						}
+					}
+				}
+			}
+		}
+		SPINE_CHECK(beziers > 0);
+	}
+	delete quantizedData;
+	delete sampledData;
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdlib>
+#include <unordered_map>
+
+using namespace spine;
+
+SPINE_TEST(matchesUnorderedMapUnderRandomOperations) {
+	srand(1);
+	for (int round = 0; round < 200; round++) {
+		HashMap<PropertyId, int> map;
+		std::unordered_map<PropertyId, int> expected;
+		int range = 1 + rand() % 500;
+		for (int operation = 0; operation < 5000; operation++) {
+			PropertyId key = ((PropertyId) (rand() % 20) << 32) | (rand() % range);
+			int choice = rand() % 10;
+			if (choice < 5) {
+				map.put(key, operation);
+				expected[key] = operation;
+			} else if (choice < 8) {
+				SPINE_CHECK(map.remove(key) == (expected.erase(key) > 0));
+			} else if (choice < 9) {
+				bool contains = expected.count(key) > 0;
+				SPINE_CHECK(map.containsKey(key) == contains);
+				if (contains) SPINE_CHECK(map[key] == expected[key]);
+			} else if (rand() % 50 == 0) {
+				map.clear();
+				expected.clear();
+			}
+			SPINE_CHECK(map.size() == expected.size());
+		}
+
+		size_t count = 0;
+		HashMap<PropertyId, int>::Entries entries = map.getEntries();
+		while (entries.hasNext()) {
+			HashMap<PropertyId, int>::Pair pair = entries.next();
+			SPINE_CHECK(expected.count(pair.key) && expected[pair.key] == pair.value);
+			count++;
+		}
+		SPINE_CHECK(count == expected.size());
+	}
+}
+
+SPINE_TEST(addAllReportsNewKeys) {
+	HashMap<PropertyId, bool> map;
+	Vector<PropertyId> keys;
+	for (PropertyId i = 0; i < 100; i++) keys.add(i * 7);
+	SPINE_CHECK(map.addAll(keys, true));
+	SPINE_CHECK(map.size() == 100);
+	SPINE_CHECK(!map.addAll(keys, true));
+	keys.add(1);
+	SPINE_CHECK(map.addAll(keys, true));
+	SPINE_CHECK(map.size() == 101);
+}
+
+SPINE_TEST(pointerKeys) {
+	Vector<Animation *> animations;
+	HashMap<Animation *, float> map;
+	Vector<Timeline *> timelines;
+	for (int i = 0; i < 64; i++) {
+		animations.add(new Animation("animation", timelines, 1));
+		map.put(animations[i], (float) i);
+	}
+	for (int i = 0; i < 64; i += 2) SPINE_CHECK(map.remove(animations[i]));
+	for (int i = 0; i < 64; i++) {
+		SPINE_CHECK(map.containsKey(animations[i]) == (i % 2 == 1));
+		if (i % 2) SPINE_CHECK(map[animations[i]] == (float) i);
+	}
+	for (int i = 0; i < 64; i++) delete animations[i];
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace spine;
+using namespace spine::test;
+
+// Numbers written the way the editor exports them: integers, short fractions and full float precision.
+static std::string makeNumbers(int count) {
+	std::mt19937_64 random(1);
+	std::string text = "[";
+	char number[64];
+	for (int i = 0; i < count; i++) {
+		double value = (double) (int64_t) random() / 1e12;
+		switch (random() % 3) {
+			case 0:
+				snprintf(number, sizeof(number), "%d", (int) (value / 1000));
+				break;
+			case 1:
+				snprintf(number, sizeof(number), "%.2f", value);
+				break;
+			default:
+				snprintf(number, sizeof(number), "%.9g", (float) value);
+		}
+		if (i > 0) text += ',';
+		text += number;
+	}
+	return text + "]";
+}
+
+int main(int argc, char **argv) {
+	const bool quick = isQuick(argc, argv);
+	const int count = quick ? 1000 : 1000000;
+	const int runs = quick ? 1 : 5;
+	std::string numbers = makeNumbers(count);
+
+	// strtof over the same text is the reference, it is what parseNumber used to be compared against.
+	double strtofMs = 1e9, jsonMs = 1e9;
+	float checksum = 0;
+	for (int run = 0; run < runs; run++) {
+		Timer reference;
+		const char *value = numbers.c_str() + 1;
+		for (int i = 0; i < count; i++) {
+			char *end;
+			checksum += strtof(value, &end);
+			value = end + 1;
+		}
+		strtofMs = std::min(strtofMs, reference.getMilliseconds());
+
+		Timer parse;
+		Json *json = new Json(numbers.c_str());
+		delete json;
+		jsonMs = std::min(jsonMs, parse.getMilliseconds());
+	}
+
+	std::string skeleton = makeSkeletonJson(quick ? 16 : 400, quick ? 1 : 20);
+	double skeletonMs = 1e9;
+	for (int run = 0; run < runs; run++) {
+		Timer parse;
+		Json *json = new Json(skeleton.c_str());
+		delete json;
+		skeletonMs = std::min(skeletonMs, parse.getMilliseconds());
+	}
+
+	printf("JSON number parsing, %d numbers\n", count);
+	printf("  strtof:     %.1f ns/number\n", strtofMs * 1e6 / count);
+	printf("  Json parse: %.1f ns/number, including the nodes\n", jsonMs * 1e6 / count);
+	printf("JSON skeleton parsing, %.1f MB: %.2f ms\n", skeleton.size() / 1e6, skeletonMs);
+	return checksum == checksum ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace spine;
+using namespace spine::test;
+
+// The version member comes last, after an object that has a version member of its own and a string with an escaped
+// quote, so peekString has to skip everything before it.
+static std::string makeDocument() {
+	return "{\"data\":" + makeSkeletonJson(8, 2) + ",\"escaped\":\"q\\\"}\",\"skeleton\":{\"hash\":\"h\",\"spine\":\"4.0.64\"}}";
+}
+
+SPINE_TEST(peekStringFindsTheLastMember) {
+	String version;
+	SPINE_CHECK(Json::peekString(makeDocument().c_str(), "skeleton", "spine", version));
+	SPINE_CHECK(version == "4.0.64");
+}
+
+SPINE_TEST(peekStringRejectsTruncatedDocuments) {
+	std::string document = makeDocument();
+	size_t versionEnd = document.rfind("4.0.64\"") + 7;
+	for (size_t length = 0; length < document.size(); length++) {
+		// A copy of its own, so reading past the end of the prefix is caught by the address sanitizer.
+		std::string prefix = document.substr(0, length);
+		String version;
+		bool found = Json::peekString(prefix.c_str(), "skeleton", "spine", version);
+		SPINE_CHECK(found == (length >= versionEnd));
+	}
+}
+
+SPINE_TEST(peekStringRejectsMalformedDocuments) {
+	const char *documents[] = {
+			"",
+			"[]",
+			"{\"a\":{\"b\":\"unterminated",
+			"{\"a\":[\"unterminated",
+			"{\"a\":\"ends with a backslash\\",
+			"{\"a\":[}",
+			"{\"a\":}",
+			"{\"a\" 1}",
+			"{,}",
+			"{\"skeleton\":",
+			"{\"skeleton\":{\"spine\":4}}",
+			"{\"skeleton\":{\"spine\":\"unterminated",
+			"{\"skeleton\":{\"nested\":{\"spine\":\"no\"}}}",
+	};
+	for (const char *document : documents) {
+		std::string copy = document;
+		String version;
+		SPINE_CHECK(!Json::peekString(copy.c_str(), "skeleton", "spine", version));
+	}
+}
+
+static void checkNumber(const char *text) {
+	std::string document = std::string("{\"v\":") + text + "}";
+	Json json(document.c_str());
+	float expected = strtof(text, NULL);
+	if (Json::getFloat(&json, "v", 0) != expected) {
+		char message[128];
+		snprintf(message, sizeof(message), "%s parsed as %.9g, expected %.9g", text, Json::getFloat(&json, "v", 0), expected);
+		fail(__FILE__, __LINE__, message);
+	}
+	double value = strtod(text, NULL);
+	if (fabs(value) < 2e9) SPINE_CHECK(Json::getInt(&json, "v", 0) == (int) value);
+}
+
+SPINE_TEST(numbersAreCorrectlyRounded) {
+	const char *numbers[] = {"0", "-0", "17", "-17.9", "4.0", "0.1", "1e10", "1E-5", "-2.5e+3", "3.4028234e38", "1e-45",
+							 "1.5e400", "123456789012345678901234", "0.000000000000000000000000001234",
+							 "0.30000000000000004", "1234567.1234567"};
+	for (const char *number : numbers) checkNumber(number);
+
+	std::mt19937_64 random(5);
+	for (int i = 0; i < 20000; i++) {
+		double value = (double) (int64_t) random() / 1e9 / (double) (1 << (random() % 30));
+		char text[64];
+		switch (random() % 3) {
+			case 0:
+				snprintf(text, sizeof(text), "%.*f", (int) (random() % 12), value);
+				break;
+			case 1:
+				snprintf(text, sizeof(text), "%.17g", value);
+				break;
+			default:
+				snprintf(text, sizeof(text), "%.9g", (float) value);
+		}
+		checkNumber(text);
+	}
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+
+using namespace spine;
+using namespace spine::test;
+
+SPINE_TEST(indexedFindsMatchLinearScans) {
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(100, 3));
+	if (!skeletonData) return;
+	{
+		Skeleton skeleton(skeletonData);
+		Vector<BoneData *> &bones = skeletonData->getBones();
+		for (size_t i = 0; i < bones.size(); i++) {
+			const String &name = bones[i]->getName();
+			SPINE_CHECK(skeletonData->findBone(name.buffer()) == ContainerUtil::findWithName(bones, name));
+			SPINE_CHECK(skeleton.findBone(name.buffer()) == skeleton.getBones()[i]);
+		}
+		Vector<SlotData *> &slots = skeletonData->getSlots();
+		for (size_t i = 0; i < slots.size(); i++) {
+			const String &name = slots[i]->getName();
+			SPINE_CHECK(skeletonData->findSlot(name.buffer()) == ContainerUtil::findWithName(slots, name));
+			SPINE_CHECK(skeleton.findSlot(name.buffer()) == skeleton.getSlots()[i]);
+		}
+		Vector<Animation *> &animations = skeletonData->getAnimations();
+		for (size_t i = 0; i < animations.size(); i++)
+			SPINE_CHECK(skeletonData->findAnimation(animations[i]->getName()) == animations[i]);
+		SPINE_CHECK(skeletonData->findSkin("default") == skeletonData->getDefaultSkin());
+
+		SPINE_CHECK(skeletonData->findBone("b100") == NULL);
+		SPINE_CHECK(skeletonData->findBone("b") == NULL);
+		SPINE_CHECK(skeletonData->findSlot("b0") == NULL);
+		SPINE_CHECK(skeletonData->findAnimation("animation") == NULL);
+		SPINE_CHECK(skeleton.findBone("missing") == NULL);
+	}
+	delete skeletonData;
+}
+
+SPINE_TEST(duplicateNamesFindTheFirstItem) {
+	Vector<BoneData *> bones;
+	for (int i = 0; i < 40; i++) {
+		char name[32];
+		snprintf(name, sizeof(name), "b%d", i % 10);
+		bones.add(new BoneData(i, name, NULL));
+	}
+	NameIndex index;
+	index.update(bones);
+	for (int i = 0; i < 10; i++) {
+		char name[32];
+		snprintf(name, sizeof(name), "b%d", i);
+		SPINE_CHECK(index.find(bones, name) == i);
+	}
+	SPINE_CHECK(index.find(bones, "b10") == -1);
+	for (size_t i = 0; i < bones.size(); i++) delete bones[i];
+}
+
+SPINE_TEST(staleIndexFallsBackToLinearScan) {
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(10, 0));
+	if (!skeletonData) return;
+	BoneData *added = new BoneData(10, "added", skeletonData->getBones()[0]);
+	skeletonData->getBones().add(added);
+	SPINE_CHECK(skeletonData->findBone("added") == added);
+	SPINE_CHECK(skeletonData->findBone("b9") == skeletonData->getBones()[9]);
+	skeletonData->updateNameIndices();
+	SPINE_CHECK(skeletonData->findBone("added") == added);
+	delete skeletonData;
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace spine;
+using namespace spine::test;
+
+static float random(float range) {
+	return (rand() / (float) RAND_MAX - 0.5f) * 2 * range;
+}
+
+static SkeletonData *makeRig(int boneCount, bool mixedTransformModes) {
+	SkeletonData *skeletonData = new SkeletonData();
+	for (int i = 0; i < boneCount; i++) {
+		char name[32];
+		snprintf(name, sizeof(name), "b%d", i);
+		BoneData *parent = i ? skeletonData->getBones()[rand() % i] : NULL;
+		BoneData *bone = new BoneData(i, name, parent);
+		bone->setX(random(50));
+		bone->setY(random(50));
+		bone->setRotation(random(180));
+		bone->setScaleX(1 + random(0.5f));
+		bone->setScaleY(1 + random(0.5f));
+		bone->setShearX(random(10));
+		bone->setShearY(random(10));
+		if (mixedTransformModes && rand() % 10 == 0) bone->setTransformMode((TransformMode) (1 + rand() % 4));
+		skeletonData->getBones().add(bone);
+	}
+	return skeletonData;
+}
+
+// Measures Skeleton::updateWorldTransform for many instances of a 150 bone rig, per bone objects against the pose
+// buffer.
+int main(int argc, char **argv) {
+	srand(3);
+	const int boneCount = 150;
+	const int instanceCount = 300;
+	const int frames = isQuick(argc, argv) ? 2 : 200;
+	SkeletonData *skeletonData = makeRig(boneCount, false);
+
+	Vector<Skeleton *> skeletons[2];
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = 0; i < instanceCount; i++) {
+			Skeleton *skeleton = new Skeleton(skeletonData);
+			skeleton->setUsePoseBuffer(pass == 1);
+			for (int b = 0; b < boneCount; b++) skeleton->getBones()[b]->setRotation(random(90));
+			skeletons[pass].add(skeleton);
+		}
+	}
+
+	double milliseconds[2];
+	for (int pass = 0; pass < 2; pass++) {
+		Timer timer;
+		for (int frame = 0; frame < frames; frame++)
+			for (int i = 0; i < instanceCount; i++) skeletons[pass][i]->updateWorldTransform();
+		milliseconds[pass] = timer.getMilliseconds() / frames;
+	}
+
+	printf("Skeleton::updateWorldTransform, %d bones x %d instances\n", boneCount, instanceCount);
+	printf("  per bone objects: %.3f ms/frame\n", milliseconds[0]);
+	printf("  pose buffer:      %.3f ms/frame (%.2fx)\n", milliseconds[1], milliseconds[0] / milliseconds[1]);
+	for (int pass = 0; pass < 2; pass++)
+		for (int i = 0; i < instanceCount; i++) delete skeletons[pass][i];
+	delete skeletonData;
+	return 0;
+}
@@ -0,0 +1,163 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace spine;
+using namespace spine::test;
+
+static float random(float range) {
+	return (rand() / (float) RAND_MAX - 0.5f) * 2 * range;
+}
+
+static void checkSamePose(Skeleton &expected, Skeleton &actual) {
+	for (size_t i = 0; i < expected.getBones().size(); i++) {
+		Bone *a = expected.getBones()[i], *b = actual.getBones()[i];
+		SPINE_CHECK_NEAR(a->getA(), b->getA(), 1e-4f);
+		SPINE_CHECK_NEAR(a->getB(), b->getB(), 1e-4f);
+		SPINE_CHECK_NEAR(a->getC(), b->getC(), 1e-4f);
+		SPINE_CHECK_NEAR(a->getD(), b->getD(), 1e-4f);
+		SPINE_CHECK_NEAR(a->getWorldX(), b->getWorldX(), 1e-2f);
+		SPINE_CHECK_NEAR(a->getWorldY(), b->getWorldY(), 1e-2f);
+	}
+}
+
+SPINE_TEST(poseBufferMatchesBonesForEveryTransformMode) {
+	srand(3);
+	SkeletonData *skeletonData = new SkeletonData();
+	for (int i = 0; i < 150; i++) {
+		char name[32];
+		snprintf(name, sizeof(name), "b%d", i);
+		BoneData *bone = new BoneData(i, name, i ? skeletonData->getBones()[rand() % i] : NULL);
+		bone->setX(random(50));
+		bone->setY(random(50));
+		bone->setRotation(random(180));
+		bone->setScaleX(1 + random(0.5f));
+		bone->setScaleY(i % 13 == 0 ? -1 : 1 + random(0.5f));
+		bone->setShearX(random(10));
+		bone->setShearY(random(10));
+		bone->setTransformMode((TransformMode) (i % 5));
+		skeletonData->getBones().add(bone);
+	}
+	{
+		Skeleton bones(skeletonData), buffer(skeletonData);
+		buffer.setUsePoseBuffer(true);
+		for (int frame = 0; frame < 10; frame++) {
+			for (size_t i = 0; i < bones.getBones().size(); i++) {
+				float rotation = random(90);
+				bones.getBones()[i]->setRotation(rotation);
+				buffer.getBones()[i]->setRotation(rotation);
+			}
+			if (frame == 5) {
+				bones.setScaleX(-1);
+				buffer.setScaleX(-1);
+			}
+			bones.updateWorldTransform();
+			buffer.updateWorldTransform();
+			checkSamePose(bones, buffer);
+		}
+	}
+	delete skeletonData;
+}
+
+// IK and transform constraints sit between bones in the update cache, so the pose buffer must flush and reload around
+// them in the same order.
+SPINE_TEST(poseBufferInterleavesConstraints) {
+	const char *json = "{\"skeleton\":{\"spine\":\"4.0.64\"},\"bones\":["
+					   "{\"name\":\"root\"},"
+					   "{\"name\":\"upper\",\"parent\":\"root\",\"length\":40,\"rotation\":30},"
+					   "{\"name\":\"lower\",\"parent\":\"upper\",\"length\":40,\"x\":40,\"rotation\":-20},"
+					   "{\"name\":\"hand\",\"parent\":\"lower\",\"x\":40},"
+					   "{\"name\":\"target\",\"parent\":\"root\",\"x\":50,\"y\":30},"
+					   "{\"name\":\"follower\",\"parent\":\"root\",\"x\":-10},"
+					   "{\"name\":\"child\",\"parent\":\"follower\",\"x\":10,\"rotation\":45}],"
+					   "\"ik\":[{\"name\":\"arm\",\"bones\":[\"upper\",\"lower\"],\"target\":\"target\",\"mix\":0.8}],"
+					   "\"transform\":[{\"name\":\"follow\",\"order\":1,\"bones\":[\"follower\"],\"target\":\"hand\","
+					   "\"rotation\":10,\"mixRotate\":0.5,\"mixX\":0.7,\"mixScaleX\":0.3}],"
+					   "\"animations\":{\"move\":{\"bones\":{\"target\":{\"translate\":[{\"x\":-20},{\"time\":1,\"x\":20,\"y\":-40}]}}}}}";
+	SkeletonData *skeletonData = readSkeletonJson(json);
+	if (!skeletonData) return;
+	{
+		Skeleton bones(skeletonData), buffer(skeletonData);
+		buffer.setUsePoseBuffer(true);
+		Animation *animation = skeletonData->getAnimations()[0];
+		for (int frame = 0; frame <= 10; frame++) {
+			animation->apply(bones, 0, frame * 0.1f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			animation->apply(buffer, 0, frame * 0.1f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			bones.updateWorldTransform();
+			buffer.updateWorldTransform();
+			checkSamePose(bones, buffer);
+		}
+	}
+	delete skeletonData;
+}
+
+SPINE_TEST(poseVersionChangesOnlyWithComparedPoses) {
+	const char *json = "{\"skeleton\":{\"spine\":\"4.0.64\"},\"bones\":["
+					   "{\"name\":\"root\"},"
+					   "{\"name\":\"arm\",\"parent\":\"root\",\"length\":40,\"rotation\":30}],"
+					   "\"slots\":[{\"name\":\"arm\",\"bone\":\"arm\"}],"
+					   "\"animations\":{\"wave\":{\"bones\":{\"arm\":{\"rotate\":[{\"value\":0},{\"time\":1,\"value\":90}]}}}}}";
+	SkeletonData *skeletonData = readSkeletonJson(json);
+	if (!skeletonData) return;
+	{
+		Skeleton skeleton(skeletonData);
+		Animation *animation = skeletonData->getAnimations()[0];
+		skeleton.updateWorldTransform();
+		size_t version = skeleton.getPoseVersion();
+		skeleton.updateWorldTransform();
+		SPINE_CHECK(skeleton.getPoseVersion() != version);
+
+		skeleton.setComparePoses(true);
+		skeleton.updateWorldTransform();
+		version = skeleton.getPoseVersion();
+		animation->apply(skeleton, 0, 0.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton.updateWorldTransform();
+		SPINE_CHECK(skeleton.getPoseVersion() != version);
+
+		version = skeleton.getPoseVersion();
+		animation->apply(skeleton, 0, 0.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton.updateWorldTransform();
+		SPINE_CHECK(skeleton.getPoseVersion() == version);
+
+		skeleton.getSlots()[0]->getColor().a = 0.5f;
+		skeleton.updateWorldTransform();
+		SPINE_CHECK(skeleton.getPoseVersion() != version);
+
+		version = skeleton.getPoseVersion();
+		skeleton.setComparePoses(false);
+		skeleton.setComparePoses(true);
+		skeleton.updateWorldTransform();
+		SPINE_CHECK(skeleton.getPoseVersion() != version);
+	}
+	delete skeletonData;
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace spine;
+using namespace spine::test;
+
+// The class name comparison RTTI used before identities, kept here to measure against.
+static bool isExactlyByName(const RTTI &rtti, const RTTI &other) {
+	return !strcmp(rtti.getClassName(), other.getClassName());
+}
+
+static bool isExactlyByIdentity(const RTTI &rtti, const RTTI &other) {
+	return rtti.isExactly(other);
+}
+
+// The per slot dispatch of USpineSkeletonRendererComponent::UpdateMesh: skip unsupported attachments, then branch on the
+// attachment type.
+template<bool (*isExactly)(const RTTI &, const RTTI &)>
+static int dispatch(Skeleton &skeleton) {
+	int meshes = 0;
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++) {
+		Attachment *attachment = drawOrder[i]->getAttachment();
+		if (!attachment) continue;
+		const RTTI &rtti = attachment->getRTTI();
+		if (!isExactly(rtti, RegionAttachment::rtti) && !isExactly(rtti, MeshAttachment::rtti) &&
+			!isExactly(rtti, ClippingAttachment::rtti))
+			continue;
+		if (isExactly(rtti, RegionAttachment::rtti)) meshes += 1;
+		else if (isExactly(rtti, MeshAttachment::rtti)) meshes += 2;
+	}
+	return meshes;
+}
+
+int main(int argc, char **argv) {
+	const int slotCount = 400;
+	const int frames = isQuick(argc, argv) ? 10 : 20000;
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(slotCount, 1));
+	if (!skeletonData) return 1;
+	Skeleton *skeleton = new Skeleton(skeletonData);
+
+	int checksum = 0;
+	Timer byName;
+	for (int i = 0; i < frames; i++) checksum += dispatch<isExactlyByName>(*skeleton);
+	double byNameMs = byName.getMilliseconds();
+
+	Timer byIdentity;
+	for (int i = 0; i < frames; i++) checksum -= dispatch<isExactlyByIdentity>(*skeleton);
+	double byIdentityMs = byIdentity.getMilliseconds();
+
+	double slots = (double) slotCount * frames;
+	printf("RTTI dispatch, %d slots x %d frames\n", slotCount, frames);
+	printf("  class name strcmp: %.2f ns/slot\n", byNameMs * 1e6 / slots);
+	printf("  identity compare:  %.2f ns/slot\n", byIdentityMs * 1e6 / slots);
+	delete skeleton;
+	delete skeletonData;
+	return checksum == 0 ? 0 : 1;
+}
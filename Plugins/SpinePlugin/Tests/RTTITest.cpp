@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+using namespace spine;
+
+SPINE_TEST(isExactlyMatchesOnlyTheSameClass) {
+	RegionAttachment region("region");
+	MeshAttachment mesh("mesh");
+	SPINE_CHECK(region.getRTTI().isExactly(RegionAttachment::rtti));
+	SPINE_CHECK(!region.getRTTI().isExactly(Attachment::rtti));
+	SPINE_CHECK(!region.getRTTI().isExactly(MeshAttachment::rtti));
+	SPINE_CHECK(mesh.getRTTI().isExactly(MeshAttachment::rtti));
+	SPINE_CHECK(!mesh.getRTTI().isExactly(VertexAttachment::rtti));
+}
+
+SPINE_TEST(instanceOfWalksTheParentChain) {
+	MeshAttachment mesh("mesh");
+	ClippingAttachment clipping("clipping");
+	SPINE_CHECK(mesh.getRTTI().instanceOf(MeshAttachment::rtti));
+	SPINE_CHECK(mesh.getRTTI().instanceOf(VertexAttachment::rtti));
+	SPINE_CHECK(mesh.getRTTI().instanceOf(Attachment::rtti));
+	SPINE_CHECK(!mesh.getRTTI().instanceOf(RegionAttachment::rtti));
+	SPINE_CHECK(!mesh.getRTTI().instanceOf(ClippingAttachment::rtti));
+	SPINE_CHECK(clipping.getRTTI().instanceOf(VertexAttachment::rtti));
+	SPINE_CHECK(!VertexAttachment::rtti.instanceOf(MeshAttachment::rtti));
+
+	RotateTimeline rotate(1, 0, 0);
+	TranslateTimeline translate(1, 0, 0);
+	SPINE_CHECK(rotate.getRTTI().instanceOf(CurveTimeline1::rtti));
+	SPINE_CHECK(rotate.getRTTI().instanceOf(CurveTimeline::rtti));
+	SPINE_CHECK(rotate.getRTTI().instanceOf(Timeline::rtti));
+	SPINE_CHECK(!translate.getRTTI().instanceOf(CurveTimeline1::rtti));
+	SPINE_CHECK(translate.getRTTI().instanceOf(CurveTimeline2::rtti));
+}
+
+SPINE_TEST(classNamesAreKept) {
+	SPINE_CHECK(String(RegionAttachment::rtti.getClassName()) == "RegionAttachment");
+	SPINE_CHECK(String(DeformTimeline::rtti.getClassName()) == "DeformTimeline");
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+using namespace spine;
+using namespace spine::test;
+
+// timelines.skel has every timeline type, with linear, stepped and bezier curves, and events with audio.
+static SkeletonData *readLazy(const std::string &binary, String &error) {
+	TestAttachmentLoader loader;
+	SkeletonBinary reader(&loader);
+	reader.setLazyAnimations(true);
+	SkeletonData *skeletonData = reader.readSkeletonData((const unsigned char *) binary.data(), (int) binary.size());
+	error = reader.getError();
+	return skeletonData;
+}
+
+static void checkSamePose(Skeleton &actual, Skeleton &expected) {
+	for (size_t i = 0; i < actual.getBones().size(); i++) {
+		Bone &a = *actual.getBones()[i], &e = *expected.getBones()[i];
+		SPINE_CHECK(a.getWorldX() == e.getWorldX() && a.getWorldY() == e.getWorldY());
+		SPINE_CHECK(a.getA() == e.getA() && a.getB() == e.getB() && a.getC() == e.getC() && a.getD() == e.getD());
+	}
+	for (size_t i = 0; i < actual.getSlots().size(); i++) {
+		Slot &a = *actual.getSlots()[i], &e = *expected.getSlots()[i];
+		SPINE_CHECK((a.getAttachment() == NULL) == (e.getAttachment() == NULL));
+		SPINE_CHECK(a.getColor().r == e.getColor().r && a.getColor().a == e.getColor().a);
+		SPINE_CHECK(a.getDarkColor().g == e.getDarkColor().g);
+		SPINE_CHECK(a.getDeform().size() == e.getDeform().size());
+		for (size_t ii = 0; ii < a.getDeform().size() && ii < e.getDeform().size(); ii++)
+			SPINE_CHECK(a.getDeform()[ii] == e.getDeform()[ii]);
+	}
+	for (size_t i = 0; i < actual.getDrawOrder().size(); i++)
+		SPINE_CHECK(actual.getDrawOrder()[i]->getData().getIndex() == expected.getDrawOrder()[i]->getData().getIndex());
+}
+
+SPINE_TEST(lazyAnimationsMatchEagerAnimations) {
+	std::string binary = readDataFile("timelines.skel");
+	SPINE_CHECK(!binary.empty());
+	SkeletonData *eagerData = readSkeletonBinary(binary);
+	String error;
+	SkeletonData *lazyData = readLazy(binary, error);
+	if (!lazyData) fail(__FILE__, __LINE__, error.buffer());
+	if (!eagerData || !lazyData) {
+		delete lazyData;
+		delete eagerData;
+		return;
+	}
+
+	{
+		Skeleton eager(eagerData), lazy(lazyData);
+		SPINE_CHECK(lazyData->getAnimations().size() == eagerData->getAnimations().size());
+		for (size_t i = 0; i < eagerData->getAnimations().size(); i++) {
+			Animation *expected = eagerData->getAnimations()[i];
+			Animation *animation = lazyData->findAnimation(expected->getName());
+			SPINE_CHECK(animation && animation->isLoaded());
+			if (!animation) continue;
+			SPINE_CHECK(animation->getDuration() == expected->getDuration());
+			SPINE_CHECK(animation->getTimelines().size() == expected->getTimelines().size());
+
+			for (float time = 0; time <= expected->getDuration() + 0.1f; time += 0.05f) {
+				eager.setToSetupPose();
+				lazy.setToSetupPose();
+				expected->apply(eager, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				animation->apply(lazy, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				eager.updateWorldTransform();
+				lazy.updateWorldTransform();
+				checkSamePose(lazy, eager);
+			}
+		}
+	}
+	delete lazyData;
+	delete eagerData;
+}
+
+SPINE_TEST(lazyAnimationsRejectTruncatedData) {
+	std::string binary = readDataFile("timelines.skel");
+	// Everything before the animations is read without bounds checks, only the animations are truncated. The first
+	// animation starts with its name, prefixed by its length plus one.
+	size_t animationsStart = binary.find("anim0") - 1;
+	SPINE_CHECK(animationsStart < binary.size());
+	for (size_t length = animationsStart; length < binary.size(); length++) {
+		// A copy of its own, so reading past the end of the prefix is caught by the address sanitizer.
+		std::string prefix = binary.substr(0, length);
+		String error;
+		SkeletonData *skeletonData = readLazy(prefix, error);
+		SPINE_CHECK(!skeletonData);
+		SPINE_CHECK(!error.isEmpty());
+		delete skeletonData;
+	}
+}
@@ -0,0 +1,268 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <string.h>
+
+using namespace spine;
+using namespace spine::test;
+
+static SkeletonData *readCooked(Vector<unsigned char> &cooked, bool useArena, String &error) {
+	TestAttachmentLoader loader;
+	SkeletonCooked reader(&loader);
+	reader.setUseArena(useArena);
+	SkeletonData *skeletonData = reader.readSkeletonData(cooked.buffer(), (int) cooked.size());
+	error = reader.getError();
+	return skeletonData;
+}
+
+static void checkSamePose(Skeleton &actual, Skeleton &expected) {
+	for (size_t i = 0; i < actual.getBones().size(); i++) {
+		Bone &a = *actual.getBones()[i], &e = *expected.getBones()[i];
+		SPINE_CHECK(a.getWorldX() == e.getWorldX() && a.getWorldY() == e.getWorldY());
+		SPINE_CHECK(a.getA() == e.getA() && a.getB() == e.getB() && a.getC() == e.getC() && a.getD() == e.getD());
+	}
+	for (size_t i = 0; i < actual.getSlots().size(); i++) {
+		Slot &a = *actual.getSlots()[i], &e = *expected.getSlots()[i];
+		SPINE_CHECK((a.getAttachment() == NULL) == (e.getAttachment() == NULL));
+		if (a.getAttachment() && e.getAttachment())
+			SPINE_CHECK(a.getAttachment()->getName() == e.getAttachment()->getName());
+		SPINE_CHECK(a.getColor().r == e.getColor().r && a.getColor().a == e.getColor().a);
+		SPINE_CHECK(a.getDarkColor().g == e.getDarkColor().g);
+		SPINE_CHECK(a.getDeform().size() == e.getDeform().size());
+		for (size_t ii = 0; ii < a.getDeform().size() && ii < e.getDeform().size(); ii++)
+			SPINE_CHECK(a.getDeform()[ii] == e.getDeform()[ii]);
+	}
+	for (size_t i = 0; i < actual.getDrawOrder().size(); i++)
+		SPINE_CHECK(actual.getDrawOrder()[i]->getData().getIndex() == expected.getDrawOrder()[i]->getData().getIndex());
+}
+
+// Cooks the parsed data, reads it back and checks it is the same: cooking it again writes the same bytes, and every
+// animation poses a skeleton the same way.
+static void checkRoundTrip(SkeletonData *parsedData) {
+	if (!parsedData) return;
+	Vector<unsigned char> cooked;
+	SkeletonCooked::writeSkeletonData(*parsedData, cooked);
+	SPINE_CHECK(SkeletonCooked::isCooked(cooked.buffer(), (int) cooked.size()));
+	String error;
+	SkeletonData *cookedData = readCooked(cooked, false, error);
+	if (!cookedData) {
+		fail(__FILE__, __LINE__, error.buffer());
+		return;
+	}
+
+	Vector<unsigned char> recooked;
+	SkeletonCooked::writeSkeletonData(*cookedData, recooked);
+	SPINE_CHECK(recooked.size() == cooked.size());
+	SPINE_CHECK(recooked.size() == cooked.size() && memcmp(recooked.buffer(), cooked.buffer(), cooked.size()) == 0);
+
+	SPINE_CHECK(cookedData->getBones().size() == parsedData->getBones().size());
+	SPINE_CHECK(cookedData->getSlots().size() == parsedData->getSlots().size());
+	SPINE_CHECK(cookedData->getSkins().size() == parsedData->getSkins().size());
+	SPINE_CHECK(cookedData->getAnimations().size() == parsedData->getAnimations().size());
+	{
+		Skeleton parsed(parsedData), cooked(cookedData);
+		for (size_t i = 0; i < parsedData->getAnimations().size(); i++) {
+			Animation *expected = parsedData->getAnimations()[i];
+			Animation *animation = cookedData->findAnimation(expected->getName());
+			SPINE_CHECK(animation && animation->getDuration() == expected->getDuration());
+			if (!animation) continue;
+			for (float time = 0; time <= expected->getDuration() + 0.1f; time += 0.05f) {
+				parsed.setToSetupPose();
+				cooked.setToSetupPose();
+				expected->apply(parsed, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				animation->apply(cooked, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				parsed.updateWorldTransform();
+				cooked.updateWorldTransform();
+				checkSamePose(cooked, parsed);
+			}
+		}
+	}
+	delete cookedData;
+}
+
+// timelines.skel and timelines.json are the same skeleton, with every timeline type and attachment type.
+SPINE_TEST(cookedBinaryMatchesParsedBinary) {
+	SkeletonData *skeletonData = readSkeletonBinary(readDataFile("timelines.skel"));
+	checkRoundTrip(skeletonData);
+	delete skeletonData;
+}
+
+SPINE_TEST(cookedJsonMatchesParsedJson) {
+	SkeletonData *skeletonData = readSkeletonJson(readDataFile("timelines.json"));
+	checkRoundTrip(skeletonData);
+	delete skeletonData;
+}
+
+SPINE_TEST(cookedArenaBytesAreBounded) {
+	TestAttachmentLoader loader;
+	SkeletonBinary reader(&loader);
+	reader.setUseArena(true);
+	std::string binary = readDataFile("timelines.skel");
+	SkeletonData *parsedData = reader.readSkeletonData((const unsigned char *) binary.data(), (int) binary.size());
+	if (!parsedData) {
+		fail(__FILE__, __LINE__, reader.getError().buffer());
+		return;
+	}
+	Vector<unsigned char> cooked;
+	SkeletonCooked::writeSkeletonData(*parsedData, cooked);
+	size_t usedBytes = parsedData->getArena().getUsedBytes();
+	delete parsedData;
+
+	// The recorded size is reserved as is, so the data is read into a single block.
+	String error;
+	SkeletonData *skeletonData = readCooked(cooked, true, error);
+	SPINE_CHECK(skeletonData != NULL);
+	if (skeletonData) {
+		SPINE_CHECK(skeletonData->getArena().getBlockCount() == 1);
+		SPINE_CHECK(skeletonData->getArena().getUsedBytes() <= usedBytes);
+	}
+	delete skeletonData;
+
+	// The arena size follows the header: magic, version, byte order and layout. A corrupt size is only a hint.
+	int arenaBytes = 0x7fffffff;
+	memcpy(cooked.buffer() + 16, &arenaBytes, sizeof(int));
+	skeletonData = readCooked(cooked, true, error);
+	SPINE_CHECK(skeletonData != NULL);
+	if (skeletonData) SPINE_CHECK(skeletonData->getArena().getBlockBytes() < cooked.size() * 17);
+	delete skeletonData;
+}
+
+SPINE_TEST(cookedRejectsTruncatedAndForeignData) {
+	SkeletonData *parsedData = readSkeletonBinary(readDataFile("timelines.skel"));
+	if (!parsedData) return;
+	Vector<unsigned char> cooked;
+	SkeletonCooked::writeSkeletonData(*parsedData, cooked);
+	delete parsedData;
+
+	// Every header field is checked: the version, byte order and type sizes.
+	for (size_t offset = 4; offset < 16; offset += 4) {
+		Vector<unsigned char> changed;
+		changed.addAll(cooked);
+		changed[offset] ^= 0x40;
+		SPINE_CHECK(!SkeletonCooked::isCooked(changed.buffer(), (int) changed.size()));
+		String error;
+		SkeletonData *skeletonData = readCooked(changed, false, error);
+		SPINE_CHECK(!skeletonData && !error.isEmpty());
+		delete skeletonData;
+	}
+
+	// Each prefix is a copy of its own, so reading past its end is caught by the address sanitizer.
+	for (size_t length = 0; length < cooked.size(); length += length < 64 ? 1 : 61) {
+		Vector<unsigned char> prefix;
+		prefix.setSize(length, 0);
+		if (length) memcpy(prefix.buffer(), cooked.buffer(), length);
+		String error;
+		SkeletonData *skeletonData = readCooked(prefix, false, error);
+		SPINE_CHECK(!skeletonData && !error.isEmpty());
+		delete skeletonData;
+	}
+}
+
+
+static bool readsCooked(SkeletonData &skeletonData) {
+	Vector<unsigned char> cooked;
+	SkeletonCooked::writeSkeletonData(skeletonData, cooked);
+	String error;
+	SkeletonData *cookedData = readCooked(cooked, false, error);
+	delete cookedData;
+	return cookedData != NULL;
+}
+
+static VertexAttachment *findWeightedAttachment(SkeletonData *skeletonData) {
+	for (size_t i = 0; i < skeletonData->getSkins().size(); i++) {
+		Skin::AttachmentMap::Entries entries = skeletonData->getSkins()[i]->getAttachments();
+		while (entries.hasNext()) {
+			Attachment *attachment = entries.next()._attachment;
+			if (!attachment->getRTTI().instanceOf(VertexAttachment::rtti)) continue;
+			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+			if (vertexAttachment->getBones().size() > 0) return vertexAttachment;
+		}
+	}
+	return NULL;
+}
+
+// CurveTimeline::BEZIER, the curve type of a bezier is this plus the bezier's offset in the curves.
+static const float BEZIER_TYPE = 2;
+
+static CurveTimeline *findBezierTimeline(SkeletonData *skeletonData, size_t &frame) {
+	for (size_t i = 0; i < skeletonData->getAnimations().size(); i++) {
+		Vector<Timeline *> &timelines = skeletonData->getAnimations()[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+			CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[ii]);
+			for (frame = 0; frame + 1 < timeline->getFrameCount(); frame++)
+				if (timeline->getCurves()[frame] >= BEZIER_TYPE) return timeline;
+		}
+	}
+	return NULL;
+}
+
+// The skinning layout and the curves are used without range checks when posing, so the reader checks them instead.
+SPINE_TEST(cookedRejectsIndicesOutOfRange) {
+	SkeletonData *skeletonData = readSkeletonBinary(readDataFile("timelines.skel"));
+	if (!skeletonData) return;
+	SPINE_CHECK(readsCooked(*skeletonData));
+
+	VertexAttachment *attachment = findWeightedAttachment(skeletonData);
+	SPINE_CHECK(attachment != NULL);
+	if (attachment) {
+		// The first vertex's first bone, also gathered into the skin bones.
+		size_t &bone = attachment->getBones()[1], original = bone;
+		bone = skeletonData->getBones().size();
+		attachment->updateSkinning();
+		SPINE_CHECK(!readsCooked(*skeletonData));
+		bone = original;
+		attachment->updateSkinning();
+		SPINE_CHECK(readsCooked(*skeletonData));
+	}
+
+	size_t frame = 0;
+	CurveTimeline *timeline = findBezierTimeline(skeletonData, frame);
+	SPINE_CHECK(timeline != NULL);
+	if (timeline) {
+		Vector<float> &curves = timeline->getCurves();
+		float original = curves[frame];
+		// Past the end of the beziers, not on a bezier, and not a whole number.
+		const float types[] = {(float) curves.size() + BEZIER_TYPE, original + 1, original + 0.5f, -1};
+		for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+			curves[frame] = types[i];
+			SPINE_CHECK(!readsCooked(*skeletonData));
+		}
+		curves[frame] = original;
+		// The last frame has no next frame to interpolate to.
+		size_t last = timeline->getFrameCount() - 1;
+		timeline->setLinear(last);
+		SPINE_CHECK(!readsCooked(*skeletonData));
+		timeline->setStepped(last);
+		SPINE_CHECK(readsCooked(*skeletonData));
+	}
+	delete skeletonData;
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SkinningFixture.h"
+
+using namespace spine;
+using namespace spine::test;
+
+// Measures weighted skinning throughput in vertices per second, the per vertex reference against the weight count
+// bucketed layout, with and without deform offsets.
+int main(int argc, char **argv) {
+	const int iterations = isQuick(argc, argv) ? 2 : 2000;
+	SkinningFixture fixture(40, 2000);
+	size_t length = fixture.vertexCount * 2;
+	Vector<float> worldVertices;
+	worldVertices.setSize(length, 0);
+
+	printf("Weighted skinning, %d vertices, %d weights\n", fixture.vertexCount, fixture.weightCount);
+	for (int deform = 0; deform < 2; deform++) {
+		if (deform) fixture.setRandomDeform();
+		double rates[2];
+		for (int pass = 0; pass < 2; pass++) {
+			Timer timer;
+			for (int i = 0; i < iterations; i++) {
+				if (pass)
+					fixture.mesh->computeWorldVertices(fixture.getSlot(), 0, length, worldVertices.buffer(), 0, 2);
+				else
+					computeReferenceWorldVertices(*fixture.mesh, fixture.getSlot(), 0, length, worldVertices.buffer(), 0, 2);
+			}
+			rates[pass] = fixture.vertexCount * (double) iterations / timer.getMilliseconds() / 1000;
+		}
+		printf("  %s: reference %.1f Mvert/s, layout %.1f Mvert/s (%.2fx)\n", deform ? "deformed" : "plain   ", rates[0],
+			   rates[1], rates[1] / rates[0]);
+	}
+	return 0;
+}
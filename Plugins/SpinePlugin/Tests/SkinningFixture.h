@@ -0,0 +1,136 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkinningFixture_h
+#define Spine_SkinningFixture_h
+
+#include "SpineTest.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace spine {
+	namespace test {
+		/// A skeleton with random bones and one slot, and a mesh of random weighted vertices for it. Most vertices have
+		/// 1-4 weights, as in production rigs, the rest up to 7.
+		struct SkinningFixture {
+			SkeletonData *skeletonData;
+			Skeleton *skeleton;
+			MeshAttachment *mesh;
+			int vertexCount;
+			int weightCount;
+
+			SkinningFixture(int boneCount, int vertexCount) : vertexCount(vertexCount), weightCount(0) {
+				srand(5);
+				skeletonData = new SkeletonData();
+				for (int i = 0; i < boneCount; i++) {
+					char name[32];
+					snprintf(name, sizeof(name), "b%d", i);
+					BoneData *bone = new BoneData(i, name, i ? skeletonData->getBones()[rand() % i] : NULL);
+					bone->setX(random(50));
+					bone->setY(random(50));
+					bone->setRotation(random(180));
+					bone->setScaleX(1 + random(0.5f));
+					skeletonData->getBones().add(bone);
+				}
+				skeletonData->getSlots().add(new SlotData(0, "slot", *skeletonData->getBones()[0]));
+				skeleton = new Skeleton(skeletonData);
+				skeleton->updateWorldTransform();
+
+				mesh = new MeshAttachment("mesh");
+				for (int i = 0; i < vertexCount; i++) {
+					int weights = 1 + (rand() % 10 < 8 ? rand() % 4 : rand() % 7);
+					mesh->getBones().add(weights);
+					for (int j = 0; j < weights; j++) {
+						mesh->getBones().add(rand() % boneCount);
+						mesh->getVertices().add(random(100));
+						mesh->getVertices().add(random(100));
+						mesh->getVertices().add(rand() / (float) RAND_MAX);
+						weightCount++;
+					}
+				}
+				mesh->setWorldVerticesLength(vertexCount * 2);
+				mesh->updateSkinning();
+			}
+
+			~SkinningFixture() {
+				delete mesh;
+				delete skeleton;
+				delete skeletonData;
+			}
+
+			Slot &getSlot() {
+				return *skeleton->getSlots()[0];
+			}
+
+			void setRandomDeform() {
+				Vector<float> &deform = getSlot().getDeform();
+				deform.setSize(weightCount * 2, 0);
+				for (int i = 0; i < weightCount * 2; i++) deform[i] = random(5);
+			}
+
+			static float random(float range) {
+				return (rand() / (float) RAND_MAX - 0.5f) * 2 * range;
+			}
+		};
+
+		/// The per vertex weighted path VertexAttachment::computeWorldVertices used before the skinning layout.
+		inline void computeReferenceWorldVertices(VertexAttachment &attachment, Slot &slot, size_t start, size_t count,
+												  float *worldVertices, size_t offset, size_t stride) {
+			count = offset + (count >> 1) * stride;
+			Vector<Bone *> &skeletonBones = slot.getBone().getSkeleton().getBones();
+			Vector<size_t> &bones = attachment.getBones();
+			Vector<float> &vertices = attachment.getVertices();
+			Vector<float> &deform = slot.getDeform();
+			size_t v = 0, skip = 0;
+			for (size_t i = 0; i < start; i += 2) {
+				size_t n = bones[v];
+				v += n + 1;
+				skip += n;
+			}
+			for (size_t w = offset, b = skip * 3, f = skip << 1; w < count; w += stride) {
+				float wx = 0, wy = 0;
+				size_t n = bones[v++];
+				n += v;
+				for (; v < n; v++, b += 3, f += 2) {
+					Bone &bone = *skeletonBones[bones[v]];
+					float vx = vertices[b] + (deform.size() ? deform[f] : 0);
+					float vy = vertices[b + 1] + (deform.size() ? deform[f + 1] : 0);
+					float weight = vertices[b + 2];
+					wx += (vx * bone.getA() + vy * bone.getB() + bone.getWorldX()) * weight;
+					wy += (vx * bone.getC() + vy * bone.getD() + bone.getWorldY()) * weight;
+				}
+				worldVertices[w] = wx;
+				worldVertices[w + 1] = wy;
+			}
+		}
+	}
+}
+
+#endif /* Spine_SkinningFixture_h */
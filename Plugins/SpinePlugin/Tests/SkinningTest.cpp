@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SkinningFixture.h"
+
+using namespace spine;
+using namespace spine::test;
+
+static void checkMatchesReference(SkinningFixture &fixture, size_t start, size_t count, size_t offset, size_t stride) {
+	Vector<float> expected, actual;
+	size_t length = offset + count / 2 * stride;
+	expected.setSize(length, 0);
+	actual.setSize(length, 0);
+	computeReferenceWorldVertices(*fixture.mesh, fixture.getSlot(), start, count, expected.buffer(), offset, stride);
+	fixture.mesh->computeWorldVertices(fixture.getSlot(), start, count, actual.buffer(), offset, stride);
+	int mismatches = 0;
+	for (size_t i = offset; i < length; i += stride) {
+		// The kernel sums the same products in the same order, so only FMA contraction can differ.
+		float tolerance = 1e-4f * (1 + (expected[i] < 0 ? -expected[i] : expected[i]));
+		if (actual[i] - expected[i] > tolerance || expected[i] - actual[i] > tolerance) mismatches++;
+		if (actual[i + 1] - expected[i + 1] > tolerance || expected[i + 1] - actual[i + 1] > tolerance) mismatches++;
+	}
+	SPINE_CHECK(mismatches == 0);
+}
+
+SPINE_TEST(weightedVerticesMatchReference) {
+	SkinningFixture fixture(40, 2001);
+	size_t length = fixture.vertexCount * 2;
+	for (size_t stride = 2; stride <= 4; stride += 2) {
+		checkMatchesReference(fixture, 0, length, 0, stride);
+		checkMatchesReference(fixture, 0, length, 6, stride);
+	}
+}
+
+SPINE_TEST(deformedVerticesMatchReference) {
+	SkinningFixture fixture(40, 2001);
+	fixture.setRandomDeform();
+	size_t length = fixture.vertexCount * 2;
+	for (size_t stride = 2; stride <= 4; stride += 2) checkMatchesReference(fixture, 0, length, 0, stride);
+}
+
+SPINE_TEST(partialRangesMatchReference) {
+	SkinningFixture fixture(12, 50);
+	fixture.setRandomDeform();
+	checkMatchesReference(fixture, 10, 40, 0, 2);
+	checkMatchesReference(fixture, 2, 2, 0, 2);
+	checkMatchesReference(fixture, 0, 8, 0, 4);
+	checkMatchesReference(fixture, 98, 2, 4, 2);
+}
+
+SPINE_TEST(skinningFollowsBoneChanges) {
+	SkinningFixture fixture(10, 64);
+	size_t length = fixture.vertexCount * 2;
+	for (int frame = 0; frame < 5; frame++) {
+		for (size_t i = 0; i < fixture.skeleton->getBones().size(); i++)
+			fixture.skeleton->getBones()[i]->setRotation(frame * 17.0f + i);
+		fixture.skeleton->updateWorldTransform();
+		checkMatchesReference(fixture, 0, length, 0, 2);
+	}
+}
@@ -0,0 +1,191 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdio>
+
+using namespace spine;
+using namespace spine::test;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new ArenaExtension(new DefaultSpineExtension());
+}
+
+static TestCase *testCases = NULL;
+static TestCase *lastTestCase = NULL;
+static int failureCount = 0;
+
+TestCase::TestCase(const char *name, TestFunction function) : name(name), function(function), next(NULL) {
+	if (lastTestCase) lastTestCase->next = this;
+	else testCases = this;
+	lastTestCase = this;
+}
+
+TestCase *spine::test::getTestCases() {
+	return testCases;
+}
+
+void spine::test::fail(const char *file, int line, const char *message) {
+	printf("%s:%d: check failed: %s\n", file, line, message);
+	failureCount++;
+}
+
+int spine::test::getFailureCount() {
+	return failureCount;
+}
+
+RegionAttachment *TestAttachmentLoader::newRegionAttachment(Skin &skin, const String &name, const String &path) {
+	SP_UNUSED(skin);
+	SP_UNUSED(path);
+	return new (__FILE__, __LINE__) RegionAttachment(name);
+}
+
+MeshAttachment *TestAttachmentLoader::newMeshAttachment(Skin &skin, const String &name, const String &path) {
+	SP_UNUSED(skin);
+	SP_UNUSED(path);
+	return new (__FILE__, __LINE__) MeshAttachment(name);
+}
+
+BoundingBoxAttachment *TestAttachmentLoader::newBoundingBoxAttachment(Skin &skin, const String &name) {
+	SP_UNUSED(skin);
+	return new (__FILE__, __LINE__) BoundingBoxAttachment(name);
+}
+
+PathAttachment *TestAttachmentLoader::newPathAttachment(Skin &skin, const String &name) {
+	SP_UNUSED(skin);
+	return new (__FILE__, __LINE__) PathAttachment(name);
+}
+
+PointAttachment *TestAttachmentLoader::newPointAttachment(Skin &skin, const String &name) {
+	SP_UNUSED(skin);
+	return new (__FILE__, __LINE__) PointAttachment(name);
+}
+
+ClippingAttachment *TestAttachmentLoader::newClippingAttachment(Skin &skin, const String &name) {
+	SP_UNUSED(skin);
+	return new (__FILE__, __LINE__) ClippingAttachment(name);
+}
+
+void TestAttachmentLoader::configureAttachment(Attachment *attachment) {
+	SP_UNUSED(attachment);
+}
+
+std::string spine::test::readDataFile(const char *name) {
+	std::string path = std::string(SPINE_TEST_DATA) + name;
+	std::string contents;
+	FILE *file = fopen(path.c_str(), "rb");
+	if (!file) return contents;
+	char buffer[65536];
+	size_t read;
+	while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) contents.append(buffer, read);
+	fclose(file);
+	return contents;
+}
+
+std::string spine::test::makeSkeletonJson(int boneCount, int animationCount) {
+	std::string json = "{\"skeleton\":{\"spine\":\"4.0.64\"},\"bones\":[{\"name\":\"b0\"}";
+	char buffer[1024];
+	for (int i = 1; i < boneCount; i++) {
+		snprintf(buffer, sizeof(buffer), ",{\"name\":\"b%d\",\"parent\":\"b%d\",\"length\":10,\"x\":%d,\"y\":%d,\"rotation\":%d}",
+				 i, (i - 1) / 2, i % 7 + 5, i % 5 - 2, i * 37 % 360 - 180);
+		json += buffer;
+	}
+	json += "],\"slots\":[";
+	for (int i = 0; i < boneCount; i++) {
+		snprintf(buffer, sizeof(buffer), "%s{\"name\":\"s%d\",\"bone\":\"b%d\",\"attachment\":\"a%d\"}", i ? "," : "", i, i, i);
+		json += buffer;
+	}
+	json += "],\"skins\":[{\"name\":\"default\",\"attachments\":{";
+	for (int i = 0; i < boneCount; i++) {
+		if (i % 2 == 0) {
+			snprintf(buffer, sizeof(buffer), "%s\"s%d\":{\"a%d\":{\"x\":%d,\"width\":20,\"height\":10}}", i ? "," : "", i, i, i % 3);
+		} else {
+			int parent = (i - 1) / 2;
+			snprintf(buffer, sizeof(buffer),
+					 ",\"s%d\":{\"a%d\":{\"type\":\"mesh\",\"uvs\":[0,0,1,0,1,1,0,1],\"triangles\":[0,1,2,2,3,0],\"hull\":4,"
+					 "\"vertices\":[1,%d,0,0,1,2,%d,10,0,0.75,%d,12,1,0.25,2,%d,10,10,0.5,%d,11,9,0.5,1,%d,0,10,1]}}",
+					 i, i, i, i, parent, i, parent, parent);
+		}
+		json += buffer;
+	}
+	json += "}}],\"animations\":{";
+	for (int a = 0; a < animationCount; a++) {
+		snprintf(buffer, sizeof(buffer), "%s\"animation%d\":{\"bones\":{", a ? "," : "", a);
+		json += buffer;
+		for (int i = 0; i < boneCount; i++) {
+			int value = (i * 13 + a * 7) % 90;
+			snprintf(buffer, sizeof(buffer),
+					 "%s\"b%d\":{\"rotate\":[{\"value\":%d,\"curve\":[0.25,%d,0.75,%d]},{\"time\":1,\"value\":%d}],"
+					 "\"translate\":[{\"x\":0,\"y\":%d,\"curve\":[0.3,0,0.6,%d,0.3,%d,0.6,0]},{\"time\":1,\"x\":%d,\"y\":0}]}",
+					 i ? "," : "", i, value, value + 20, -value, -value, value, value, value / 2, value);
+			json += buffer;
+		}
+		json += "},\"slots\":{";
+		for (int i = 0; i < boneCount; i++) {
+			snprintf(buffer, sizeof(buffer),
+					 "%s\"s%d\":{\"rgba\":[{\"color\":\"ffffffff\",\"curve\":[0.5,1,0.5,0,0.5,1,0.5,0,0.5,1,0.5,0,0.5,1,0.5,0.5]},"
+					 "{\"time\":1,\"color\":\"%02x%02xffff\"}]}",
+					 i ? "," : "", i, (i * 29 + a) % 256, (i * 71) % 256);
+			json += buffer;
+		}
+		json += "}}";
+	}
+	json += "}}";
+	return json;
+}
+
+SkeletonData *spine::test::readSkeletonJson(const std::string &json) {
+	TestAttachmentLoader loader;
+	SkeletonJson reader(&loader);
+	SkeletonData *skeletonData = reader.readSkeletonData(json.c_str());
+	if (!skeletonData) fail(__FILE__, __LINE__, reader.getError().buffer());
+	return skeletonData;
+}
+
+SkeletonData *spine::test::readSkeletonBinary(const std::string &binary) {
+	TestAttachmentLoader loader;
+	SkeletonBinary reader(&loader);
+	SkeletonData *skeletonData = reader.readSkeletonData((const unsigned char *) binary.data(), (int) binary.size());
+	if (!skeletonData) fail(__FILE__, __LINE__, reader.getError().buffer());
+	return skeletonData;
+}
+
+Timer::Timer() : _start(std::chrono::steady_clock::now()) {
+}
+
+double Timer::getMilliseconds() const {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+}
+
+bool spine::test::isQuick(int argc, char **argv) {
+	for (int i = 1; i < argc; i++)
+		if (std::string(argv[i]) == "--quick") return true;
+	return false;
+}
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SpineTest_h
+#define Spine_SpineTest_h
+
+#include <spine/spine.h>
+
+#include <chrono>
+#include <string>
+
+namespace spine {
+	namespace test {
+		typedef void (*TestFunction)();
+
+		/// A test registered by SPINE_TEST. SpineTestMain.cpp runs them in declaration order.
+		struct TestCase {
+			TestCase(const char *name, TestFunction function);
+
+			const char *name;
+			TestFunction function;
+			TestCase *next;
+		};
+
+		TestCase *getTestCases();
+
+		/// Records a failed check. The running test continues, so one run reports every failure.
+		void fail(const char *file, int line, const char *message);
+
+		int getFailureCount();
+
+		/// Creates attachments without texture regions, so skeletons load without an atlas.
+		class TestAttachmentLoader : public AttachmentLoader {
+		public:
+			virtual RegionAttachment *newRegionAttachment(Skin &skin, const String &name, const String &path);
+
+			virtual MeshAttachment *newMeshAttachment(Skin &skin, const String &name, const String &path);
+
+			virtual BoundingBoxAttachment *newBoundingBoxAttachment(Skin &skin, const String &name);
+
+			virtual PathAttachment *newPathAttachment(Skin &skin, const String &name);
+
+			virtual PointAttachment *newPointAttachment(Skin &skin, const String &name);
+
+			virtual ClippingAttachment *newClippingAttachment(Skin &skin, const String &name);
+
+			virtual void configureAttachment(Attachment *attachment);
+		};
+
+		/// Returns the contents of a file in the data directory, or an empty string if it can't be read.
+		std::string readDataFile(const char *name);
+
+		/// Builds JSON for a rig with boneCount bones in a binary tree and one slot per bone. Even slots have a region
+		/// attachment, odd slots a 4 vertex mesh weighted to the slot's bone and its parent. Each animation has a rotate
+		/// and translate timeline per bone and an RGBA timeline per slot, all with bezier curves.
+		std::string makeSkeletonJson(int boneCount, int animationCount);
+
+		/// Parses skeleton JSON or binary with a TestAttachmentLoader, failing the running test on errors.
+		SkeletonData *readSkeletonJson(const std::string &json);
+
+		SkeletonData *readSkeletonBinary(const std::string &binary);
+
+		/// Wall clock time since construction, for benchmarks.
+		class Timer {
+		public:
+			Timer();
+
+			double getMilliseconds() const;
+
+		private:
+			std::chrono::steady_clock::time_point _start;
+		};
+
+		/// True if a benchmark was started with --quick, as ctest does, to run a single short iteration.
+		bool isQuick(int argc, char **argv);
+	}
+}
+
+#define SPINE_TEST(name) \
+static void name(); \
+static spine::test::TestCase name##Case(#name, name); \
+static void name()
+
+#define SPINE_CHECK(condition) \
+do { if (!(condition)) spine::test::fail(__FILE__, __LINE__, #condition); } while (0)
+
+#define SPINE_CHECK_NEAR(actual, expected, epsilon) \
+do { if (!((actual) - (expected) <= (epsilon) && (expected) - (actual) <= (epsilon))) \
+spine::test::fail(__FILE__, __LINE__, #actual " is not within " #epsilon " of " #expected); } while (0)
+
+#endif /* Spine_SpineTest_h */
@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "SpineTest.h"
+
+#include <cstdlib>
+
+using namespace spine;
+using namespace spine::test;
+
+// The linear scan Animation::search used before the binary search, as the reference.
+static int linearSearch(Vector<float> &frames, float target, int step) {
+	size_t n = frames.size();
+	for (size_t i = step; i < n; i += step)
+		if (frames[i] > target) return (int) (i - step);
+	return (int) (n - step);
+}
+
+SPINE_TEST(searchMatchesLinearScan) {
+	srand(7);
+	for (int round = 0; round < 3000; round++) {
+		int frameCount = 1 + rand() % (round % 10 == 0 ? 3000 : 20);
+		RotateTimeline rotate(frameCount, 0, 0);
+		TranslateTimeline translate(frameCount, 0, 0);
+		AttachmentTimeline attachment(frameCount, 0);
+		float time = (rand() % 100) / 10.0f;
+		for (int frame = 0; frame < frameCount; frame++) {
+			rotate.setFrame(frame, time, 0);
+			translate.setFrame(frame, time, 0, 0);
+			attachment.setFrame(frame, time, "");
+			// A quarter of the keys repeat the previous time.
+			if (rand() % 4) time += (rand() % 100) / 37.0f;
+		}
+
+		// Two cursors per timeline, like two track entries playing the animation at different times.
+		size_t rotateCursors[2] = {0, 0}, translateCursors[2] = {0, 0}, attachmentCursors[2] = {0, 0};
+		float playTimes[2] = {-1, -1};
+		Vector<float> &frames = rotate.getFrames();
+		for (int query = 0; query < 400; query++) {
+			int track = rand() % 2;
+			float target;
+			switch (rand() % 4) {
+				case 0:
+					target = (rand() % 100000) / 100.0f - 10;
+					break;
+				case 1:
+					target = playTimes[track] += (rand() % 100) / 200.0f;
+					break;
+				case 2:
+					target = frames[(rand() % frameCount) * 2];
+					break;
+				default:
+					target = frames[(rand() % frameCount) * 2] + 1e-4f;
+			}
+			int expected = linearSearch(frames, target, 2);
+			SPINE_CHECK(rotate.searchFrame(target, NULL) == expected);
+			SPINE_CHECK(rotate.searchFrame(target, rotateCursors + track) == expected);
+			SPINE_CHECK(translate.searchFrame(target, translateCursors + track) ==
+						linearSearch(translate.getFrames(), target, 3));
+			SPINE_CHECK(attachment.searchFrame(target, attachmentCursors + track) ==
+						linearSearch(attachment.getFrames(), target, 1));
+		}
+	}
+}
+
+// Entries playing the same animation at different times keep separate cursors, so each pose matches applying the
+// animation without a cursor.
+SPINE_TEST(entriesPlayingTheSameAnimationMatchUncachedApply) {
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(15, 1));
+	if (!skeletonData) return;
+	{
+		Animation *animation = skeletonData->getAnimations()[0];
+		AnimationStateData stateData(skeletonData);
+		AnimationState early(&stateData), late(&stateData);
+		early.setAnimation(0, animation, true);
+		late.setAnimation(0, animation, true)->setTrackTime(0.6f);
+		Skeleton earlySkeleton(skeletonData), lateSkeleton(skeletonData), expected(skeletonData);
+
+		for (int frame = 0; frame < 100; frame++) {
+			early.update(0.037f);
+			late.update(0.023f);
+			early.apply(earlySkeleton);
+			late.apply(lateSkeleton);
+			Skeleton *skeletons[] = {&earlySkeleton, &lateSkeleton};
+			AnimationState *states[] = {&early, &late};
+			for (int i = 0; i < 2; i++) {
+				expected.setToSetupPose();
+				animation->apply(expected, 0, states[i]->getCurrent(0)->getAnimationTime(), true, NULL, 1, MixBlend_Setup,
+								 MixDirection_In);
+				for (size_t b = 0; b < expected.getBones().size(); b++) {
+					Bone *actual = skeletons[i]->getBones()[b], *bone = expected.getBones()[b];
+					// MixBlend_First blends from the previous pose, so allow for rounding.
+					SPINE_CHECK_NEAR(actual->getRotation(), bone->getRotation(), 1e-3f);
+					SPINE_CHECK_NEAR(actual->getX(), bone->getX(), 1e-4f);
+					SPINE_CHECK_NEAR(actual->getY(), bone->getY(), 1e-4f);
+				}
+				for (size_t s = 0; s < expected.getSlots().size(); s++)
+					SPINE_CHECK_NEAR(skeletons[i]->getSlots()[s]->getColor().r, expected.getSlots()[s]->getColor().r, 1e-5f);
+			}
+		}
+	}
+	delete skeletonData;
+}
+
+// A timeline written before the cursor was added, overriding only the apply without one.
+class LegacyTimeline : public Timeline {
+public:
+	int applied;
+
+	LegacyTimeline() : Timeline(1, 1), applied(0) {}
+
+	virtual void apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
+					   MixBlend blend, MixDirection direction) {
+		applied++;
+	}
+};
+
+SPINE_TEST(timelinesWithoutCursorStillApply) {
+	SkeletonData *skeletonData = readSkeletonJson(makeSkeletonJson(1, 0));
+	if (!skeletonData) return;
+	{
+		Skeleton skeleton(skeletonData);
+		LegacyTimeline legacy;
+		Timeline &timeline = legacy;
+		size_t cursor = 0;
+		timeline.apply(skeleton, 0, 1, NULL, 1, MixBlend_Setup, MixDirection_In, &cursor);
+		timeline.apply(skeleton, 0, 1, NULL, 1, MixBlend_Setup, MixDirection_In);
+		SPINE_CHECK(legacy.applied == 2);
+
+		// Callers of a concrete timeline can still omit the cursor.
+		RotateTimeline rotate(2, 0, 0);
+		rotate.setFrame(0, 0, 10);
+		rotate.setFrame(1, 1, 30);
+		rotate.apply(skeleton, 0, 0.5f, NULL, 1, MixBlend_Setup, MixDirection_In);
+		SPINE_CHECK_NEAR(skeleton.getBones()[0]->getRotation(), 20, 1e-4f);
+	}
+	delete skeletonData;
+}